@@ -0,0 +1,17 @@
+// generates asm_offsets.h so exceptions.S does not hardcode struct offsets.
+// this file is only ever compiled with -S, see the Makefile.
+#include <stddef.h>
+
+#include "task.h"
+
+#define DEFINE(sym, val) asm volatile("\n.ascii \"->" #sym " %0\"" : : "i"(val))
+
+void asm_offsets() {
+  DEFINE(TASK_CONTEXT, offsetof(struct TaskDescriptor, context));
+
+  DEFINE(CONTEXT_REGISTERS, offsetof(struct TaskContext, registers));
+  DEFINE(CONTEXT_SP, offsetof(struct TaskContext, sp));
+  DEFINE(CONTEXT_LR, offsetof(struct TaskContext, lr));
+  DEFINE(CONTEXT_PSTATE, offsetof(struct TaskContext, pstate));
+  DEFINE(CONTEXT_SIZE, sizeof(struct TaskContext));
+}
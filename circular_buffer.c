@@ -1,66 +1,118 @@
 #include "circular_buffer.h"
 
+#include "util.h"
+
+// capacity is a power of two so indices wrap with a mask instead of a division
+#define BUFFER_MASK (BUFFER_CAPACITY - 1)
+
+_Static_assert(
+    (BUFFER_CAPACITY & BUFFER_MASK) == 0,
+    "circular buffer capacity must be a power of two"
+);
+
 void circular_buffer_init(struct CircularBuffer *buffer) {
   buffer->size = 0;
   buffer->headIndex = 0;
   buffer->tailIndex = 0;
 }
 
-static bool is_full(const struct CircularBuffer *buffer) {
-  return buffer->size == BUFFER_CAPACITY;
+static unsigned int free_space(const struct CircularBuffer *buffer) {
+  return BUFFER_CAPACITY - buffer->size;
 }
 
-static void circular_buffer_write_item(
-    struct CircularBuffer *buffer,
-    union CircularBufferItem item) {
-  if (is_full(buffer)) {
+void circular_buffer_write(struct CircularBuffer *buffer, unsigned char ch) {
+  if (buffer->size == BUFFER_CAPACITY) {
     return;
   }
 
-  *(buffer->data + buffer->tailIndex) = item;
-  buffer->tailIndex = (buffer->tailIndex + 1) % BUFFER_CAPACITY;
+  buffer->data[buffer->tailIndex] = ch;
+  buffer->tailIndex = (buffer->tailIndex + 1) & BUFFER_MASK;
   ++buffer->size;
 }
 
-void circular_buffer_write(struct CircularBuffer *buffer, unsigned char ch) {
-  union CircularBufferItem item = {.ch = ch};
-  circular_buffer_write_item(buffer, item);
-}
-
 void circular_buffer_write_int8(struct CircularBuffer *buffer, uint8_t i) {
-  union CircularBufferItem item = {.i = i};
-  circular_buffer_write_item(buffer, item);
+  circular_buffer_write(buffer, i);
 }
 
-void circular_buffer_write_n(struct CircularBuffer *buffer, const unsigned char *data, unsigned int size) {
-  for (unsigned int i = 0; i < size; ++i) {
-    circular_buffer_write(buffer, data[i]);
+unsigned int circular_buffer_write_n(
+    struct CircularBuffer *buffer,
+    const unsigned char *data,
+    unsigned int size) {
+  // anything that does not fit is dropped
+  size = min(size, free_space(buffer));
+
+  // copy up to the end of the array, then the rest to the front
+  unsigned int first = min(size, BUFFER_CAPACITY - buffer->tailIndex);
+  memcpy(buffer->data + buffer->tailIndex, data, first);
+  if (first < size) {
+    memcpy(buffer->data, data + first, size - first);
   }
+
+  buffer->tailIndex = (buffer->tailIndex + size) & BUFFER_MASK;
+  buffer->size += size;
+
+  return size;
 }
 
 void circular_buffer_write_int64(struct CircularBuffer *buffer, uint64_t i) {
-  // storing 64 bit int into 8 8-bit ints
+  // stored little endian, one byte per item
+  unsigned char bytes[sizeof(uint64_t)];
   for (unsigned int byte = 0; byte < sizeof(uint64_t); ++byte) {
-    // take last 8 bits of i
-    circular_buffer_write_int8(buffer, (uint8_t) (i & 0xFF));
+    bytes[byte] = (uint8_t) (i & 0xFF);
     i >>= 8;
   }
+
+  if (free_space(buffer) >= sizeof(bytes)) {
+    circular_buffer_write_n(buffer, bytes, sizeof(bytes));
+  }
+}
+
+unsigned char *circular_buffer_reserve_contiguous(
+    struct CircularBuffer *buffer,
+    unsigned int *len) {
+  *len = min(free_space(buffer), BUFFER_CAPACITY - buffer->tailIndex);
+  return buffer->data + buffer->tailIndex;
+}
+
+void circular_buffer_commit(struct CircularBuffer *buffer, unsigned int len) {
+  buffer->tailIndex = (buffer->tailIndex + len) & BUFFER_MASK;
+  buffer->size += len;
+}
+
+static void copy_out(const struct CircularBuffer *buffer, unsigned char *out, unsigned int size) {
+  unsigned int first = min(size, BUFFER_CAPACITY - buffer->headIndex);
+  memcpy(out, buffer->data + buffer->headIndex, first);
+  if (first < size) {
+    memcpy(out + first, buffer->data, size - first);
+  }
 }
 
 uint64_t circular_buffer_peek_int64(struct CircularBuffer *buffer) {
-  uint64_t i = 0;
+  unsigned char bytes[sizeof(uint64_t)];
+  copy_out(buffer, bytes, sizeof(bytes));
 
   // reconstruct 64 bit int by combining 8 8-bit ints
+  uint64_t i = 0;
   for (int byte = sizeof(uint64_t) - 1; byte >= 0; --byte) {
-    union CircularBufferItem item = buffer->data[(buffer->headIndex + byte) % BUFFER_CAPACITY];
-
     i = i << 8;
-    i |= item.i;
+    i |= bytes[byte];
   }
 
   return i;
 }
 
+const unsigned char *circular_buffer_peek_contiguous(
+    struct CircularBuffer *buffer,
+    unsigned int *len) {
+  *len = min(buffer->size, BUFFER_CAPACITY - buffer->headIndex);
+  return buffer->data + buffer->headIndex;
+}
+
+void circular_buffer_consume(struct CircularBuffer *buffer, unsigned int len) {
+  buffer->headIndex = (buffer->headIndex + len) & BUFFER_MASK;
+  buffer->size -= len;
+}
+
 size_t circular_buffer_size(struct CircularBuffer *buffer) {
   return buffer->size;
 }
@@ -69,33 +121,41 @@ bool circular_buffer_empty(struct CircularBuffer *buffer) {
   return buffer->size == 0;
 }
 
-static union CircularBufferItem circular_buffer_read_item(struct CircularBuffer *buffer) {
-  union CircularBufferItem item = *(buffer->data + buffer->headIndex);
-  buffer->headIndex = (buffer->headIndex + 1) % BUFFER_CAPACITY;
-  --buffer->size;
+char circular_buffer_peek(struct CircularBuffer *buffer) {
+  return buffer->data[buffer->headIndex];
+}
 
-  return item;
+// offset from the head, must be less than the size of the buffer
+char circular_buffer_peek_at(struct CircularBuffer *buffer, unsigned int offset) {
+  return buffer->data[(buffer->headIndex + offset) & BUFFER_MASK];
 }
 
 char circular_buffer_read(struct CircularBuffer *buffer) {
-  return circular_buffer_read_item(buffer).ch;
+  unsigned char ch = buffer->data[buffer->headIndex];
+  circular_buffer_consume(buffer, 1);
+
+  return ch;
 }
 
-void circular_buffer_read_n(struct CircularBuffer *buffer, unsigned char *out, unsigned int size) {
-  for (unsigned int i = 0; i < size; ++i) {
-    out[i] = circular_buffer_read(buffer);
-  }
+unsigned int circular_buffer_read_n(
+    struct CircularBuffer *buffer,
+    unsigned char *out,
+    unsigned int size) {
+  size = min(size, buffer->size);
+
+  copy_out(buffer, out, size);
+  circular_buffer_consume(buffer, size);
+
+  return size;
 }
 
 uint8_t circular_buffer_read_int8(struct CircularBuffer *buffer) {
-  return circular_buffer_read_item(buffer).i;
+  return circular_buffer_read(buffer);
 }
 
 uint64_t circular_buffer_read_int64(struct CircularBuffer *buffer) {
   uint64_t i = circular_buffer_peek_int64(buffer);
-
-  buffer->headIndex = (buffer->headIndex + sizeof(uint64_t)) % BUFFER_CAPACITY;
-  buffer->size -= sizeof(uint64_t);
+  circular_buffer_consume(buffer, sizeof(uint64_t));
 
   return i;
 }
@@ -4,15 +4,12 @@
 #include <stddef.h>
 #include <stdint.h>
 
-#define BUFFER_CAPACITY 2048
+#include "kernel_config.h"
 
-union CircularBufferItem {
-  unsigned char ch;
-  uint8_t i;
-};
+#define BUFFER_CAPACITY CONFIG_BUFFER_CAPACITY
 
 struct CircularBuffer {
-  union CircularBufferItem data[BUFFER_CAPACITY];
+  unsigned char data[BUFFER_CAPACITY];
   size_t size;
   unsigned int headIndex;
   unsigned int tailIndex;
@@ -20,15 +17,33 @@ struct CircularBuffer {
 
 void circular_buffer_init(struct CircularBuffer *buffer);
 void circular_buffer_write(struct CircularBuffer *buffer, unsigned char ch);
-void circular_buffer_write_n(
+// returns the number of bytes written, anything that does not fit is dropped
+unsigned int circular_buffer_write_n(
     struct CircularBuffer *buffer,
     const unsigned char *data,
     unsigned int size);
 void circular_buffer_write_int8(struct CircularBuffer *buffer, uint8_t i);
 void circular_buffer_write_int64(struct CircularBuffer *buffer, uint64_t i);
+// free space after the tail that can be written to in place, followed by a commit of the bytes
+// that were written
+unsigned char *circular_buffer_reserve_contiguous(
+    struct CircularBuffer *buffer,
+    unsigned int *len);
+void circular_buffer_commit(struct CircularBuffer *buffer, unsigned int len);
+// data after the head that can be read in place, followed by a consume of the bytes that were read
+const unsigned char *circular_buffer_peek_contiguous(
+    struct CircularBuffer *buffer,
+    unsigned int *len);
+void circular_buffer_consume(struct CircularBuffer *buffer, unsigned int len);
 uint64_t circular_buffer_peek_int64(struct CircularBuffer *buffer);
+char circular_buffer_peek(struct CircularBuffer *buffer);
+char circular_buffer_peek_at(struct CircularBuffer *buffer, unsigned int offset);
 char circular_buffer_read(struct CircularBuffer *buffer);
-void circular_buffer_read_n(struct CircularBuffer *buffer, unsigned char *out, unsigned int size);
+// returns the number of bytes read
+unsigned int circular_buffer_read_n(
+    struct CircularBuffer *buffer,
+    unsigned char *out,
+    unsigned int size);
 uint8_t circular_buffer_read_int8(struct CircularBuffer *buffer);
 uint64_t circular_buffer_read_int64(struct CircularBuffer *buffer);
 bool circular_buffer_empty(struct CircularBuffer *buffer);
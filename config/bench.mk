@@ -0,0 +1,15 @@
+# kernel profile for the benchmark suite in user/test/bench_suite.c
+
+# servers, the runner, a case task and up to 16 senders plus a receiver
+CONFIG_TASKS_MAX := 48
+CONFIG_MAX_PRIORITY := 64
+# in 64-bit words, benchmark tasks only keep small message buffers on their stacks
+CONFIG_STACK_SIZE := 16384
+CONFIG_BUFFER_CAPACITY := 2048
+# the terminal emulator has to be set to the same rate
+CONFIG_CONSOLE_BAUD := 115200
+
+CONFIG_BENCHMARK := 1
+CONFIG_PROFILING := 1
+CONFIG_DEBUG := 0
+CONFIG_SCHEDULED_ROUTES := 0
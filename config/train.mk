@@ -0,0 +1,20 @@
+# kernel profile for running the train controller
+
+# ~25 long lived tasks plus the short lived reverse and solenoid tasks
+CONFIG_TASKS_MAX := 64
+CONFIG_MAX_PRIORITY := 64
+# in 64-bit words, the planner and manager keep large tables on their stacks
+CONFIG_STACK_SIZE := 524288
+CONFIG_BUFFER_CAPACITY := 2048
+# the terminal emulator has to be set to the same rate
+CONFIG_CONSOLE_BAUD := 115200
+
+CONFIG_BENCHMARK := 0
+# record cycle counts in the irq path and enable the PMU
+CONFIG_PROFILING := 0
+# debug.h register dumps and debug_printf
+CONFIG_DEBUG := 0
+# trains plan around the zones other trains' plans pass through, in time, instead of only
+# reserving zones as they go, see README. off until the planner searches over time instead of
+# retrying whole departures
+CONFIG_SCHEDULED_ROUTES := 0
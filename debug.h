@@ -2,10 +2,11 @@
 
 #include <stdarg.h>
 
+#include "kernel_config.h"
 #include "rpi.h"
 #include "task.h"
 
-#define DEBUG 0
+#define DEBUG CONFIG_DEBUG
 
 // NOTE: completely clobbers registers
 void debug_dump_registers() {
@@ -23,7 +23,9 @@ void handle_invalid_exception() {
   for (;;) {}
 }
 
-void handle_exception(uint64_t exception_info) {
+// returns true if the calling task continues to run, in which case svc_entry only has to restore
+// its return value
+bool handle_svc(uint64_t exception_info) {
   int exception_class = (exception_info >> 26) & EC_MASK;
 
   if (exception_class != EC_SVC) {
@@ -32,6 +34,7 @@ void handle_exception(uint64_t exception_info) {
   }
 
   struct TaskDescriptor *current_task = task_get_current_task();
+  struct TaskDescriptor *caller = current_task;
   enum SyscallType syscall_type = exception_info & SYSCALL_TYPE_MASK;
 
   switch (syscall_type) {
@@ -94,6 +97,12 @@ void handle_exception(uint64_t exception_info) {
     for (;;) {}  // spin forever
   }
 
+  return task_get_current_task() == caller;
+}
+
+void handle_exception(uint64_t exception_info) {
+  handle_svc(exception_info);
+
   // run task
   kern_exit();
 }
@@ -187,10 +196,11 @@ int syscall_send(
 
     // msg copy and overflow detection
     *(receiver->receive_buffer.tid) = sender->tid;
-    memcpy(
-        receiver->receive_buffer.msg,
-        sender->outgoing_msg.msg,
-        min(receiver->receive_buffer.msglen, sender->outgoing_msg.msglen));
+    int len = min(receiver->receive_buffer.msglen, sender->outgoing_msg.msglen);
+    memcpy(receiver->receive_buffer.msg, sender->outgoing_msg.msg, len);
+
+    // receive returns the length of the message that was copied
+    receiver->context.registers[0] = len;
 
     // set status to READY and push to ready_queue
     task_schedule(receiver);
@@ -259,13 +269,16 @@ int syscall_reply(int tid, const char *reply, int rplen) {
   int length = min(reply_msg->msglen, rplen);
   memcpy(reply_msg->msg, reply, length);
 
+  // send returns the length of the reply
+  sender->context.registers[0] = length;
+
   // set status to READY and push to ready queue
   task_schedule(sender);
   return length;
 }
 
 int syscall_await_event(int event_id) {
-  if (event_id < 0 || event_id > EVENT_MAX) {
+  if (event_id < 0 || event_id >= EVENT_MAX) {
     return -1;
   }
 
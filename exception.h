@@ -1,9 +1,11 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "task.h"
 
+bool handle_svc(uint64_t exception);
 void handle_exception(uint64_t exception);
 void handle_invalid_exception();
 
@@ -4,6 +4,8 @@
 #include <stdint.h>
 
 #include "event_task_queue.h"
+#include "kernel_config.h"
+#include "pmu.h"
 #include "rpi.h"
 #include "task.h"
 #include "timer.h"
@@ -46,6 +48,16 @@ static struct EventBlockedTaskQueue event_blocked_queue;
 
 static bool missed_irq[EVENT_MAX];
 
+// acknowledged by irq_handle_fast, finished by handle_irq if the fast path escalates
+static uint32_t pending_iar;
+static enum Event pending_event;
+
+// cycle count when the last interrupt for each event was taken, for measuring wakeup latency
+#if CONFIG_PROFILING
+static uint64_t irq_cycles;
+#endif
+static uint64_t event_cycles[EVENT_MAX];
+
 void irq_init() {
   event_blocked_task_queue_init(&event_blocked_queue);
 
@@ -67,6 +79,10 @@ void irq_enable(enum InterruptSource irq_id) {
   GICD_ISENABLER(GICD_ISENABLER_N(irq_id)) = 1 << GICD_BIT_OFFSET(irq_id);
 }
 
+void irq_set_pending(enum InterruptSource irq_id) {
+  GICD_ISPENDR(GICD_ISPENDR_N(irq_id)) = 1 << GICD_BIT_OFFSET(irq_id);
+}
+
 void irq_await_event(enum Event event) {
   struct TaskDescriptor *task = task_get_current_task();
 
@@ -80,8 +96,34 @@ void irq_await_event(enum Event event) {
   }
 }
 
+// called with only the caller-saved registers stored, returns true if the interrupt was handled
+// without needing to wake a task so we can return straight to the interrupted task
+bool irq_handle_fast() {
+#if CONFIG_PROFILING
+  irq_cycles = pmu_cycles();
+#endif
+  pending_iar = *GICC_IAR;
+  pending_event = EVENT_UNKNOWN;
+
+  if ((pending_iar & GICC_IAR_IRQ_ID_MASK) != IRQ_UART) {
+    return false;
+  }
+
+  pending_event = uart_handle_fast_irq();
+  if (pending_event != EVENT_IGNORE) {
+    return false;
+  }
+
+  *GICC_EOIR = pending_iar;
+  return true;
+}
+
+uint64_t irq_get_event_cycles(enum Event event) {
+  return event_cycles[event];
+}
+
 void handle_irq() {
-  uint32_t iar = *GICC_IAR;
+  uint32_t iar = pending_iar;
   uint32_t irq_id = iar & GICC_IAR_IRQ_ID_MASK;
   int retval = 0;
   enum Event event = EVENT_UNKNOWN;
@@ -93,7 +135,8 @@ void handle_irq() {
       event = EVENT_TIMER;
       break;
     case IRQ_UART:
-      event = uart_handle_irq();
+      // marklin interrupts are handled in the fast path
+      event = pending_event != EVENT_UNKNOWN ? pending_event : uart_handle_irq();
       break;
     case IRQ_SPURIOUS:
       break;
@@ -102,9 +145,14 @@ void handle_irq() {
   }
 
   if (irq_id != IRQ_SPURIOUS) {
+#if CONFIG_PROFILING
+    event_cycles[event] = irq_cycles;
+#endif
+
     if (event != EVENT_IGNORE && event != EVENT_UART_CONSOLE_TX &&
         event_blocked_task_queue_size(&event_blocked_queue, event) == 0) {
-      if (missed_irq[event]) {
+      // a tx drain only means there is room again, so repeats can be merged
+      if (missed_irq[event] && event != EVENT_UART_MARKLIN_TX) {
         printf("irq_handler: missed interrupt %d\r\n", event);
         while (true) {}
       }
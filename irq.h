@@ -1,13 +1,11 @@
 #pragma once
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include "task.h"
 #include "task_queue.h"
 
-// must equal to the number of events
-#define EVENT_MAX 10
-
 // max priority
 #define NOTIFIER_PRIORITY (MAX_PRIORITY - 1)
 
@@ -23,9 +21,15 @@ enum Event {
   EVENT_IGNORE
 };
 
+// number of events, used to size the per event tables
+#define EVENT_MAX (EVENT_IGNORE + 1)
+
 enum InterruptSource { IRQ_TIMER_C1 = 97, IRQ_TIMER_C3 = 99, IRQ_UART = 153, IRQ_SPURIOUS = 1023 };
 
 void irq_init();
 void irq_enable(enum InterruptSource irq_id);
+void irq_set_pending(enum InterruptSource irq_id);
 void irq_await_event(enum Event event);
+uint64_t irq_get_event_cycles(enum Event event);
+bool irq_handle_fast();
 void handle_irq();
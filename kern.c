@@ -1,5 +1,7 @@
 #include "exception.h"
 #include "irq.h"
+#include "kernel_config.h"
+#include "pmu.h"
 #include "syscall.h"
 #include "task.h"
 #include "task_queue.h"
@@ -23,13 +25,16 @@ const char *train =
 extern void kern_exit();
 
 int kmain() {
-  uart_config_and_enable(UART_CONSOLE, 115200, false, true, false);
+  uart_config_and_enable(UART_CONSOLE, CONFIG_CONSOLE_BAUD, false, true, false);
   uart_init();
   uart_puts(UART_CONSOLE, train);
   uart_puts(UART_CONSOLE, "Booting...\r\n");
 
   irq_init();
   timer_init();
+#if CONFIG_PROFILING
+  pmu_init();
+#endif
 
   tasks_init();
   task_queues_init();
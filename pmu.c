@@ -0,0 +1,41 @@
+#include "pmu.h"
+
+#include <stdint.h>
+
+// PMCR_EL0: enable counters, reset event counters, reset cycle counter
+static const uint64_t PMCR_E = 1 << 0;
+static const uint64_t PMCR_P = 1 << 1;
+static const uint64_t PMCR_C = 1 << 2;
+
+// PMUSERENR_EL0: allow EL0 to read the cycle and event counters
+static const uint64_t PMUSERENR_EN = 1 << 0;
+static const uint64_t PMUSERENR_CR = 1 << 2;
+static const uint64_t PMUSERENR_ER = 1 << 3;
+
+static const uint64_t PMCNTENSET_CYCLES = 1u << 31;
+static const uint64_t PMCNTENSET_EVENT0 = 1 << 0;
+
+// common event number for level 1 data cache refills
+static const uint64_t EVENT_L1D_CACHE_REFILL = 0x03;
+
+void pmu_init() {
+  asm volatile("msr PMEVTYPER0_EL0, %0" : : "r"(EVENT_L1D_CACHE_REFILL));
+  // count at EL0 and EL1
+  asm volatile("msr PMCCFILTR_EL0, xzr");
+  asm volatile("msr PMCNTENSET_EL0, %0" : : "r"(PMCNTENSET_CYCLES | PMCNTENSET_EVENT0));
+  asm volatile("msr PMUSERENR_EL0, %0" : : "r"(PMUSERENR_EN | PMUSERENR_CR | PMUSERENR_ER));
+  asm volatile("msr PMCR_EL0, %0" : : "r"(PMCR_E | PMCR_P | PMCR_C));
+  asm volatile("isb");
+}
+
+uint64_t pmu_cycles() {
+  uint64_t cycles;
+  asm volatile("mrs %0, PMCCNTR_EL0" : "=r"(cycles));
+  return cycles;
+}
+
+uint64_t pmu_l1d_refills() {
+  uint64_t refills;
+  asm volatile("mrs %0, PMEVCNTR0_EL0" : "=r"(refills));
+  return refills;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include <stdint.h>
+
+void pmu_init();
+
+// readable from user tasks once pmu_init has run
+uint64_t pmu_cycles();
+uint64_t pmu_l1d_refills();
@@ -0,0 +1,117 @@
+// throughput of CircularBuffer on the development machine, byte at a time against the segment
+// copies of circular_buffer_write_n/read_n. uses the same circular_buffer.c and util.c memcpy as
+// the kernel, so the difference between the two carries over even though the numbers do not.
+//
+//   buffer_bench [-m megabytes]
+//
+//   -m megabytes  moved through the buffer for each chunk size, 64 by default
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "circular_buffer.h"
+
+// each chunk size is timed this many times and the fastest run is kept
+#define RUNS 5
+
+static const unsigned int CHUNK_SIZES[] = {1, 16, 64, 256, 1024};
+
+static unsigned char chunk[BUFFER_CAPACITY];
+
+static uint64_t now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// what circular_buffer_write_n/read_n did before they copied in segments
+static void copy_bytes(struct CircularBuffer *buffer, unsigned int size) {
+  for (unsigned int i = 0; i < size; ++i) {
+    circular_buffer_write(buffer, chunk[i]);
+  }
+
+  for (unsigned int i = 0; i < size; ++i) {
+    chunk[i] = circular_buffer_read(buffer);
+  }
+}
+
+static void copy_segments(struct CircularBuffer *buffer, unsigned int size) {
+  circular_buffer_write_n(buffer, chunk, size);
+  circular_buffer_read_n(buffer, chunk, size);
+}
+
+// nanoseconds to write and read back total bytes, size at a time
+static uint64_t time_copy(
+    void (*copy)(struct CircularBuffer *, unsigned int),
+    unsigned int size,
+    uint64_t total
+) {
+  static struct CircularBuffer buffer;
+  uint64_t best = UINT64_MAX;
+
+  for (int run = 0; run < RUNS; ++run) {
+    // half full so the head and tail drift around the array and chunks wrap
+    circular_buffer_init(&buffer);
+    circular_buffer_write_n(&buffer, chunk, BUFFER_CAPACITY / 2);
+
+    uint64_t start = now_ns();
+    for (uint64_t moved = 0; moved < total; moved += size) {
+      copy(&buffer, size);
+    }
+    uint64_t elapsed = now_ns() - start;
+
+    if (elapsed < best) {
+      best = elapsed;
+    }
+  }
+
+  return best;
+}
+
+static void report(const char *name, unsigned int size, uint64_t total, uint64_t elapsed) {
+  printf(
+      "%s,%u,%.3f,%.1f\n",
+      name,
+      size,
+      (double) elapsed / total,
+      (double) total / (1 << 20) / ((double) elapsed / 1000000000)
+  );
+}
+
+int main(int argc, char *argv[]) {
+  uint64_t megabytes = 64;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "m:")) != -1) {
+    switch (opt) {
+      case 'm':
+        megabytes = atoi(optarg);
+        break;
+      default:
+        fprintf(stderr, "usage: %s [-m megabytes]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  uint64_t total = megabytes << 20;
+
+  for (unsigned int i = 0; i < sizeof(chunk); ++i) {
+    chunk[i] = i;
+  }
+
+  // a byte is written and read back, so the rate counts it once
+  printf("copy,chunk,ns_per_byte,mb_per_s\n");
+
+  for (unsigned int i = 0; i < sizeof(CHUNK_SIZES) / sizeof(CHUNK_SIZES[0]); ++i) {
+    unsigned int size = CHUNK_SIZES[i];
+
+    report("bytes", size, total, time_copy(copy_bytes, size, total));
+    report("segments", size, total, time_copy(copy_segments, size, total));
+  }
+
+  return 0;
+}
@@ -0,0 +1,366 @@
+#include "host_board.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <unistd.h>
+
+#include "host_kernel.h"
+#include "irq.h"
+#include "pmu.h"
+#include "rpi.h"
+#include "timer.h"
+#include "uart.h"
+#include "util.h"
+
+// 2400 baud with 8 data bits, a start bit and two stop bits
+static const uint64_t MARKLIN_BYTE_TIME = 11 * 1000000 / 2400;
+static const unsigned char MARKLIN_CMD_READ_ALL_SENSORS = 0x80 + 5;
+static const unsigned char MARKLIN_CMD_READ_SENSOR_MODULE = 0xC0;
+
+#define MARKLIN_RING_SIZE 256
+#define MARKLIN_SENSOR_DUMP_LEN 10
+#define CONSOLE_INPUT_MAX 4096
+#define CONSOLE_LINES_MAX 64
+
+const size_t UART_CONSOLE = 1;
+const size_t UART_MARKLIN = 2;
+const uint32_t TIMER_TICK_DURATION = 10000;
+
+struct ByteRing {
+  unsigned char data[MARKLIN_RING_SIZE];
+  unsigned int read;
+  unsigned int written;
+};
+
+static struct {
+  struct MarklinModel *model;
+
+  // bytes from tasks to the box, and from the box to tasks
+  struct ByteRing tx;
+  struct ByteRing rx;
+
+  // when cts is up again and the next byte can go out
+  uint64_t ready_at;
+  // the box's reply to the last command, each byte arrives a byte time after the last
+  unsigned char reply[MARKLIN_MODEL_REPLY_MAX];
+  size_t reply_len;
+  size_t reply_received;
+  uint64_t reply_at;
+
+  // same bookkeeping as the kernel's fast path in uart.c
+  unsigned int dump_remaining;
+  unsigned int dump_index;
+  uint64_t stamps[MARKLIN_SENSOR_DUMP_LEN];
+} marklin;
+
+static struct {
+  int fd;
+  bool tx_irq;
+
+  char input[CONSOLE_INPUT_MAX];
+  unsigned int input_len;
+  unsigned int input_read;
+  // the input that has arrived so far
+  unsigned int input_arrived;
+
+  // typed text arrives a line at a time, each ends at line_ends and arrives at line_times
+  unsigned int line_ends[CONSOLE_LINES_MAX];
+  uint64_t line_times[CONSOLE_LINES_MAX];
+  unsigned int lines_len;
+  unsigned int lines_arrived;
+} console;
+
+static size_t ring_size(struct ByteRing *ring) {
+  return ring->written - ring->read;
+}
+
+static size_t ring_write(struct ByteRing *ring, const unsigned char *buf, size_t len) {
+  size_t written = 0;
+  while (written < len && ring_size(ring) < MARKLIN_RING_SIZE) {
+    ring->data[ring->written++ % MARKLIN_RING_SIZE] = buf[written++];
+  }
+  return written;
+}
+
+static size_t ring_read(struct ByteRing *ring, unsigned char *buf, size_t len) {
+  size_t read = 0;
+  while (read < len && ring_size(ring) > 0) {
+    buf[read++] = ring->data[ring->read++ % MARKLIN_RING_SIZE];
+  }
+  return read;
+}
+
+/*********** TIMER ********************************************/
+
+// the next tick is kept rather than worked out from now, another device can run on the tick first
+static uint64_t next_tick;
+
+static uint64_t timer_next(uint64_t now) {
+  (void) now;
+  return next_tick;
+}
+
+static void timer_run(uint64_t now) {
+  (void) now;
+  next_tick += TIMER_TICK_DURATION;
+  host_kernel_raise(EVENT_TIMER);
+}
+
+static struct HostDevice timer_device = {.next = timer_next, .run = timer_run};
+
+uint64_t timer_get_time() {
+  return host_kernel_time();
+}
+
+uint64_t pmu_cycles() {
+  // code takes no time on the host kernel, this only keeps the stats in simulated time
+  return host_kernel_time();
+}
+
+uint64_t pmu_l1d_refills() {
+  return 0;
+}
+
+uint64_t irq_get_event_cycles(enum Event event) {
+  (void) event;
+  return 0;
+}
+
+/*********** MARKLIN ******************************************/
+
+static bool marklin_replying() {
+  return marklin.reply_received < marklin.reply_len;
+}
+
+static uint64_t marklin_next(uint64_t now) {
+  if (marklin_replying()) {
+    return marklin.reply_at;
+  }
+
+  if (marklin.dump_remaining > 0 || ring_size(&marklin.tx) == 0) {
+    return HOST_TIME_NEVER;
+  }
+
+  return marklin.ready_at > now ? marklin.ready_at : now;
+}
+
+// the next reply byte arrives on the rx line
+static void marklin_receive(uint64_t now) {
+  unsigned char ch = marklin.reply[marklin.reply_received++];
+  ring_write(&marklin.rx, &ch, 1);
+  marklin.reply_at += MARKLIN_BYTE_TIME;
+
+  if (marklin.dump_remaining > 0) {
+    marklin.stamps[marklin.dump_index++ % MARKLIN_SENSOR_DUMP_LEN] = now;
+    if (--marklin.dump_remaining == 0) {
+      host_kernel_raise(EVENT_UART_MARKLIN_RX);
+    }
+  } else {
+    host_kernel_raise(EVENT_UART_MARKLIN_RX);
+  }
+
+  if (!marklin_replying()) {
+    marklin.ready_at = now;
+  }
+}
+
+// the next command byte goes out on the tx line
+static void marklin_send(uint64_t now) {
+  unsigned char ch = 0;
+  ring_read(&marklin.tx, &ch, 1);
+
+  if (ch == MARKLIN_CMD_READ_ALL_SENSORS) {
+    marklin.dump_remaining = MARKLIN_SENSOR_DUMP_LEN;
+    marklin.dump_index = 0;
+  } else if (ch > MARKLIN_CMD_READ_SENSOR_MODULE && ch <= MARKLIN_CMD_READ_SENSOR_MODULE + 5) {
+    marklin.dump_remaining = 2;
+    marklin.dump_index = (ch - MARKLIN_CMD_READ_SENSOR_MODULE - 1) * 2;
+  }
+
+  // the box has the byte once it is off the wire, cts comes back a byte time later
+  uint64_t arrival = now + MARKLIN_BYTE_TIME;
+  marklin_model_advance(marklin.model, arrival - marklin.model->time);
+  marklin.reply_len = marklin_model_feed(marklin.model, ch, marklin.reply);
+  marklin.reply_received = 0;
+  marklin.reply_at = arrival + MARKLIN_BYTE_TIME;
+  marklin.ready_at = arrival + MARKLIN_BYTE_TIME;
+
+  if (ring_size(&marklin.tx) == 0) {
+    host_kernel_raise(EVENT_UART_MARKLIN_TX);
+  }
+}
+
+static void marklin_run(uint64_t now) {
+  if (marklin_replying()) {
+    marklin_receive(now);
+  } else {
+    marklin_send(now);
+  }
+}
+
+static struct HostDevice marklin_device = {.next = marklin_next, .run = marklin_run};
+
+size_t uart_marklin_read(unsigned char *buf, size_t len) {
+  return ring_read(&marklin.rx, buf, len);
+}
+
+size_t uart_marklin_write(const unsigned char *buf, size_t len) {
+  return ring_write(&marklin.tx, buf, len);
+}
+
+size_t uart_marklin_tx_pending() {
+  return ring_size(&marklin.tx);
+}
+
+void uart_marklin_sensor_stamps(uint64_t *stamps) {
+  for (unsigned int i = 0; i < MARKLIN_SENSOR_DUMP_LEN; ++i) {
+    stamps[i] = marklin.stamps[i];
+  }
+}
+
+void uart_marklin_kick() {
+  // the device is polled as soon as every task is blocked, nothing to start
+}
+
+/*********** CONSOLE ******************************************/
+
+static uint64_t console_next(uint64_t now) {
+  // the fifo never fills up, so the tx interrupt fires as long as it is enabled
+  if (console.tx_irq && host_kernel_awaited(EVENT_UART_CONSOLE_TX)) {
+    return now;
+  }
+
+  if (console.lines_arrived < console.lines_len) {
+    uint64_t at = console.line_times[console.lines_arrived];
+    return at > now ? at : now;
+  }
+
+  return HOST_TIME_NEVER;
+}
+
+static void console_run(uint64_t now) {
+  (void) now;
+
+  if (console.tx_irq && host_kernel_awaited(EVENT_UART_CONSOLE_TX)) {
+    host_kernel_raise(EVENT_UART_CONSOLE_TX);
+    return;
+  }
+
+  console.input_arrived = console.line_ends[console.lines_arrived++];
+  host_kernel_raise(EVENT_UART_CONSOLE_RX);
+}
+
+static struct HostDevice console_device = {.next = console_next, .run = console_run};
+
+void host_board_type(const char *text, uint64_t at) {
+  if (console.lines_len == CONSOLE_LINES_MAX) {
+    return;
+  }
+
+  while (*text != '\0' && console.input_len < CONSOLE_INPUT_MAX) {
+    console.input[console.input_len++] = *text++;
+  }
+
+  console.line_ends[console.lines_len] = console.input_len;
+  console.line_times[console.lines_len] = at;
+  ++console.lines_len;
+}
+
+void uart_config_and_enable(
+    size_t line,
+    uint32_t baudrate,
+    bool two_stop_bits,
+    bool fifo_buffer,
+    bool cts_irq
+) {
+  (void) line;
+  (void) baudrate;
+  (void) two_stop_bits;
+  (void) fifo_buffer;
+  (void) cts_irq;
+}
+
+void uart_enable_tx_irq(size_t line) {
+  if (line == UART_CONSOLE) {
+    console.tx_irq = true;
+  }
+}
+
+void uart_disable_tx_irq(size_t line) {
+  if (line == UART_CONSOLE) {
+    console.tx_irq = false;
+  }
+}
+
+bool uart_tx_fifo_full(size_t line) {
+  (void) line;
+  return false;
+}
+
+bool uart_hasc(size_t line) {
+  return line == UART_CONSOLE && console.input_read < console.input_arrived;
+}
+
+unsigned char uart_getc(size_t line) {
+  (void) line;
+  return console.input[console.input_read++];
+}
+
+void uart_putc(size_t line, unsigned char ch) {
+  if (line == UART_CONSOLE && console.fd >= 0) {
+    (void) !write(console.fd, &ch, 1);
+  }
+}
+
+void printf(char *fmt, ...) {
+  va_list va;
+  va_start(va, fmt);
+
+  // enough of the kernel's formatter for the servers' boot messages
+  char buf[24];
+  for (char *ch = fmt; *ch != '\0'; ++ch) {
+    if (*ch != '%' || *(ch + 1) == '\0') {
+      uart_putc(UART_CONSOLE, *ch);
+      continue;
+    }
+
+    switch (*++ch) {
+      case 'd':
+        i2a(va_arg(va, int), buf);
+        break;
+      case 'u':
+        ui2a(va_arg(va, unsigned int), 10, buf);
+        break;
+      case 'x':
+        ui2a(va_arg(va, unsigned int), 16, buf);
+        break;
+      case 's': {
+        char *str = va_arg(va, char *);
+        while (*str != '\0') {
+          uart_putc(UART_CONSOLE, *str++);
+        }
+        continue;
+      }
+      default:
+        buf[0] = *ch;
+        buf[1] = '\0';
+        break;
+    }
+
+    for (char *out = buf; *out != '\0'; ++out) {
+      uart_putc(UART_CONSOLE, *out);
+    }
+  }
+
+  va_end(va);
+}
+
+void host_board_init(struct MarklinModel *marklin_model, int console_fd) {
+  marklin.model = marklin_model;
+  console.fd = console_fd;
+  next_tick = TIMER_TICK_DURATION;
+
+  host_kernel_add_device(&timer_device);
+  host_kernel_add_device(&marklin_device);
+  host_kernel_add_device(&console_device);
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "marklin_model.h"
+
+// the hardware under the user tasks when they run on the host kernel: the timer, the console and
+// the marklin line (uart.h, timer.h, pmu.h and rpi.h). the marklin line is paced at 2400 baud
+// with the same flow control as the kernel's fast irq path, and the box on the other end is
+// marklin. console output goes to console_fd, -1 to drop it.
+void host_board_init(struct MarklinModel *marklin, int console_fd);
+
+// text arrives on the console at simulated time at, as if it was typed. calls have to be in
+// order of time.
+void host_board_type(const char *text, uint64_t at);
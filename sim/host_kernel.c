@@ -0,0 +1,415 @@
+#define _DEFAULT_SOURCE
+
+#include "host_kernel.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ucontext.h>
+
+#include "kernel_config.h"
+#include "syscall.h"
+
+#define TASKS_MAX CONFIG_TASKS_MAX
+#define PRIORITIES CONFIG_MAX_PRIORITY
+// in 64-bit words, like the kernel
+#define STACK_SIZE CONFIG_STACK_SIZE
+
+enum HostTaskStatus {
+  HOST_TASK_FREE,
+  HOST_TASK_READY,
+  HOST_TASK_ACTIVE,
+  // sent and waiting for the receiver to receive
+  HOST_TASK_SEND_BLOCKED,
+  // received before anything was sent
+  HOST_TASK_RECEIVE_BLOCKED,
+  HOST_TASK_REPLY_BLOCKED,
+  HOST_TASK_EVENT_BLOCKED
+};
+
+struct HostTask {
+  int tid;
+  int parent;
+  int priority;
+  enum HostTaskStatus status;
+  void (*function)();
+
+  ucontext_t context;
+  void *stack;
+  // return value of the syscall the task is blocked in
+  int ret;
+
+  // outgoing message and where its reply goes
+  int receiver;
+  const char *msg;
+  int msglen;
+  char *reply;
+  int rplen;
+
+  // where a receive blocked task wants the next message
+  int *receive_tid;
+  char *receive_msg;
+  int receive_msglen;
+
+  // tasks blocked sending to this one, in order, linked through next_sender
+  int senders_head;
+  int senders_tail;
+  int next_sender;
+
+  // ready queue and event queue link
+  int next;
+};
+
+struct HostTaskQueue {
+  int head;
+  int tail;
+};
+
+static struct HostTask tasks[TASKS_MAX];
+static struct HostTaskQueue ready[PRIORITIES];
+static struct HostTaskQueue event_waiters[HOST_EVENTS_MAX];
+static bool missed[HOST_EVENTS_MAX];
+
+static struct HostDevice *devices = NULL;
+static ucontext_t scheduler;
+static int current = -1;
+static uint64_t now = 0;
+static uint64_t switches = 0;
+static bool stopping = false;
+// stack of a task that exited, freed once we are off it
+static void *dead_stack = NULL;
+
+static void queue_init(struct HostTaskQueue *queue) {
+  queue->head = -1;
+  queue->tail = -1;
+}
+
+static void queue_push(struct HostTaskQueue *queue, int tid) {
+  tasks[tid].next = -1;
+  if (queue->tail < 0) {
+    queue->head = tid;
+  } else {
+    tasks[queue->tail].next = tid;
+  }
+  queue->tail = tid;
+}
+
+static int queue_pop(struct HostTaskQueue *queue) {
+  int tid = queue->head;
+  if (tid >= 0) {
+    queue->head = tasks[tid].next;
+    if (queue->head < 0) {
+      queue->tail = -1;
+    }
+  }
+  return tid;
+}
+
+static void schedule(int tid) {
+  tasks[tid].status = HOST_TASK_READY;
+  queue_push(&ready[tasks[tid].priority], tid);
+}
+
+static int highest_ready_priority() {
+  for (int i = PRIORITIES - 1; i >= 0; --i) {
+    if (ready[i].head >= 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// every syscall ends here. like the kernel the caller goes to the back of its priority and the
+// highest priority task runs next, we only switch when that is not the caller.
+static int reschedule(int ret) {
+  struct HostTask *task = &tasks[current];
+  task->ret = ret;
+
+  if (task->status == HOST_TASK_ACTIVE) {
+    if (highest_ready_priority() < task->priority && !stopping) {
+      return ret;
+    }
+    schedule(current);
+  }
+
+  swapcontext(&task->context, &scheduler);
+  return task->ret;
+}
+
+static void task_entry() {
+  tasks[current].function();
+  Exit();
+}
+
+int Create(int priority, void (*function)()) {
+  if (priority < 0 || priority >= PRIORITIES) {
+    return reschedule(-1);
+  }
+
+  int tid = 0;
+  while (tid < TASKS_MAX && tasks[tid].status != HOST_TASK_FREE) {
+    ++tid;
+  }
+
+  if (tid == TASKS_MAX) {
+    return reschedule(-2);
+  }
+
+  struct HostTask *task = &tasks[tid];
+  task->tid = tid;
+  task->parent = current;
+  task->priority = priority;
+  task->function = function;
+  task->senders_head = -1;
+  task->senders_tail = -1;
+  task->stack = malloc(STACK_SIZE * sizeof(uint64_t));
+
+  getcontext(&task->context);
+  task->context.uc_stack.ss_sp = task->stack;
+  task->context.uc_stack.ss_size = STACK_SIZE * sizeof(uint64_t);
+  task->context.uc_link = NULL;
+  makecontext(&task->context, task_entry, 0);
+
+  schedule(tid);
+  return current < 0 ? tid : reschedule(tid);
+}
+
+int MyTid() {
+  return reschedule(current);
+}
+
+int MyParentTid() {
+  return reschedule(tasks[current].parent);
+}
+
+void Yield() {
+  reschedule(0);
+}
+
+void Exit() {
+  struct HostTask *task = &tasks[current];
+  task->status = HOST_TASK_FREE;
+  dead_stack = task->stack;
+  task->stack = NULL;
+  setcontext(&scheduler);
+}
+
+static int copy(char *dest, int destlen, const char *src, int srclen) {
+  int len = destlen < srclen ? destlen : srclen;
+  if (len > 0) {
+    memcpy(dest, src, len);
+  }
+  return len;
+}
+
+int Send(int tid, const char *msg, int msglen, char *reply, int rplen) {
+  if (tid < 0 || tid >= TASKS_MAX || tasks[tid].status == HOST_TASK_FREE) {
+    return reschedule(-1);
+  }
+
+  struct HostTask *sender = &tasks[current];
+  struct HostTask *receiver = &tasks[tid];
+  sender->receiver = tid;
+  sender->msg = msg;
+  sender->msglen = msglen;
+  sender->reply = reply;
+  sender->rplen = rplen;
+
+  if (receiver->status == HOST_TASK_RECEIVE_BLOCKED) {
+    *receiver->receive_tid = current;
+    receiver->ret = copy(receiver->receive_msg, receiver->receive_msglen, msg, msglen);
+    schedule(tid);
+    sender->status = HOST_TASK_REPLY_BLOCKED;
+  } else {
+    sender->next_sender = -1;
+    if (receiver->senders_tail < 0) {
+      receiver->senders_head = current;
+    } else {
+      tasks[receiver->senders_tail].next_sender = current;
+    }
+    receiver->senders_tail = current;
+    sender->status = HOST_TASK_SEND_BLOCKED;
+  }
+
+  return reschedule(-2);
+}
+
+int Receive(int *tid, char *msg, int msglen) {
+  struct HostTask *receiver = &tasks[current];
+
+  if (receiver->senders_head < 0) {
+    receiver->receive_tid = tid;
+    receiver->receive_msg = msg;
+    receiver->receive_msglen = msglen;
+    receiver->status = HOST_TASK_RECEIVE_BLOCKED;
+    return reschedule(-1);
+  }
+
+  struct HostTask *sender = &tasks[receiver->senders_head];
+  receiver->senders_head = sender->next_sender;
+  if (receiver->senders_head < 0) {
+    receiver->senders_tail = -1;
+  }
+
+  sender->status = HOST_TASK_REPLY_BLOCKED;
+  *tid = sender->tid;
+  return reschedule(copy(msg, msglen, sender->msg, sender->msglen));
+}
+
+int Reply(int tid, const char *reply, int rplen) {
+  if (tid < 0 || tid >= TASKS_MAX || tasks[tid].status == HOST_TASK_FREE) {
+    return reschedule(-1);
+  }
+
+  struct HostTask *sender = &tasks[tid];
+  if (sender->status != HOST_TASK_REPLY_BLOCKED) {
+    return reschedule(-2);
+  }
+
+  int len = copy(sender->reply, sender->rplen, reply, rplen);
+  sender->ret = len;
+  schedule(tid);
+  return reschedule(len);
+}
+
+int AwaitEvent(int eventid) {
+  if (eventid < 0 || eventid >= HOST_EVENTS_MAX) {
+    return reschedule(-1);
+  }
+
+  if (missed[eventid]) {
+    missed[eventid] = false;
+    return reschedule(0);
+  }
+
+  tasks[current].status = HOST_TASK_EVENT_BLOCKED;
+  tasks[current].receiver = eventid;
+  queue_push(&event_waiters[eventid], current);
+  return reschedule(0);
+}
+
+void host_kernel_raise(int event) {
+  if (event_waiters[event].head < 0) {
+    missed[event] = true;
+    return;
+  }
+
+  int tid;
+  while ((tid = queue_pop(&event_waiters[event])) >= 0) {
+    tasks[tid].ret = 0;
+    schedule(tid);
+  }
+}
+
+bool host_kernel_awaited(int event) {
+  return event_waiters[event].head >= 0;
+}
+
+void host_kernel_add_device(struct HostDevice *device) {
+  device->link = devices;
+  devices = device;
+}
+
+uint64_t host_kernel_time() {
+  return now;
+}
+
+uint64_t host_kernel_switches() {
+  return switches;
+}
+
+void host_kernel_stop() {
+  stopping = true;
+}
+
+void host_kernel_dump() {
+  static const char *status_names[] = {
+      "free", "ready", "active", "send blocked on", "receive blocked", "reply blocked on",
+      "awaiting event"
+  };
+
+  for (int tid = 0; tid < TASKS_MAX; ++tid) {
+    struct HostTask *task = &tasks[tid];
+    if (task->status == HOST_TASK_FREE) {
+      continue;
+    }
+
+    fprintf(stderr, "task %2d priority %2d %s", tid, task->priority, status_names[task->status]);
+    switch (task->status) {
+      case HOST_TASK_SEND_BLOCKED:
+      case HOST_TASK_REPLY_BLOCKED:
+      case HOST_TASK_EVENT_BLOCKED:
+        fprintf(stderr, " %d", task->receiver);
+        break;
+      default:
+        break;
+    }
+    fprintf(stderr, "\n");
+  }
+}
+
+// moves the clock to the next device event and runs it. returns 1 if it ran one, 0 if the next
+// one is after until and -1 if there is none at all.
+static int advance(uint64_t until) {
+  struct HostDevice *next = NULL;
+  uint64_t next_time = HOST_TIME_NEVER;
+
+  for (struct HostDevice *device = devices; device != NULL; device = device->link) {
+    uint64_t time = device->next(now);
+    if (time < next_time) {
+      next = device;
+      next_time = time;
+    }
+  }
+
+  if (next == NULL) {
+    return -1;
+  }
+
+  if (next_time > until) {
+    now = until;
+    return 0;
+  }
+
+  if (next_time > now) {
+    now = next_time;
+  }
+
+  next->run(now);
+  return 1;
+}
+
+int host_kernel_run(void (*init)(), int priority, uint64_t until) {
+  for (int i = 0; i < TASKS_MAX; ++i) {
+    tasks[i].status = HOST_TASK_FREE;
+  }
+  for (int i = 0; i < PRIORITIES; ++i) {
+    queue_init(&ready[i]);
+  }
+  for (int i = 0; i < HOST_EVENTS_MAX; ++i) {
+    queue_init(&event_waiters[i]);
+  }
+
+  Create(priority, init);
+
+  while (!stopping) {
+    int priority = highest_ready_priority();
+    if (priority < 0) {
+      int ret = advance(until);
+      if (ret <= 0) {
+        return ret;
+      }
+      continue;
+    }
+
+    current = queue_pop(&ready[priority]);
+    tasks[current].status = HOST_TASK_ACTIVE;
+    ++switches;
+    swapcontext(&scheduler, &tasks[current].context);
+
+    free(dead_stack);
+    dead_stack = NULL;
+  }
+
+  return 0;
+}
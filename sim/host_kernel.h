@@ -0,0 +1,53 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// the kernel's syscalls (syscall.h) run on the development machine. every task is a coroutine
+// and they are scheduled by priority exactly like the real kernel, but code takes no time to
+// run: the simulated clock only moves when every task is blocked, straight to the next device
+// event. the timer is one of the devices. a run is deterministic for the same inputs.
+
+// a simulated peripheral. the kernel asks it for its next event whenever no task can run
+struct HostDevice {
+  // simulated time of the next thing the device will do, HOST_TIME_NEVER for nothing
+  uint64_t (*next)(uint64_t now);
+  // does it, the device raises its events with host_kernel_raise
+  void (*run)(uint64_t now);
+  struct HostDevice *link;
+};
+
+#define HOST_TIME_NEVER UINT64_MAX
+// events are small integers, enum Event in irq.h
+#define HOST_EVENTS_MAX 32
+
+void host_kernel_add_device(struct HostDevice *device);
+
+// the interrupt for event. wakes every task waiting for it, or is remembered for the next
+// AwaitEvent when no task is, like the kernel's missed interrupts.
+void host_kernel_raise(int event);
+
+// true when a task is blocked in AwaitEvent(event)
+bool host_kernel_awaited(int event);
+
+// simulated microseconds since the run started
+uint64_t host_kernel_time();
+
+// context switches so far, a rough measure of the work done
+uint64_t host_kernel_switches();
+
+// ends the run once the calling task blocks
+void host_kernel_stop();
+
+// prints what every task is blocked on to stderr, for runs that stall
+void host_kernel_dump();
+
+/**
+ * creates init at priority and runs until host_kernel_stop, until simulated time reaches until,
+ * or until every task is blocked with nothing left to wake them.
+ *
+ * Return Value
+ * 0	stopped or ran out of time.
+ * -1	every task is blocked for good.
+ */
+int host_kernel_run(void (*init)(), int priority, uint64_t until);
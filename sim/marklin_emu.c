@@ -0,0 +1,302 @@
+// stands in for the marklin box on the other end of a serial line. the controller's bytes are
+// read from a pty or a tcp connection, paced at 2400 baud, and the sensors are driven by trains
+// running over the selected track.
+//
+//   marklin_emu [-b] [-l port] [-s] [-v] [train:node ...]
+//
+//   -b       track b instead of track a
+//   -l port  listen on 127.0.0.1:port instead of opening a pty
+//   -s       strict cts, drop bytes that arrive while the box is still busy
+//   -v       log every command and sensor hit
+//
+// each train:node puts a train on the track with its front at node, e.g. 54:A1.
+
+#define _DEFAULT_SOURCE
+#define _XOPEN_SOURCE 600
+
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "marklin_model.h"
+
+// 2400 baud with 8 data bits, a start bit and two stop bits
+static const uint64_t BYTE_TIME = 11 * 1000000 / 2400;
+// how often trains are moved while nothing else is happening, in microseconds
+static const uint64_t MODEL_STEP = 1000;
+
+#define INBOX_MAX 4096
+
+struct Emulator {
+  struct MarklinModel model;
+  bool strict;
+  bool verbose;
+
+  // bytes from the controller that the box has not taken yet
+  unsigned char inbox[INBOX_MAX];
+  size_t inbox_len;
+  // the box is working on the last byte until then, cts is low
+  uint64_t busy_until;
+
+  unsigned char reply[MARKLIN_MODEL_REPLY_MAX];
+  size_t reply_len;
+  size_t reply_sent;
+  uint64_t next_reply_byte;
+
+  // bytes the controller sent while cts was low
+  unsigned int early_bytes;
+  unsigned int dropped_bytes;
+  unsigned int bytes_in;
+  unsigned int bytes_out;
+};
+
+static volatile sig_atomic_t stop = 0;
+
+static void handle_signal(int sig) {
+  (void) sig;
+  stop = 1;
+}
+
+static uint64_t now_us() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static int open_pty() {
+  int fd = posix_openpt(O_RDWR | O_NOCTTY);
+  if (fd < 0 || grantpt(fd) < 0 || unlockpt(fd) < 0) {
+    perror("pty");
+    exit(1);
+  }
+
+  // raw bytes both ways, the controller's commands are binary
+  struct termios tio;
+  tcgetattr(fd, &tio);
+  cfmakeraw(&tio);
+  tcsetattr(fd, TCSANOW, &tio);
+
+  fprintf(stderr, "marklin on %s\n", ptsname(fd));
+  return fd;
+}
+
+static int open_listener(int port) {
+  int sock = socket(AF_INET, SOCK_STREAM, 0);
+  int one = 1;
+  setsockopt(sock, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+
+  struct sockaddr_in addr = {0};
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(port);
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+  if (bind(sock, (struct sockaddr *) &addr, sizeof(addr)) < 0 || listen(sock, 1) < 0) {
+    perror("listen");
+    exit(1);
+  }
+
+  fprintf(stderr, "marklin waiting on 127.0.0.1:%d\n", port);
+  int fd = accept(sock, NULL, NULL);
+  close(sock);
+  if (fd < 0) {
+    perror("accept");
+    exit(1);
+  }
+
+  return fd;
+}
+
+// moves the trains and logs the nodes they reached
+static void advance(struct Emulator *emu, uint64_t elapsed) {
+  const struct TrackNode *before[MARKLIN_MODEL_TRAINS_MAX];
+  for (int i = 0; i < emu->model.trains_len; ++i) {
+    before[i] = emu->model.trains[i].node;
+  }
+
+  marklin_model_advance(&emu->model, elapsed);
+
+  for (int i = 0; emu->verbose && i < emu->model.trains_len; ++i) {
+    struct MarklinTrain *t = &emu->model.trains[i];
+    if (t->node != before[i]) {
+      fprintf(stderr, "%8.3f train %d at %s\n", emu->model.time / 1e6, t->number, t->node->name);
+    }
+  }
+}
+
+// hands the box the next byte from the controller once it is ready for it
+static void take_byte(struct Emulator *emu, uint64_t now) {
+  if (emu->inbox_len == 0 || now < emu->busy_until || emu->reply_sent < emu->reply_len) {
+    return;
+  }
+
+  unsigned char ch = emu->inbox[0];
+  memmove(emu->inbox, emu->inbox + 1, --emu->inbox_len);
+
+  if (emu->verbose) {
+    fprintf(stderr, "%8.3f cmd 0x%02x\n", emu->model.time / 1e6, ch);
+  }
+
+  emu->reply_len = marklin_model_feed(&emu->model, ch, emu->reply);
+  emu->reply_sent = 0;
+  emu->next_reply_byte = now + BYTE_TIME;
+  emu->busy_until = now + BYTE_TIME;
+}
+
+static void receive(struct Emulator *emu, int fd, uint64_t now) {
+  unsigned char buf[256];
+  ssize_t len = read(fd, buf, sizeof(buf));
+  if (len <= 0) {
+    stop = 1;
+    return;
+  }
+
+  for (ssize_t i = 0; i < len; ++i) {
+    ++emu->bytes_in;
+
+    // with working flow control nothing is sent while the box is busy or still has a byte queued
+    bool early = now < emu->busy_until || emu->inbox_len > 0 || emu->reply_sent < emu->reply_len;
+    if (early) {
+      ++emu->early_bytes;
+    }
+
+    if ((early && emu->strict) || emu->inbox_len == INBOX_MAX) {
+      ++emu->dropped_bytes;
+      continue;
+    }
+
+    emu->inbox[emu->inbox_len++] = buf[i];
+  }
+}
+
+static void send_reply(struct Emulator *emu, int fd, uint64_t now) {
+  while (emu->reply_sent < emu->reply_len && now >= emu->next_reply_byte) {
+    if (write(fd, &emu->reply[emu->reply_sent], 1) != 1) {
+      stop = 1;
+      return;
+    }
+
+    ++emu->reply_sent;
+    ++emu->bytes_out;
+    emu->next_reply_byte += BYTE_TIME;
+    // cts stays low until the whole reply is out
+    emu->busy_until = emu->next_reply_byte;
+  }
+}
+
+static void print_stats(struct Emulator *emu, uint64_t elapsed) {
+  struct MarklinModelStats *stats = &emu->model.stats;
+  double seconds = elapsed / 1e6;
+
+  fprintf(stderr, "ran %.1fs\n", seconds);
+  fprintf(
+      stderr,
+      "bytes in %u (%.1f/s), out %u, early %u, dropped %u\n",
+      emu->bytes_in,
+      emu->bytes_in / seconds,
+      emu->bytes_out,
+      emu->early_bytes,
+      emu->dropped_bytes
+  );
+  fprintf(
+      stderr,
+      "speed %u, reverse %u, switch %u, solenoid off %u, dumps %u, module dumps %u, unknown %u\n",
+      stats->speed_commands,
+      stats->reverse_commands,
+      stats->switch_commands,
+      stats->solenoid_off_commands,
+      stats->dumps,
+      stats->module_dumps,
+      stats->unknown_bytes
+  );
+  fprintf(
+      stderr,
+      "sensor hits %u, reported %u, report latency mean %.1fms max %.1fms\n",
+      stats->sensor_hits,
+      stats->reports,
+      stats->reports > 0 ? stats->report_latency_total / 1e3 / stats->reports : 0.0,
+      stats->report_latency_max / 1e3
+  );
+}
+
+int main(int argc, char **argv) {
+  static struct Emulator emu;
+  char track = 'A';
+  int port = 0;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "bl:sv")) != -1) {
+    switch (opt) {
+      case 'b':
+        track = 'B';
+        break;
+      case 'l':
+        port = atoi(optarg);
+        break;
+      case 's':
+        emu.strict = true;
+        break;
+      case 'v':
+        emu.verbose = true;
+        break;
+      default:
+        fprintf(stderr, "usage: %s [-b] [-l port] [-s] [-v] [train:node ...]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  marklin_model_init(&emu.model, track);
+
+  for (int i = optind; i < argc; ++i) {
+    char *sep = strchr(argv[i], ':');
+    if (sep == NULL || marklin_model_place_train(&emu.model, atoi(argv[i]), sep + 1) < 0) {
+      fprintf(stderr, "cannot place %s\n", argv[i]);
+      return 1;
+    }
+  }
+
+  signal(SIGINT, handle_signal);
+  signal(SIGTERM, handle_signal);
+
+  int fd = port > 0 ? open_listener(port) : open_pty();
+
+  uint64_t start = now_us();
+  uint64_t last = start;
+
+  while (!stop) {
+    uint64_t now = now_us();
+
+    advance(&emu, now - last);
+    last = now;
+
+    send_reply(&emu, fd, now);
+    take_byte(&emu, now);
+
+    // sleep until the next byte is due or the trains need moving
+    uint64_t wake = now + MODEL_STEP;
+    if (emu.reply_sent < emu.reply_len && emu.next_reply_byte < wake) {
+      wake = emu.next_reply_byte;
+    }
+    if (emu.inbox_len > 0 && emu.busy_until < wake) {
+      wake = emu.busy_until;
+    }
+
+    struct pollfd pfd = {.fd = fd, .events = POLLIN};
+    int timeout = wake > now ? (int) ((wake - now + 999) / 1000) : 0;
+    if (poll(&pfd, 1, timeout) > 0 && (pfd.revents & POLLIN)) {
+      receive(&emu, fd, now_us());
+    }
+  }
+
+  print_stats(&emu, now_us() - start);
+  close(fd);
+  return 0;
+}
@@ -0,0 +1,332 @@
+#include "marklin_model.h"
+
+#include <string.h>
+
+static const unsigned char CMD_SPEED_MAX = 31;
+static const unsigned char CMD_REVERSE = 15;
+static const unsigned char CMD_OFF_LAST_SOLENOID = 0x20;
+static const unsigned char CMD_SWITCH_STRAIGHT = 0x21;
+static const unsigned char CMD_SWITCH_CURVED = 0x22;
+static const unsigned char CMD_READ_SENSORS = 0x80;
+static const unsigned char CMD_SENSOR_RESET_MODE = 0xC0;
+
+// speed levels and the function bit, speed + 16 turns the lights on
+static const int SPEED_LEVELS = 16;
+
+// trains move this far in time between looking for sensors
+static const uint64_t STEP = 1000;
+
+// roughly what the calibrated trains do on a level run, for trains that were not measured
+static const struct MarklinTrainDynamics DEFAULT_DYNAMICS = {
+    .speeds = {0, 20, 75, 127, 174, 231, 285, 335, 385, 432, 483, 537, 585, 599, 620},
+    .stopping_distances = {0, 20, 80, 160, 250, 320, 400, 452, 558, 635, 705, 780, 860, 940, 980},
+    // the calibration's default of 3s
+    .accel_times = {3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000, 3000,
+                    3000, 3000}
+};
+
+void marklin_model_init(struct MarklinModel *model, char track) {
+  memset(model, 0, sizeof(*model));
+
+  if (track == 'B') {
+    trackb_init(model->track);
+  } else {
+    tracka_init(model->track);
+  }
+
+  memset(model->switches, '?', sizeof(model->switches));
+  model->pending = -1;
+  model->random = 1;
+}
+
+void marklin_model_set_noise(struct MarklinModel *model, const struct MarklinModelNoise *noise) {
+  model->noise = *noise;
+  // xorshift never leaves 0
+  model->random = noise->seed != 0 ? noise->seed : 1;
+}
+
+// uniform in [0, n), runs are repeatable for the same seed
+static int random_below(struct MarklinModel *model, int n) {
+  uint32_t x = model->random;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  model->random = x;
+  return n > 0 ? (int) (x % n) : 0;
+}
+
+// the edge a train takes out of node, NULL at an exit
+static const struct TrackEdge *next_edge(struct MarklinModel *model, const struct TrackNode *node) {
+  switch (node->type) {
+    case NODE_EXIT:
+      return NULL;
+    case NODE_BRANCH:
+      // a switch that was never thrown is taken straight, like an unpowered turnout
+      return &node->edge[model->switches[node->num] == 'C' ? DIR_CURVED : DIR_STRAIGHT];
+    default:
+      return &node->edge[DIR_AHEAD];
+  }
+}
+
+// not strcmp, train_host links util.c whose strcmp returns whether the strings are equal
+static bool same_name(const char *a, const char *b) {
+  while (*a != '\0' && *a == *b) {
+    ++a;
+    ++b;
+  }
+
+  return *a == *b;
+}
+
+int marklin_model_place_train(struct MarklinModel *model, int train, const char *name) {
+  if (model->trains_len == MARKLIN_MODEL_TRAINS_MAX) {
+    return -2;
+  }
+
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    const struct TrackNode *node = &model->track[i];
+    if (node->name == NULL || !same_name(node->name, name)) {
+      continue;
+    }
+
+    struct MarklinTrain *t = &model->trains[model->trains_len++];
+    memset(t, 0, sizeof(*t));
+    t->number = train;
+    t->dynamics = DEFAULT_DYNAMICS;
+    t->node = node;
+    t->edge = next_edge(model, node);
+    t->stuck = t->edge == NULL;
+    return 0;
+  }
+
+  return -1;
+}
+
+struct MarklinTrain *marklin_model_find_train(struct MarklinModel *model, int train) {
+  for (int i = 0; i < model->trains_len; ++i) {
+    if (model->trains[i].number == train) {
+      return &model->trains[i];
+    }
+  }
+
+  return NULL;
+}
+
+static void latch_sensor(struct MarklinModel *model, int sensor) {
+  unsigned char bit = 1 << (7 - sensor % 8);
+
+  // a contact that is still latched keeps the time it first closed
+  if (!(model->latched[sensor / 8] & bit)) {
+    model->latched_at[sensor] = model->time;
+  }
+
+  model->latched[sensor / 8] |= bit;
+  ++model->stats.sensor_hits;
+}
+
+// a train reached the contact, it closes now, a little later or not at all
+static void hit_sensor(struct MarklinModel *model, int sensor) {
+  struct MarklinModelNoise *noise = &model->noise;
+
+  if (noise->missed_percent > 0 && random_below(model, 100) < noise->missed_percent) {
+    ++model->stats.missed_sensors;
+    return;
+  }
+
+  int delay = random_below(model, noise->sensor_delay_max + 1);
+  if (delay == 0) {
+    latch_sensor(model, sensor);
+  } else if (model->delayed_until[sensor] == 0) {
+    model->delayed_until[sensor] = model->time + delay;
+    ++model->delayed_len;
+  }
+}
+
+static void latch_delayed_sensors(struct MarklinModel *model) {
+  for (int sensor = 0; sensor < MARKLIN_MODEL_SENSORS && model->delayed_len > 0; ++sensor) {
+    uint64_t until = model->delayed_until[sensor];
+    if (until != 0 && until <= model->time) {
+      model->delayed_until[sensor] = 0;
+      --model->delayed_len;
+      latch_sensor(model, sensor);
+    }
+  }
+}
+
+static void set_speed(struct MarklinModel *model, struct MarklinTrain *t, int speed) {
+  struct MarklinTrainDynamics *dynamics = &t->dynamics;
+  int64_t target = (int64_t) dynamics->speeds[speed] * 1000;
+
+  int spread = model->noise.speed_percent;
+  if (spread > 0 && target > 0) {
+    target += target * (random_below(model, 2 * spread + 1) - spread) / 100;
+  }
+
+  if (target > t->velocity) {
+    // the decoder ramps up to the new speed in about the time it takes from a stand
+    int64_t accel_time = dynamics->accel_times[speed] > 0 ? dynamics->accel_times[speed] : 1;
+    t->rate = target * 1000 / accel_time;
+  } else {
+    // brakes hard enough to stop from the current speed in its stopping distance
+    int64_t stopping_distance = (int64_t) dynamics->stopping_distances[t->speed] * 1000;
+    t->rate = stopping_distance > 0 ? t->velocity * t->velocity / (2 * stopping_distance)
+                                    : t->velocity;
+  }
+
+  t->speed = speed;
+  t->target = target;
+}
+
+static void reverse_train(struct MarklinModel *model, struct MarklinTrain *t) {
+  if (t->edge == NULL) {
+    // turning around at an exit, it leaves through the matching entry
+    t->node = t->node->reverse;
+    t->edge = next_edge(model, t->node);
+    t->offset = 0;
+  } else {
+    // the same spot seen from the other end of the edge
+    t->offset = (int64_t) t->edge->dist * 1000 - t->offset;
+    t->node = t->edge->dest->reverse;
+    t->edge = t->edge->reverse;
+  }
+
+  t->stuck = t->edge == NULL;
+
+  // the decoder stops the motor to turn it around, then ramps back up
+  t->velocity = 0;
+  set_speed(model, t, t->speed);
+}
+
+// copies module (1 to 5) into reply and clears it in reset mode
+static void dump_module(struct MarklinModel *model, int module, unsigned char *reply) {
+  int index = (module - 1) * 2;
+  reply[0] = model->latched[index];
+  reply[1] = model->latched[index + 1];
+
+  for (int sensor = index * 8; sensor < (index + 2) * 8; ++sensor) {
+    if (model->latched[sensor / 8] & (1 << (7 - sensor % 8))) {
+      uint64_t latency = model->time - model->latched_at[sensor];
+      model->stats.report_latency_total += latency;
+      if (latency > model->stats.report_latency_max) {
+        model->stats.report_latency_max = latency;
+      }
+      ++model->stats.reports;
+    }
+  }
+
+  if (model->reset_mode) {
+    model->latched[index] = 0;
+    model->latched[index + 1] = 0;
+  }
+}
+
+static void run_command(struct MarklinModel *model, unsigned char cmd, unsigned char target) {
+  if (cmd == CMD_SWITCH_STRAIGHT || cmd == CMD_SWITCH_CURVED) {
+    model->switches[target] = cmd == CMD_SWITCH_CURVED ? 'C' : 'S';
+    model->solenoid_on = true;
+    ++model->stats.switch_commands;
+    return;
+  }
+
+  struct MarklinTrain *t = marklin_model_find_train(model, target);
+  int speed = cmd % SPEED_LEVELS;
+
+  if (speed == CMD_REVERSE) {
+    ++model->stats.reverse_commands;
+    if (t != NULL) {
+      reverse_train(model, t);
+    }
+  } else {
+    ++model->stats.speed_commands;
+    if (t != NULL) {
+      set_speed(model, t, speed);
+    }
+  }
+}
+
+size_t marklin_model_feed(struct MarklinModel *model, unsigned char ch, unsigned char *reply) {
+  if (model->pending >= 0) {
+    run_command(model, model->pending, ch);
+    model->pending = -1;
+    return 0;
+  }
+
+  if (ch <= CMD_SPEED_MAX) {
+    model->pending = ch;
+  } else if (ch == CMD_SWITCH_STRAIGHT || ch == CMD_SWITCH_CURVED) {
+    model->pending = ch;
+  } else if (ch == CMD_OFF_LAST_SOLENOID) {
+    model->solenoid_on = false;
+    ++model->stats.solenoid_off_commands;
+  } else if (ch == CMD_SENSOR_RESET_MODE) {
+    model->reset_mode = true;
+  } else if (ch > CMD_READ_SENSORS && ch <= CMD_READ_SENSORS + MARKLIN_MODEL_MODULES) {
+    // modules 1 to n, one after the other
+    int modules = ch - CMD_READ_SENSORS;
+    for (int module = 1; module <= modules; ++module) {
+      dump_module(model, module, reply + (module - 1) * 2);
+    }
+
+    ++model->stats.dumps;
+    return modules * 2;
+  } else if (ch > CMD_SENSOR_RESET_MODE && ch <= CMD_SENSOR_RESET_MODE + MARKLIN_MODEL_MODULES) {
+    dump_module(model, ch - CMD_SENSOR_RESET_MODE, reply);
+    ++model->stats.module_dumps;
+    return 2;
+  } else {
+    ++model->stats.unknown_bytes;
+  }
+
+  return 0;
+}
+
+static void advance_train(struct MarklinModel *model, struct MarklinTrain *t, uint64_t elapsed) {
+  if (t->stuck) {
+    t->velocity = 0;
+    return;
+  }
+
+  int64_t start_velocity = t->velocity;
+  if (t->velocity < t->target) {
+    t->velocity += t->rate * (int64_t) elapsed / 1000000 + 1;
+    t->velocity = t->velocity < t->target ? t->velocity : t->target;
+  } else if (t->velocity > t->target) {
+    t->velocity -= t->rate * (int64_t) elapsed / 1000000 + 1;
+    t->velocity = t->velocity > t->target ? t->velocity : t->target;
+  }
+
+  // um/s times microseconds, over a million, is micrometres
+  t->offset += (start_velocity + t->velocity) / 2 * (int64_t) elapsed / 1000000;
+
+  while (t->offset >= (int64_t) t->edge->dist * 1000) {
+    t->offset -= (int64_t) t->edge->dist * 1000;
+    t->node = t->edge->dest;
+
+    if (t->node->type == NODE_SENSOR) {
+      hit_sensor(model, t->node->num);
+    }
+
+    t->edge = next_edge(model, t->node);
+    if (t->edge == NULL) {
+      // the end of the line, the train sits against the bumper
+      t->offset = 0;
+      t->stuck = true;
+      t->velocity = 0;
+      return;
+    }
+  }
+}
+
+void marklin_model_advance(struct MarklinModel *model, uint64_t elapsed) {
+  while (elapsed > 0) {
+    uint64_t step = elapsed < STEP ? elapsed : STEP;
+    elapsed -= step;
+    model->time += step;
+
+    for (int i = 0; i < model->trains_len; ++i) {
+      advance_train(model, &model->trains[i], step);
+    }
+
+    latch_delayed_sensors(model);
+  }
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "user/train/trackdata/track_data.h"
+
+#define MARKLIN_MODEL_TRAINS_MAX 8
+#define MARKLIN_MODEL_SWITCHES_MAX 256
+#define MARKLIN_MODEL_MODULES 5
+// the longest reply, a dump of every module
+#define MARKLIN_MODEL_REPLY_MAX (MARKLIN_MODEL_MODULES * 2)
+#define MARKLIN_MODEL_SENSORS (MARKLIN_MODEL_MODULES * 16)
+#define MARKLIN_MODEL_SPEEDS 15
+
+// how a locomotive answers speed commands, indexed by speed level
+struct MarklinTrainDynamics {
+  // steady speed in mm/s
+  int speeds[MARKLIN_MODEL_SPEEDS];
+  // distance it takes to stop from each speed, in mm
+  int stopping_distances[MARKLIN_MODEL_SPEEDS];
+  // time it takes to get up to each speed from a stand, in ms
+  int accel_times[MARKLIN_MODEL_SPEEDS];
+};
+
+// one locomotive, its front is offset millimetres past node along edge
+struct MarklinTrain {
+  int number;
+  // 0 to 14, as last commanded
+  int speed;
+  const struct TrackNode *node;
+  const struct TrackEdge *edge;
+  // in micrometres so slow trains still move between steps
+  int64_t offset;
+  // ran off an exit, the train stays there until it is reversed
+  bool stuck;
+
+  // set to the model's defaults when the train is placed, callers can overwrite it
+  struct MarklinTrainDynamics dynamics;
+  // in um/s, the train speeds up or slows down towards target at rate um/s^2
+  int64_t velocity;
+  int64_t target;
+  int64_t rate;
+};
+
+// what makes a real track less predictable than the tables, all off when zeroed
+struct MarklinModelNoise {
+  // each speed command settles within this many percent of the calibrated speed
+  int speed_percent;
+  // a contact closes up to this many microseconds after the train reaches it
+  int sensor_delay_max;
+  // percent of the contacts a train passes over that never close
+  int missed_percent;
+  uint32_t seed;
+};
+
+struct MarklinModelStats {
+  unsigned int speed_commands;
+  unsigned int reverse_commands;
+  unsigned int switch_commands;
+  unsigned int solenoid_off_commands;
+  unsigned int dumps;
+  unsigned int module_dumps;
+  unsigned int sensor_hits;
+  unsigned int missed_sensors;
+  // latched sensors handed out in a dump, and how long after the contact closed in microseconds.
+  // a sensor that stays latched is counted again in every dump until it is cleared.
+  unsigned int reports;
+  uint64_t report_latency_total;
+  uint64_t report_latency_max;
+  // bytes that did not start or complete any known command
+  unsigned int unknown_bytes;
+};
+
+// the marklin box and the track behind it. fed one byte at a time, the same way the uart sees it
+struct MarklinModel {
+  struct TrackNode track[TRACK_MAX];
+  // 'S', 'C' or '?' for switches that have not been thrown
+  char switches[MARKLIN_MODEL_SWITCHES_MAX];
+  bool solenoid_on;
+
+  struct MarklinTrain trains[MARKLIN_MODEL_TRAINS_MAX];
+  int trains_len;
+
+  // contacts that closed since the module was last read, one bit per sensor in dump order
+  unsigned char latched[MARKLIN_MODEL_MODULES * 2];
+  uint64_t latched_at[MARKLIN_MODEL_SENSORS];
+  // contacts that will close once time reaches delayed_until, 0 for none
+  uint64_t delayed_until[MARKLIN_MODEL_SENSORS];
+  int delayed_len;
+  // in reset mode a read clears what it reported
+  bool reset_mode;
+
+  // first byte of a two byte command that is waiting for its second byte, -1 for none
+  int pending;
+
+  struct MarklinModelNoise noise;
+  uint32_t random;
+
+  // microseconds the model has been advanced by
+  uint64_t time;
+  struct MarklinModelStats stats;
+};
+
+// track is 'A' or 'B'
+void marklin_model_init(struct MarklinModel *model, char track);
+
+void marklin_model_set_noise(struct MarklinModel *model, const struct MarklinModelNoise *noise);
+
+/**
+ * puts train on the track with its front at the sensor or node called name, facing the way the
+ * node points.
+ *
+ * Return Value
+ * 0	success.
+ * -1	there is no node called name.
+ * -2	there is no room for another train.
+ */
+int marklin_model_place_train(struct MarklinModel *model, int train, const char *name);
+
+/**
+ * feeds one byte from the controller. when it completes a command that is answered, the reply is
+ * written to reply.
+ *
+ * Return Value
+ * >=0	number of reply bytes, at most MARKLIN_MODEL_REPLY_MAX.
+ */
+size_t marklin_model_feed(struct MarklinModel *model, unsigned char ch, unsigned char *reply);
+
+// moves every train on by elapsed microseconds, a millisecond at a time, speeding up or slowing
+// down with momentum, and latches the sensors they pass
+void marklin_model_advance(struct MarklinModel *model, uint64_t elapsed);
+
+struct MarklinTrain *marklin_model_find_train(struct MarklinModel *model, int train);
@@ -0,0 +1,195 @@
+// runs spsc_ring.c with a producer and a consumer thread on the development machine. the producer
+// writes a stream of 64-bit sequence numbers in chunks of random size, the consumer reads it back
+// in chunks of random size and checks every byte, so a lost, repeated or reordered byte shows up
+// as the stream going out of sequence. each side switches between the copying calls and the
+// in-place claim/publish and peek/release ones. prints the throughput and exits with 1 on an
+// error.
+//
+//   spsc_stress [-n items] [-r seed]
+//
+//   -n items  64-bit sequence numbers to pass through the ring, 16M by default
+//   -r seed   seed for the chunk sizes
+
+#define _DEFAULT_SOURCE
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "spsc_ring.h"
+
+struct Side {
+  struct SpscRing *ring;
+  uint64_t bytes;
+  uint64_t seed;
+  // consumer only, bytes that were not what the producer wrote at that position
+  uint64_t errors;
+  uint64_t first_error;
+};
+
+static struct SpscRing ring;
+
+static uint64_t next_random(uint64_t *state) {
+  // xorshift64
+  *state ^= *state << 13;
+  *state ^= *state >> 7;
+  *state ^= *state << 17;
+  return *state;
+}
+
+// byte pos of the stream of little endian sequence numbers 0, 1, 2, ...
+static unsigned char stream_byte(uint64_t pos) {
+  return (pos / sizeof(uint64_t)) >> (8 * (pos % sizeof(uint64_t)));
+}
+
+static void *producer(void *arg) {
+  struct Side *side = arg;
+  unsigned char chunk[SPSC_RING_CAPACITY];
+
+  for (uint64_t pos = 0; pos < side->bytes;) {
+    uint64_t random = next_random(&side->seed);
+    size_t len = random % SPSC_RING_CAPACITY + 1;
+    if (len > side->bytes - pos) {
+      len = side->bytes - pos;
+    }
+
+    size_t written;
+    if (random & (1 << 16)) {
+      for (size_t i = 0; i < len; ++i) {
+        chunk[i] = stream_byte(pos + i);
+      }
+
+      written = spsc_ring_write(side->ring, chunk, len);
+    } else {
+      unsigned char *data = spsc_ring_claim(side->ring, &written);
+      if (written > len) {
+        written = len;
+      }
+
+      for (size_t i = 0; i < written; ++i) {
+        data[i] = stream_byte(pos + i);
+      }
+
+      spsc_ring_publish(side->ring, written);
+    }
+
+    pos += written;
+    if (written == 0) {
+      // full, let the consumer run when there are fewer cores than threads
+      sched_yield();
+    }
+  }
+
+  return NULL;
+}
+
+static void check(struct Side *side, const unsigned char *data, size_t len, uint64_t pos) {
+  for (size_t i = 0; i < len; ++i) {
+    if (data[i] != stream_byte(pos + i)) {
+      if (side->errors == 0) {
+        side->first_error = pos + i;
+      }
+
+      ++side->errors;
+    }
+  }
+}
+
+static void *consumer(void *arg) {
+  struct Side *side = arg;
+  unsigned char chunk[SPSC_RING_CAPACITY];
+
+  for (uint64_t pos = 0; pos < side->bytes;) {
+    uint64_t random = next_random(&side->seed);
+    size_t len = random % SPSC_RING_CAPACITY + 1;
+
+    size_t read;
+    if (random & (1 << 16)) {
+      read = spsc_ring_read(side->ring, chunk, len);
+      check(side, chunk, read, pos);
+    } else {
+      const unsigned char *data = spsc_ring_peek(side->ring, &read);
+      if (read > len) {
+        read = len;
+      }
+
+      check(side, data, read, pos);
+      spsc_ring_release(side->ring, read);
+    }
+
+    pos += read;
+    if (read == 0) {
+      sched_yield();
+    }
+  }
+
+  return NULL;
+}
+
+static uint64_t now_ns() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+int main(int argc, char *argv[]) {
+  uint64_t items = 16 << 20;
+  uint64_t seed = 1;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "n:r:")) != -1) {
+    switch (opt) {
+      case 'n':
+        items = atoi(optarg);
+        break;
+      case 'r':
+        seed = atoi(optarg);
+        break;
+      default:
+        fprintf(stderr, "usage: %s [-n items] [-r seed]\n", argv[0]);
+        return 1;
+    }
+  }
+
+  // xorshift never leaves 0
+  seed = seed != 0 ? seed : 1;
+
+  spsc_ring_init(&ring);
+
+  uint64_t bytes = items * sizeof(uint64_t);
+  struct Side produce = {.ring = &ring, .bytes = bytes, .seed = seed};
+  struct Side consume = {.ring = &ring, .bytes = bytes, .seed = seed * 31 + 7};
+
+  uint64_t start = now_ns();
+
+  pthread_t threads[2];
+  pthread_create(&threads[0], NULL, producer, &produce);
+  pthread_create(&threads[1], NULL, consumer, &consume);
+  pthread_join(threads[0], NULL);
+  pthread_join(threads[1], NULL);
+
+  double seconds = (double) (now_ns() - start) / 1000000000;
+
+  printf(
+      "spsc ring: %llu items (%llu MB) in %.2fs, %.1f MB/s, %ld cpus\n",
+      (unsigned long long) items,
+      (unsigned long long) (bytes >> 20),
+      seconds,
+      (double) bytes / (1 << 20) / seconds,
+      sysconf(_SC_NPROCESSORS_ONLN)
+  );
+
+  if (consume.errors > 0 || spsc_ring_size(&ring) != 0) {
+    printf(
+        "spsc ring: %llu bytes out of sequence, the first at byte %llu, %zu left in the ring\n",
+        (unsigned long long) consume.errors,
+        (unsigned long long) consume.first_error,
+        spsc_ring_size(&ring)
+    );
+    return 1;
+  }
+
+  return 0;
+}
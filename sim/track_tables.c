@@ -0,0 +1,209 @@
+// prints both tracks as const TrackGraph tables, the source of
+// user/train/trackdata/track_graph_data.c, or as const TrackNode arrays, the source of
+// user/train/trackdata/track_node_data.c. the Makefile runs it when track_data.c changes.
+//
+//   track_tables > user/train/trackdata/track_graph_data.c
+//   track_tables nodes > user/train/trackdata/track_node_data.c
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "user/train/trackdata/track_graph.h"
+
+// the generated file keeps to the same line length as the rest of the tree
+#define LINE_MAX 100
+#define INDENT "      "
+
+static struct TrackNode nodes[TRACK_MAX];
+static bool names_fit = true;
+static int column;
+
+static void begin_array(const char *field) {
+  printf("    .%s =\n" INDENT "{", field);
+  column = strlen(INDENT) + 1;
+}
+
+// prints an element of the array begin_array opened, wrapping the line before it and the comma
+// after it would get too long
+static void print_element(int i, const char *element) {
+  int len = strlen(element) + 2;
+  if (i > 0 && column + len + 1 > LINE_MAX) {
+    printf(",\n" INDENT "%s", element);
+    column = strlen(INDENT) + len - 2;
+  } else {
+    printf("%s%s", i > 0 ? ", " : "", element);
+    column += i > 0 ? len : len - 2;
+  }
+}
+
+static void end_array() {
+  printf("},\n");
+}
+
+static void format_index(char *buf, int index) {
+  if (index == TRACK_GRAPH_NONE) {
+    sprintf(buf, "TRACK_GRAPH_NONE");
+  } else {
+    sprintf(buf, "%d", index);
+  }
+}
+
+static int edge_dest(struct TrackNode *node, int dir) {
+  return node->edge[dir].dest ? node->edge[dir].dest->index : TRACK_GRAPH_NONE;
+}
+
+static void print_graph(const char *name, void (*init)(struct TrackNode *)) {
+  char element[64];
+  char ahead[24];
+  char curved[24];
+
+  init(nodes);
+
+  printf("const struct TrackGraph %s = {\n", name);
+
+  begin_array("dests");
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    format_index(ahead, edge_dest(&nodes[i], DIR_AHEAD));
+    format_index(curved, edge_dest(&nodes[i], DIR_CURVED));
+    sprintf(element, "{%s, %s}", ahead, curved);
+    print_element(i, element);
+  }
+  end_array();
+
+  begin_array("dists");
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    sprintf(element, "{%d, %d}", nodes[i].edge[DIR_AHEAD].dist, nodes[i].edge[DIR_CURVED].dist);
+    print_element(i, element);
+  }
+  end_array();
+
+  begin_array("reverses");
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    format_index(element, nodes[i].reverse ? nodes[i].reverse->index : TRACK_GRAPH_NONE);
+    print_element(i, element);
+  }
+  end_array();
+
+  begin_array("types");
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    sprintf(element, "%d", nodes[i].type);
+    print_element(i, element);
+  }
+  end_array();
+
+  begin_array("nums");
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    sprintf(element, "%d", nodes[i].num);
+    print_element(i, element);
+  }
+  end_array();
+
+  begin_array("zones");
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    sprintf(element, "%d", nodes[i].zone);
+    print_element(i, element);
+  }
+  end_array();
+
+  begin_array("names");
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    const char *node_name = nodes[i].name ? nodes[i].name : "";
+    if (strlen(node_name) >= TRACK_GRAPH_NAME_MAX) {
+      fprintf(stderr, "%s does not fit in TRACK_GRAPH_NAME_MAX\n", node_name);
+      names_fit = false;
+    }
+
+    sprintf(element, "\"%.*s\"", TRACK_GRAPH_NAME_MAX - 1, node_name);
+    print_element(i, element);
+  }
+  end_array();
+
+  printf("};\n");
+}
+
+static const char *const NODE_TYPES[] = {
+    "NODE_NONE", "NODE_SENSOR", "NODE_BRANCH", "NODE_MERGE", "NODE_ENTER", "NODE_EXIT"
+};
+
+static void format_node(char *buf, const char *name, const struct TrackNode *node) {
+  sprintf(buf, "&%s[%d]", name, node->index);
+}
+
+static void format_edge(char *buf, const char *name, const struct TrackEdge *edge) {
+  const struct TrackNode *node = edge->src;
+  sprintf(buf, "&%s[%d].edge[%d]", name, node->index, edge == &node->edge[DIR_AHEAD] ? 0 : 1);
+}
+
+static void print_edge(const char *name, struct TrackEdge *edge, bool last) {
+  char reverse[48];
+  char src[32];
+  char dest[32];
+
+  if (edge->dest == NULL) {
+    printf("{.index = %d}", edge->index);
+  } else {
+    format_edge(reverse, name, edge->reverse);
+    format_node(src, name, edge->src);
+    format_node(dest, name, edge->dest);
+    printf("{.reverse = %s, .src = %s,\n", reverse, src);
+    printf("           .dest = %s, .dist = %d, .index = %d}", dest, edge->dist, edge->index);
+  }
+
+  printf("%s", last ? "}},\n" : ",\n          ");
+}
+
+// the nodes as track_data.c fills them in, with their pointers into the array itself
+static void print_nodes(const char *name, void (*init)(struct TrackNode *)) {
+  char reverse[32];
+
+  init(nodes);
+
+  printf("const struct TrackNode %s[TRACK_MAX] = {\n", name);
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    struct TrackNode *node = &nodes[i];
+
+    printf("    {");
+    if (node->name) {
+      printf(".name = \"%s\", ", node->name);
+    }
+    printf(
+        ".type = %s, .num = %d, .index = %d, .zone = %d,\n",
+        NODE_TYPES[node->type],
+        node->num,
+        node->index,
+        node->zone
+    );
+
+    if (node->reverse) {
+      format_node(reverse, name, node->reverse);
+      printf("     .reverse = %s,\n", reverse);
+    }
+
+    printf("     .edge =\n         {");
+    print_edge(name, &node->edge[DIR_AHEAD], false);
+    print_edge(name, &node->edge[DIR_CURVED], true);
+  }
+  printf("};\n");
+}
+
+int main(int argc, char **argv) {
+  printf("/* THIS FILE IS GENERATED CODE -- DO NOT EDIT */\n");
+  printf("// generated by sim/track_tables.c from track_data.c\n\n");
+
+  if (argc > 1 && strcmp(argv[1], "nodes") == 0) {
+    printf("#include \"track_data.h\"\n\n");
+
+    print_nodes("TRACKA_NODES", tracka_init);
+    printf("\n");
+    print_nodes("TRACKB_NODES", trackb_init);
+    return 0;
+  }
+
+  printf("#include \"track_graph.h\"\n\n");
+
+  print_graph("TRACKA_GRAPH", tracka_init);
+  printf("\n");
+  print_graph("TRACKB_GRAPH", trackb_init);
+  return names_fit ? 0 : 1;
+}
@@ -0,0 +1,507 @@
+// runs the train controller's tasks on the development machine, on top of the host kernel and a
+// simulated board with the marklin model on the other end of the train line.
+//
+//   train_host [-b] [-c] [-d] [-s seconds] [-e seconds:command ...] [-p plans] [-a] [-z plans]
+//              [-w walks] [-n percent] [-j ms] [-m percent] [-r seed] [train:node ...]
+//
+//   -b                  track b instead of track a
+//   -c                  draw the console on stdout
+//   -s seconds          simulated time to run for, 60 by default
+//   -e seconds:command  type command on the console at that simulated time
+//   -p plans            after boot, time the planner on that many random routes and stop
+//   -a                  after boot, time the planner between every pair of nodes and stop
+//   -z plans            after boot, time plans around a zone taken on that many random routes
+//                       against searching again, and stop
+//   -w walks            after boot, time position updates along that many random routes and stop
+//   -d                  list what every task is blocked on at the end
+//   -n percent          trains settle within this many percent of their calibrated speed
+//   -j ms               sensors close up to this late
+//   -m percent          sensors a train passes over that never close
+//   -r seed             seed for the noise
+//
+// each train:node puts a train on the track with its front at node, e.g. 54:A5. trains move like
+// trainset_calib_data.c says they do. rd takes its trains to be leaving A5 and C3 on track A, so
+// facing A6 and C4. random routing with two trains is
+//
+//   train_host -s 3600 -e "1:rd 54 58" 54:A6 58:C4
+//
+// which ends with deliveries per hour, time spent waiting for reservations and position error.
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "host_board.h"
+#include "host_kernel.h"
+#include "irq.h"
+#include "marklin_model.h"
+#include "syscall.h"
+#include "timer.h"
+#include "user/server/clock_server.h"
+#include "user/server/io_server.h"
+#include "user/server/name_server.h"
+#include "user/terminal/terminal_task.h"
+#include "user/train/selected_track.h"
+#include "user/train/track_reservations.h"
+#include "user/train/sensor_publisher.h"
+#include "user/train/train_dispatcher.h"
+#include "user/train/train_manager.h"
+#include "user/train/train_planner.h"
+#include "user/train/train_sensor_notifier.h"
+#include "user/train/trainset.h"
+#include "user/train/trainset_calib_data.h"
+#include "user/train/trainset_task.h"
+#include "util.h"
+
+#define COMMANDS_MAX 64
+
+static const uint64_t SECOND = 1000000;
+// a walk stops where its position no longer moves on, past any edge on the track
+static const int WALK_STEP = 10;
+static const int WALK_OFFSET_MAX = 1000;
+
+static int planner_runs = 0;
+static bool planner_all_pairs = false;
+static int repair_runs = 0;
+static int walk_runs = 0;
+static uint64_t run_until = 60 * SECOND;
+static struct TrainManagerStats manager_stats;
+
+static struct {
+  int plans;
+  int found;
+  // the path does not end at the destination or its reverse
+  int wrong_end;
+  double seconds;
+  double max_seconds;
+} planner_result;
+
+static struct {
+  int plans;
+  double scratch_seconds;
+  // once a zone on the path is taken by another train, and once it is let go again
+  double taken_seconds;
+  double released_seconds;
+  // plans around the taken zone that are not what a new search finds
+  int differ;
+} repair_result;
+
+static struct {
+  int walks;
+  int updates;
+  double seconds;
+} walk_result;
+
+// util's atoi reads the whole string, this stops at the first character that is not a digit
+static int read_number(char *text, char **end) {
+  int number = 0;
+  while (*text >= '0' && *text <= '9') {
+    number = number * 10 + (*text++ - '0');
+  }
+  *end = text;
+  return number;
+}
+
+// levels the calibration measured replace the model's defaults
+static void calibrate_train(struct MarklinTrain *t) {
+  int index = trainset_get_train_index(t->number);
+  if (TRAINSET_TRAINS[index] != t->number) {
+    return;
+  }
+
+  trainset_calib_data_init();
+  for (int speed = 0; speed < MARKLIN_MODEL_SPEEDS; ++speed) {
+    // fixed point mm per tick, at 100 ticks a second
+    int velocity = TRAINSET_MEASURED_SPEEDS[index][speed] * 100 / FIXED_POINT_MULTIPLIER;
+    if (velocity > 0) {
+      t->dynamics.speeds[speed] = velocity;
+    }
+
+    if (TRAINSET_STOPPING_DISTANCES[index][speed] > 0) {
+      t->dynamics.stopping_distances[speed] = TRAINSET_STOPPING_DISTANCES[index][speed];
+    }
+
+    int accel_ticks = TRAINSET_ACCEL_TIMES[index][speed] > 0 ? TRAINSET_ACCEL_TIMES[index][speed]
+                                                              : TRAINSET_ACCEL_TIMES[index][0];
+    t->dynamics.accel_times[speed] = accel_ticks * TIMER_TICK_DURATION / 1000;
+  }
+}
+
+static double wall_time() {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void bench_plan(int planner, struct TrackPosition *from, struct TrackPosition *dest) {
+  struct TrainPosition src = {.position = *from, .last_dir = DIR_AHEAD};
+
+  double start = wall_time();
+  struct RoutePlan plan = CreatePlan(planner, &src, dest);
+  double seconds = wall_time() - start;
+
+  ++planner_result.plans;
+  planner_result.seconds += seconds;
+  if (seconds > planner_result.max_seconds) {
+    planner_result.max_seconds = seconds;
+  }
+
+  if (plan.path_found) {
+    ++planner_result.found;
+
+    // the processed path runs from the train to the destination
+    const struct TrackNode *end = plan.path.nodes[plan.path.nodes_len - 1];
+    if (end != dest->node && end != dest->node->reverse) {
+      ++planner_result.wrong_end;
+    }
+  }
+}
+
+static bool same_path(struct RoutePlan *a, struct RoutePlan *b) {
+  if (a->path_found != b->path_found || a->path.nodes_len != b->path.nodes_len) {
+    return false;
+  }
+
+  for (int i = 0; i < a->path.nodes_len; ++i) {
+    if (a->path.nodes[i] != b->path.nodes[i]) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// plans a route for train 0, has train 1 take a zone half way along it and plans again, which
+// repairs the first search. train 2 searches from scratch with the zone taken to check the result.
+static void bench_repair(int planner, int terminal) {
+  struct TrackPosition from = track_position_random();
+  struct TrackPosition dest = track_position_random();
+  struct TrainPosition src = {.position = from, .last_dir = DIR_AHEAD};
+
+  double start = wall_time();
+  struct RoutePlan plan = CreateRepairedPlan(planner, 0, 0, 0, &src, &dest);
+  double scratch_seconds = wall_time() - start;
+
+  int zone = -1;
+  for (int i = plan.path.nodes_len / 2; plan.path_found && i < plan.path.nodes_len; ++i) {
+    const struct TrackNode *node = plan.path.nodes[i];
+    if (node->type == NODE_SENSOR || node->type == NODE_BRANCH || node->type == NODE_MERGE) {
+      zone = node->zone;
+      break;
+    }
+  }
+
+  if (zone < 0 || zone == from.node->zone) {
+    return;
+  }
+
+  ReserveTrack(terminal, zone, 1);
+
+  start = wall_time();
+  struct RoutePlan repaired = CreateRepairedPlan(planner, 0, 0, 0, &src, &dest);
+  double taken_seconds = wall_time() - start;
+  struct RoutePlan searched = CreateRepairedPlan(planner, 2, 0, 0, &src, &dest);
+
+  ReleaseReservations(terminal, zone);
+
+  start = wall_time();
+  CreateRepairedPlan(planner, 0, 0, 0, &src, &dest);
+  double released_seconds = wall_time() - start;
+
+  ++repair_result.plans;
+  repair_result.scratch_seconds += scratch_seconds;
+  repair_result.taken_seconds += taken_seconds;
+  repair_result.released_seconds += released_seconds;
+  if (!same_path(&repaired, &searched)) {
+    ++repair_result.differ;
+  }
+}
+
+// moves a position along a random route 10mm at a time, like the train manager's estimate, until
+// it reaches the end or a reverse
+static void bench_walk(int planner) {
+  struct TrackPosition from = track_position_random();
+  struct TrackPosition dest = track_position_random();
+  struct TrainPosition pos = {.position = from, .last_dir = DIR_AHEAD};
+
+  struct RoutePlan plan = CreatePlan(planner, &pos, &dest);
+  if (!plan.path_found) {
+    return;
+  }
+
+  const struct TrackNode *end = plan.path.nodes[plan.path.nodes_len - 1];
+  int updates = 0;
+
+  double start = wall_time();
+  while (pos.position.node != end && pos.position.offset < WALK_OFFSET_MAX) {
+    pos = train_position_add(pos, &plan.path, WALK_STEP);
+    ++updates;
+  }
+  double seconds = wall_time() - start;
+
+  ++walk_result.walks;
+  walk_result.updates += updates;
+  walk_result.seconds += seconds;
+}
+
+// plans between random sensors, or between every pair of nodes, through the planner task. the
+// track is set up by the train task, so this runs once everything else has booted and blocked.
+static void planner_bench_task() {
+  int planner = WhoIs("train_planner");
+  int terminal = WhoIs("terminal");
+
+  for (int i = 0; i < planner_runs; ++i) {
+    struct TrackPosition src = track_position_random();
+    struct TrackPosition dest = track_position_random();
+    bench_plan(planner, &src, &dest);
+  }
+
+  for (int i = 0; planner_all_pairs && i < TRACK_MAX; ++i) {
+    for (int j = 0; j < TRACK_MAX; ++j) {
+      if (track[i].type == NODE_NONE || track[j].type == NODE_NONE) {
+        continue;
+      }
+
+      struct TrackPosition src = {.node = &track[i], .offset = 0};
+      struct TrackPosition dest = {.node = &track[j], .offset = 0};
+      bench_plan(planner, &src, &dest);
+    }
+  }
+
+  for (int i = 0; i < repair_runs; ++i) {
+    bench_repair(planner, terminal);
+  }
+
+  for (int i = 0; i < walk_runs; ++i) {
+    bench_walk(planner);
+  }
+
+  host_kernel_stop();
+}
+
+// takes the train manager's numbers just before the run ends
+static void report_task() {
+  int clock_server = WhoIs("clock_server");
+  int train_manager = WhoIs("train_manager");
+
+  // the clock server counts from when its notifier is up, so leave a little room
+  DelayUntil(clock_server, run_until / TIMER_TICK_DURATION - 10);
+  TrainManagerGetStats(train_manager, &manager_stats);
+}
+
+// the same tasks as init_task, without the idle task and the spin at the end. it runs at the
+// lowest priority like the kernel's first task, so each task starts up before the next is created.
+static void host_init_task() {
+  Create(30, name_server_task);
+  Create(29, clock_server_task);
+  Create(IO_TASK_PRIORITY, io_server_task);
+
+  Create(DISPATCHER_PRIORITY, train_dispatcher_task);
+  Create(SENSOR_PUBLISHER_PRIORITY, sensor_publisher_task);
+  Create(TERMINAL_TASK_PRIORITY, terminal_screen_task);
+
+  Create(TRAIN_TASK_PRIORITY, train_task);
+  Create(TRAIN_TASK_PRIORITY, train_planner_task);
+  Create(3, train_manager_task);
+
+  Create(NOTIFIER_PRIORITY, train_sensor_notifier_task);
+  Create(TERMINAL_TASK_PRIORITY, terminal_task);
+
+  Create(1, report_task);
+  if (planner_runs > 0 || planner_all_pairs || repair_runs > 0 || walk_runs > 0) {
+    Create(1, planner_bench_task);
+  }
+}
+
+static void usage(char *name) {
+  fprintf(
+      stderr,
+      "usage: %s [-b] [-c] [-d] [-s seconds] [-e seconds:command ...] [-p plans] [-a] [-z plans] "
+      "[-w walks] [-n percent] [-j ms] [-m percent] [-r seed] [train:node ...]\n",
+      name
+  );
+}
+
+int main(int argc, char **argv) {
+  static struct MarklinModel model;
+  char track = 'A';
+  bool show_console = false;
+  bool dump = false;
+  struct MarklinModelNoise noise = {0};
+
+  // typed once the options are parsed, they have to be in order of time
+  char *commands[COMMANDS_MAX];
+  int commands_len = 0;
+
+  int opt;
+  while ((opt = getopt(argc, argv, "bcds:e:p:az:w:n:j:m:r:")) != -1) {
+    switch (opt) {
+      case 'b':
+        track = 'B';
+        break;
+      case 'c':
+        show_console = true;
+        break;
+      case 'd':
+        dump = true;
+        break;
+      case 's':
+        run_until = atoi(optarg) * SECOND;
+        break;
+      case 'e':
+        if (commands_len < COMMANDS_MAX) {
+          commands[commands_len++] = optarg;
+        }
+        break;
+      case 'p':
+        planner_runs = atoi(optarg);
+        break;
+      case 'a':
+        planner_all_pairs = true;
+        break;
+      case 'z':
+        repair_runs = atoi(optarg);
+        break;
+      case 'w':
+        walk_runs = atoi(optarg);
+        break;
+      case 'n':
+        noise.speed_percent = atoi(optarg);
+        break;
+      case 'j':
+        noise.sensor_delay_max = atoi(optarg) * 1000;
+        break;
+      case 'm':
+        noise.missed_percent = atoi(optarg);
+        break;
+      case 'r':
+        noise.seed = atoi(optarg);
+        break;
+      default:
+        usage(argv[0]);
+        return 1;
+    }
+  }
+
+  marklin_model_init(&model, track);
+  marklin_model_set_noise(&model, &noise);
+  for (int i = optind; i < argc; ++i) {
+    char *sep;
+    int train = read_number(argv[i], &sep);
+
+    if (*sep != ':' || marklin_model_place_train(&model, train, sep + 1) < 0) {
+      fprintf(stderr, "cannot place %s\n", argv[i]);
+      return 1;
+    }
+
+    calibrate_train(marklin_model_find_train(&model, train));
+  }
+
+  host_board_init(&model, show_console ? STDOUT_FILENO : -1);
+
+  for (int i = 0; i < commands_len; ++i) {
+    char *command;
+    int seconds = read_number(commands[i], &command);
+
+    if (*command != ':') {
+      usage(argv[0]);
+      return 1;
+    }
+
+    // the shell runs a command on carriage return
+    char line[256];
+    snprintf(line, sizeof(line), "%s\r", command + 1);
+    host_board_type(line, seconds * SECOND);
+  }
+
+  double start = wall_time();
+  int ret = host_kernel_run(host_init_task, 0, run_until);
+  double elapsed = wall_time() - start;
+
+  fflush(stdout);
+  double simulated = host_kernel_time() / (double) SECOND;
+  fprintf(
+      stderr,
+      "\nsimulated %.1fs in %.2fs (%.0fx), %llu context switches%s\n",
+      simulated,
+      elapsed,
+      elapsed > 0 ? simulated / elapsed : 0.0,
+      (unsigned long long) host_kernel_switches(),
+      ret < 0 ? ", every task blocked" : ""
+  );
+
+  struct MarklinModelStats *stats = &model.stats;
+  fprintf(
+      stderr,
+      "marklin: speed %u, reverse %u, switch %u, dumps %u, module dumps %u, sensor hits %u, "
+      "missed %u\n",
+      stats->speed_commands,
+      stats->reverse_commands,
+      stats->switch_commands,
+      stats->dumps,
+      stats->module_dumps,
+      stats->sensor_hits,
+      stats->missed_sensors
+  );
+
+  struct TrainManagerStats *manager = &manager_stats;
+  double hours = simulated / 3600;
+  fprintf(
+      stderr,
+      "trains: %d deliveries (%.1f per hour), %d waits averaging %.2fs, %d deadlocks, position "
+      "error %.0fmm average %dmm max over %d sensors\n",
+      manager->deliveries,
+      hours > 0 ? manager->deliveries / hours : 0.0,
+      manager->waits,
+      manager->waits > 0 ? manager->wait_ticks * (TIMER_TICK_DURATION / 1e6) / manager->waits : 0.0,
+      manager->deadlocks,
+      manager->position_errors > 0
+          ? (double) manager->position_error_total / manager->position_errors
+          : 0.0,
+      manager->position_error_max,
+      manager->position_errors
+  );
+
+  if (dump) {
+    host_kernel_dump();
+  }
+
+  if (planner_result.plans > 0) {
+    fprintf(
+        stderr,
+        "planner: %d plans, %d found, %d ending elsewhere, %.1fus per plan, %.1fus max\n",
+        planner_result.plans,
+        planner_result.found,
+        planner_result.wrong_end,
+        planner_result.seconds * 1e6 / planner_result.plans,
+        planner_result.max_seconds * 1e6
+    );
+  }
+
+  if (repair_result.plans > 0) {
+    fprintf(
+        stderr,
+        "repair: %d plans, %.1fus searching from scratch, %.1fus once a zone on the path is "
+        "taken, %.1fus once it is let go, %d differ from a new search\n",
+        repair_result.plans,
+        repair_result.scratch_seconds * 1e6 / repair_result.plans,
+        repair_result.taken_seconds * 1e6 / repair_result.plans,
+        repair_result.released_seconds * 1e6 / repair_result.plans,
+        repair_result.differ
+    );
+  }
+
+  if (walk_result.updates > 0) {
+    fprintf(
+        stderr,
+        "positions: %d routes, %d updates, %.3fus per update\n",
+        walk_result.walks,
+        walk_result.updates,
+        walk_result.seconds * 1e6 / walk_result.updates
+    );
+  }
+
+  return 0;
+}
@@ -0,0 +1,110 @@
+#include "spsc_ring.h"
+
+#define SPSC_RING_MASK (SPSC_RING_CAPACITY - 1)
+
+_Static_assert(
+    (SPSC_RING_CAPACITY & SPSC_RING_MASK) == 0,
+    "spsc ring capacity must be a power of two"
+);
+
+// indices are free running and only masked when indexing into data. the acquire pairs with the
+// other side's release so data written before an index update is visible once the index is.
+static unsigned int load_acquire(const unsigned int *index) {
+  return __atomic_load_n(index, __ATOMIC_ACQUIRE);
+}
+
+static void store_release(unsigned int *index, unsigned int val) {
+  __atomic_store_n(index, val, __ATOMIC_RELEASE);
+}
+
+void spsc_ring_init(struct SpscRing *ring) {
+  ring->head = 0;
+  ring->tail_cache = 0;
+  ring->tail = 0;
+  ring->head_cache = 0;
+}
+
+unsigned char *spsc_ring_claim(struct SpscRing *ring, size_t *len) {
+  unsigned int head = ring->head;
+  unsigned int offset = head & SPSC_RING_MASK;
+
+  unsigned int contiguous = SPSC_RING_CAPACITY - offset;
+
+  // only look at the consumer's line when the cached tail does not free up the whole segment
+  if (SPSC_RING_CAPACITY - (head - ring->tail_cache) < contiguous) {
+    ring->tail_cache = load_acquire(&ring->tail);
+  }
+
+  unsigned int free = SPSC_RING_CAPACITY - (head - ring->tail_cache);
+  *len = free < contiguous ? free : contiguous;
+
+  return ring->data + offset;
+}
+
+void spsc_ring_publish(struct SpscRing *ring, size_t len) {
+  store_release(&ring->head, ring->head + len);
+}
+
+size_t spsc_ring_write(struct SpscRing *ring, const unsigned char *buf, size_t len) {
+  size_t count = 0;
+
+  // at most two segments around the wrap
+  for (int segment = 0; segment < 2 && count < len; ++segment) {
+    size_t claimed;
+    unsigned char *data = spsc_ring_claim(ring, &claimed);
+    if (claimed == 0) {
+      break;
+    }
+
+    size_t n = len - count < claimed ? len - count : claimed;
+    memcpy(data, buf + count, n);
+    spsc_ring_publish(ring, n);
+    count += n;
+  }
+
+  return count;
+}
+
+const unsigned char *spsc_ring_peek(struct SpscRing *ring, size_t *len) {
+  unsigned int tail = ring->tail;
+  unsigned int offset = tail & SPSC_RING_MASK;
+
+  unsigned int contiguous = SPSC_RING_CAPACITY - offset;
+
+  // only look at the producer's line when the cached head does not fill the whole segment
+  if (ring->head_cache - tail < contiguous) {
+    ring->head_cache = load_acquire(&ring->head);
+  }
+
+  unsigned int available = ring->head_cache - tail;
+  *len = available < contiguous ? available : contiguous;
+
+  return ring->data + offset;
+}
+
+void spsc_ring_release(struct SpscRing *ring, size_t len) {
+  store_release(&ring->tail, ring->tail + len);
+}
+
+size_t spsc_ring_read(struct SpscRing *ring, unsigned char *buf, size_t len) {
+  size_t count = 0;
+
+  for (int segment = 0; segment < 2 && count < len; ++segment) {
+    size_t available;
+    const unsigned char *data = spsc_ring_peek(ring, &available);
+    if (available == 0) {
+      break;
+    }
+
+    size_t n = len - count < available ? len - count : available;
+    memcpy(buf + count, data, n);
+    spsc_ring_release(ring, n);
+    count += n;
+  }
+
+  return count;
+}
+
+size_t spsc_ring_size(struct SpscRing *ring) {
+  return load_acquire(&ring->head) - load_acquire(&ring->tail);
+}
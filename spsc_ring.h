@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "util.h"
+
+#define SPSC_RING_CAPACITY 256
+
+// lock-free ring with exactly one producer and one consumer, e.g. an irq handler and a uart
+// server. the head is only written by the producer and the tail only by the consumer, each on its
+// own cache line along with a cached copy of the other side's index.
+struct SpscRing {
+  // producer
+  unsigned int head __attribute__((aligned(CACHE_LINE_SIZE)));
+  unsigned int tail_cache;
+
+  // consumer
+  unsigned int tail __attribute__((aligned(CACHE_LINE_SIZE)));
+  unsigned int head_cache;
+
+  unsigned char data[SPSC_RING_CAPACITY] __attribute__((aligned(CACHE_LINE_SIZE)));
+};
+
+void spsc_ring_init(struct SpscRing *ring);
+
+// producer side
+// contiguous free space that can be written in place, followed by a publish of the bytes written
+unsigned char *spsc_ring_claim(struct SpscRing *ring, size_t *len);
+void spsc_ring_publish(struct SpscRing *ring, size_t len);
+// returns the number of bytes written, anything that does not fit is dropped
+size_t spsc_ring_write(struct SpscRing *ring, const unsigned char *buf, size_t len);
+
+// consumer side
+// contiguous data that can be read in place, followed by a release of the bytes read
+const unsigned char *spsc_ring_peek(struct SpscRing *ring, size_t *len);
+void spsc_ring_release(struct SpscRing *ring, size_t len);
+// returns the number of bytes read
+size_t spsc_ring_read(struct SpscRing *ring, unsigned char *buf, size_t len);
+
+// only exact when called from the producer or the consumer while the other side is idle
+size_t spsc_ring_size(struct SpscRing *ring);
@@ -1,5 +1,12 @@
 #include "syscall.h"
 
+#include <stdint.h>
+
+// the kernel only preserves the callee-saved registers across a syscall (see svc_entry in
+// exceptions.S), arguments are pinned to x0-x7 and anything not used as an argument is clobbered
+#define SYSCALL_CLOBBERS \
+  "x8", "x9", "x10", "x11", "x12", "x13", "x14", "x15", "x16", "x17", "x18", "x30", "memory", "cc"
+
 /**
  * allocates and initializes a task descriptor, using the given priority, and the given function
  * pointer as a pointer to the entry point of executable code, essentially a function with no
@@ -14,9 +21,13 @@
  * -2	kernel is out of task descriptors.
  */
 int Create(int priority, void (*function)()) {
-  register int tid asm("x0");
+  register int tid asm("x0") = priority;
+  register void (*fn)() asm("x1") = function;
 
-  asm volatile("svc %1" : "=r"(tid) : "i"(SYSCALL_CREATE), "r"(priority), "r"(function));
+  asm volatile("svc %2"
+               : "+r"(tid), "+r"(fn)
+               : "i"(SYSCALL_CREATE)
+               : "x2", "x3", "x4", "x5", "x6", "x7", SYSCALL_CLOBBERS);
 
   return tid;
 }
@@ -30,7 +41,10 @@ int Create(int priority, void (*function)()) {
 int MyTid() {
   register int tid asm("x0");
 
-  asm volatile("svc %1" : "=r"(tid) : "i"(SYSCALL_MY_TID));
+  asm volatile("svc %1"
+               : "=r"(tid)
+               : "i"(SYSCALL_MY_TID)
+               : "x1", "x2", "x3", "x4", "x5", "x6", "x7", SYSCALL_CLOBBERS);
 
   return tid;
 }
@@ -46,7 +60,10 @@ int MyTid() {
 int MyParentTid() {
   register int tid asm("x0");
 
-  asm volatile("svc %1" : "=r"(tid) : "i"(SYSCALL_MY_PARENT_TID));
+  asm volatile("svc %1"
+               : "=r"(tid)
+               : "i"(SYSCALL_MY_PARENT_TID)
+               : "x1", "x2", "x3", "x4", "x5", "x6", "x7", SYSCALL_CLOBBERS);
 
   return tid;
 }
@@ -58,7 +75,8 @@ int MyParentTid() {
 void Yield() {
   asm volatile("svc %0"
                :  // no output operands
-               : "i"(SYSCALL_YIELD));
+               : "i"(SYSCALL_YIELD)
+               : "x0", "x1", "x2", "x3", "x4", "x5", "x6", "x7", SYSCALL_CLOBBERS);
 }
 
 /**
@@ -69,7 +87,8 @@ void Yield() {
 void Exit() {
   asm volatile("svc %0"
                :  // no output operands
-               : "i"(SYSCALL_EXIT));
+               : "i"(SYSCALL_EXIT)
+               : "x0", "x1", "x2", "x3", "x4", "x5", "x6", "x7", SYSCALL_CLOBBERS);
 }
 
 /*
@@ -92,11 +111,16 @@ void Exit() {
  * -2	send-receive-reply transaction could not be completed.
  */
 int Send(int tid, const char *msg, int msglen, char *reply, int rplen) {
-  register int reply_len asm("x0");
+  register int reply_len asm("x0") = tid;
+  register const char *msg_reg asm("x1") = msg;
+  register int msglen_reg asm("x2") = msglen;
+  register char *reply_reg asm("x3") = reply;
+  register int rplen_reg asm("x4") = rplen;
 
-  asm volatile("svc %1"
-               : "=r"(reply_len)
-               : "i"(SYSCALL_SEND), "r"(tid), "r"(msg), "r"(msglen), "r"(reply), "r"(rplen));
+  asm volatile("svc %5"
+               : "+r"(reply_len), "+r"(msg_reg), "+r"(msglen_reg), "+r"(reply_reg), "+r"(rplen_reg)
+               : "i"(SYSCALL_SEND)
+               : "x5", "x6", "x7", SYSCALL_CLOBBERS);
 
   return reply_len;
 }
@@ -114,9 +138,14 @@ int Send(int tid, const char *msg, int msglen, char *reply, int rplen) {
  * or equal to the size of the message buffer supplied. Longer messages are truncated.
  */
 int Receive(int *tid, char *msg, int msglen) {
-  register int msg_len asm("x0");
+  register uint64_t msg_len asm("x0") = (uint64_t) tid;
+  register char *msg_reg asm("x1") = msg;
+  register int msglen_reg asm("x2") = msglen;
 
-  asm volatile("svc %1" : "=r"(msg_len) : "i"(SYSCALL_RECEIVE), "r"(tid), "r"(msg), "r"(msglen));
+  asm volatile("svc %3"
+               : "+r"(msg_len), "+r"(msg_reg), "+r"(msglen_reg)
+               : "i"(SYSCALL_RECEIVE)
+               : "x3", "x4", "x5", "x6", "x7", SYSCALL_CLOBBERS);
 
   return msg_len;
 }
@@ -133,9 +162,14 @@ int Receive(int *tid, char *msg, int msglen) {
  * -2	tid is not the task id of a reply-blocked task.
  */
 int Reply(int tid, const char *reply, int rplen) {
-  register int reply_len asm("x0");
+  register int reply_len asm("x0") = tid;
+  register const char *reply_reg asm("x1") = reply;
+  register int rplen_reg asm("x2") = rplen;
 
-  asm volatile("svc %1" : "=r"(reply_len) : "i"(SYSCALL_REPLY), "r"(tid), "r"(reply), "r"(rplen));
+  asm volatile("svc %3"
+               : "+r"(reply_len), "+r"(reply_reg), "+r"(rplen_reg)
+               : "i"(SYSCALL_REPLY)
+               : "x3", "x4", "x5", "x6", "x7", SYSCALL_CLOBBERS);
 
   return reply_len;
 }
@@ -149,9 +183,12 @@ int Reply(int tid, const char *reply, int rplen) {
  * -1	invalid event.
  */
 int AwaitEvent(int eventid) {
-  register int event_data asm("x0");
+  register int event_data asm("x0") = eventid;
 
-  asm volatile("svc %1" : "=r"(event_data) : "i"(SYSCALL_AWAIT_EVENT), "r"(eventid));
+  asm volatile("svc %1"
+               : "+r"(event_data)
+               : "i"(SYSCALL_AWAIT_EVENT)
+               : "x1", "x2", "x3", "x4", "x5", "x6", "x7", SYSCALL_CLOBBERS);
 
   return event_data;
 }
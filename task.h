@@ -3,12 +3,14 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "kernel_config.h"
 #include "mail.h"
+#include "util.h"
 
-#define TASKS_MAX 128
+#define TASKS_MAX CONFIG_TASKS_MAX
 #define NUM_REGISTERS 31
 
-#define STACK_SIZE 524288
+#define STACK_SIZE CONFIG_STACK_SIZE
 
 enum TaskStatus {
   TASK_ACTIVE,
@@ -20,7 +22,7 @@ enum TaskStatus {
   TASK_EVENT_BLOCKED
 };
 
-// must update kern_exit in exceptions.S if the size of this struct changes.
+// must update kern_exit and svc_entry in exceptions.S if the layout of this struct changes.
 struct TaskContext {
   uint64_t registers[NUM_REGISTERS];
   // SP_EL0
@@ -37,27 +39,34 @@ struct Recvbuffer {
   int msglen;
 };
 
+// offsets used by exceptions.S are generated from this layout by asm_offsets.c
 struct TaskDescriptor {
+  // scheduler fields, read on every switch, share the first cache line
   uint32_t tid;
   uint32_t priority;
-
-  struct TaskContext context;  // offset: 8
-
-  struct TaskDescriptor *parent;
   enum TaskStatus status;
+  struct TaskDescriptor *parent;
 
-  // block of memory allocated for this task
-  uint64_t stack[STACK_SIZE];
+  // saved and restored on every switch, starts on its own cache line
+  struct TaskContext context __attribute__((aligned(CACHE_LINE_SIZE)));
 
-  // NOTE: add extra fields below here
+  // message passing bookkeeping, only touched by Send/Receive/Reply
   // list of senders blocked waiting for the task to receive
-  struct MailQueue wait_for_receive;
+  struct MailQueue wait_for_receive __attribute__((aligned(CACHE_LINE_SIZE)));
   struct Recvbuffer receive_buffer;
   struct MailQueueNode tempnode;
   struct Message outgoing_msg;
   struct Message reply_msg;
+
+  // block of memory allocated for this task
+  uint64_t stack[STACK_SIZE] __attribute__((aligned(CACHE_LINE_SIZE)));
 };
 
+_Static_assert(
+    offsetof(struct TaskDescriptor, context) == CACHE_LINE_SIZE,
+    "scheduler fields must fit in one cache line"
+);
+
 void tasks_init();
 struct TaskDescriptor *task_create(struct TaskDescriptor *parent, int priority, void (*function)());
 struct TaskDescriptor *task_get_current_task();
@@ -2,9 +2,10 @@
 
 #include <stddef.h>
 
+#include "kernel_config.h"
 #include "task.h"
 
-#define MAX_PRIORITY 64
+#define MAX_PRIORITY CONFIG_MAX_PRIORITY
 
 struct TaskQueueNode {
   struct TaskDescriptor *val;
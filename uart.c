@@ -6,6 +6,8 @@
 
 #include "circular_buffer.h"
 #include "irq.h"
+#include "spsc_ring.h"
+#include "timer.h"
 #include "util.h"
 
 #define MMIO_BASE ((char*) 0xFE000000)
@@ -280,3 +282,147 @@ enum Event uart_handle_irq() {
 
   return EVENT_UNKNOWN;
 }
+
+/*********** MARKLIN FAST PATH ********************************/
+
+// the marklin line is serviced entirely in the fast irq path: bytes move between the uart and
+// these rings and the CTS state machine runs in the kernel. tasks are only woken once a full
+// sensor dump has arrived or the tx ring has drained.
+// number of bytes in the reply to a read all sensors command
+#define MARKLIN_SENSOR_DUMP_LEN 10
+static const unsigned char MARKLIN_CMD_READ_ALL_SENSORS = 0x80 + 5;
+// a single module read (0xC1 to 0xC5) is answered with that module's 2 bytes
+static const unsigned int MARKLIN_SENSOR_MODULE_DUMP_LEN = 2;
+static const unsigned char MARKLIN_CMD_READ_SENSOR_MODULE = 0xC0;
+
+enum MarklinState { MARKLIN_READY, MARKLIN_CMD_SENT, MARKLIN_BUSY };
+
+// the kernel produces rx and consumes tx, the io tasks do the opposite
+static struct SpscRing marklin_rx_ring;
+static struct SpscRing marklin_tx_ring;
+
+static enum MarklinState marklin_state = MARKLIN_READY;
+// bytes left in the sensor dump we are waiting for, no commands are sent until it arrives
+static unsigned int marklin_dump_remaining = 0;
+// position of the next dump byte in the full 10 byte dump, a module read starts part way in
+static unsigned int marklin_dump_index = 0;
+// arrival time of the latest byte at each position of the dump, in microseconds. the fifo is off
+// on this line so every byte is stamped in the interrupt it arrives in.
+static uint64_t marklin_sensor_stamps[MARKLIN_SENSOR_DUMP_LEN];
+
+// wakeups that still need to be delivered to tasks
+static bool marklin_rx_escalate = false;
+static bool marklin_tx_escalate = false;
+
+size_t uart_marklin_read(unsigned char* buf, size_t len) {
+  return spsc_ring_read(&marklin_rx_ring, buf, len);
+}
+
+size_t uart_marklin_write(const unsigned char* buf, size_t len) {
+  return spsc_ring_write(&marklin_tx_ring, buf, len);
+}
+
+size_t uart_marklin_tx_pending() {
+  return spsc_ring_size(&marklin_tx_ring);
+}
+
+void uart_marklin_sensor_stamps(uint64_t* stamps) {
+  for (unsigned int i = 0; i < MARKLIN_SENSOR_DUMP_LEN; ++i) {
+    stamps[i] = marklin_sensor_stamps[i];
+  }
+}
+
+void uart_marklin_kick() {
+  // the tx ring is drained from the fast path, so force an interrupt to get it started
+  irq_set_pending(IRQ_UART);
+}
+
+static void marklin_drain_rx() {
+  while (uart_hasc(UART_MARKLIN)) {
+    unsigned char ch = uart_getc(UART_MARKLIN);
+
+    // drop bytes if no one is reading them
+    spsc_ring_write(&marklin_rx_ring, &ch, 1);
+
+    if (marklin_dump_remaining > 0) {
+      marklin_sensor_stamps[marklin_dump_index++ % MARKLIN_SENSOR_DUMP_LEN] = timer_get_time();
+      --marklin_dump_remaining;
+
+      if (marklin_dump_remaining == 0) {
+        marklin_rx_escalate = true;
+      }
+    } else {
+      // not part of a sensor dump, pass it on straight away
+      marklin_rx_escalate = true;
+    }
+  }
+}
+
+static void marklin_pump_tx() {
+  if (marklin_state != MARKLIN_READY || marklin_dump_remaining > 0 ||
+      uart_tx_fifo_full(UART_MARKLIN)) {
+    return;
+  }
+
+  unsigned char ch;
+  if (spsc_ring_read(&marklin_tx_ring, &ch, 1) == 0) {
+    return;
+  }
+
+  UART_REG(UART_MARKLIN, UART_DR) = ch;
+  marklin_state = MARKLIN_CMD_SENT;
+
+  if (ch == MARKLIN_CMD_READ_ALL_SENSORS) {
+    marklin_dump_remaining = MARKLIN_SENSOR_DUMP_LEN;
+    marklin_dump_index = 0;
+  } else if (ch > MARKLIN_CMD_READ_SENSOR_MODULE && ch <= MARKLIN_CMD_READ_SENSOR_MODULE + 5) {
+    marklin_dump_remaining = MARKLIN_SENSOR_MODULE_DUMP_LEN;
+    marklin_dump_index = (ch - MARKLIN_CMD_READ_SENSOR_MODULE - 1) * MARKLIN_SENSOR_MODULE_DUMP_LEN;
+  }
+
+  if (spsc_ring_size(&marklin_tx_ring) == 0) {
+    marklin_tx_escalate = true;
+  }
+}
+
+enum Event uart_handle_fast_irq() {
+  bool console = !(*REG_PACTL_CS & (1 << 18)) && UART_REG(UART_CONSOLE, UART_MIS) != 0;
+
+  // no marklin interrupt is a kick from uart_marklin_kick()
+  uint32_t mis = UART_REG(UART_MARKLIN, UART_MIS);
+  UART_REG(UART_MARKLIN, UART_ICR) = mis;
+
+  if (mis & UART_CTS_MASK) {
+    // cts drops once the command is accepted and rises again once marklin is ready
+    if (marklin_state == MARKLIN_CMD_SENT) {
+      marklin_state = MARKLIN_BUSY;
+    } else if (marklin_state == MARKLIN_BUSY) {
+      marklin_state = MARKLIN_READY;
+    }
+  }
+
+  if (mis & (UART_RX_MASK | UART_RT_MASK)) {
+    marklin_drain_rx();
+  }
+
+  marklin_pump_tx();
+
+  enum Event event = EVENT_IGNORE;
+  if (console) {
+    // console interrupts take the regular path
+    event = EVENT_UNKNOWN;
+  } else if (marklin_rx_escalate) {
+    marklin_rx_escalate = false;
+    event = EVENT_UART_MARKLIN_RX;
+  } else if (marklin_tx_escalate) {
+    marklin_tx_escalate = false;
+    event = EVENT_UART_MARKLIN_TX;
+  }
+
+  // only one event can be delivered per interrupt, come back for the rest
+  if (marklin_rx_escalate || marklin_tx_escalate) {
+    irq_set_pending(IRQ_UART);
+  }
+
+  return event;
+}
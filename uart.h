@@ -17,6 +17,7 @@ void uart_config_and_enable(
     bool fifo_buffer,
     bool cts_irq);
 enum Event uart_handle_irq();
+enum Event uart_handle_fast_irq();
 void uart_enable_tx_irq(size_t line);
 void uart_disable_tx_irq(size_t line);
 bool uart_tx_asserted(size_t line);
@@ -26,3 +27,13 @@ unsigned char uart_getc(size_t line);
 void uart_putc(size_t line, unsigned char ch);
 void uart_puts(size_t line, const char* buf);
 bool uart_cts(size_t line);
+
+// marklin line rings, serviced by the fast irq path
+size_t uart_marklin_read(unsigned char* buf, size_t len);
+size_t uart_marklin_write(const unsigned char* buf, size_t len);
+// bytes in the tx ring that have not been handed to the uart yet
+size_t uart_marklin_tx_pending();
+// copies the arrival time in microseconds of the latest byte at each of the 10 positions of a
+// sensor dump, module reads fill in their own 2 positions
+void uart_marklin_sensor_stamps(uint64_t* stamps);
+void uart_marklin_kick();
@@ -2,18 +2,20 @@
 
 #include "idle_task.h"
 #include "irq.h"
+#include "kernel_config.h"
 #include "server/clock_server.h"
 #include "server/io_server.h"
 #include "server/name_server.h"
 #include "syscall.h"
 #include "task.h"
 #include "terminal/terminal_task.h"
-#include "test/msg_perf_test.h"
+#include "test/bench_suite.h"
 #include "test/replay_task.h"
 #include "test/rps/rps_test_task.h"
 #include "test/test_tasks.h"
 #include "test/testk3.h"
 #include "timer.h"
+#include "train/sensor_publisher.h"
 #include "train/train_dispatcher.h"
 #include "train/train_manager.h"
 #include "train/train_planner.h"
@@ -22,9 +24,6 @@
 #include "train/trainset_task.h"
 
 void init_task() {
-#if BENCHMARK
-  Create(63, msg_perf_spawner);
-#else
   // Create(10, name_server_task);
   // Create(2, rps_test_task);
   // Create(1, idle_task);
@@ -33,11 +32,16 @@ void init_task() {
   // Create(9, clock_server_task);
 
   // Create(7, test_clock_server_task);
-#endif
   Create(30, name_server_task);
   Create(29, clock_server_task);
   Create(IO_TASK_PRIORITY, io_server_task);
-  // // Create(19, train_dispatcher_task);
+
+#if CONFIG_BENCHMARK
+  // benchmarks run without the train stack so it does not skew the results
+  Create(40, bench_task);
+#else
+  Create(DISPATCHER_PRIORITY, train_dispatcher_task);
+  Create(SENSOR_PUBLISHER_PRIORITY, sensor_publisher_task);
 
   // Create(TERMINAL_TASK_PRIORITY, train_planner_task);
   Create(TERMINAL_TASK_PRIORITY, terminal_screen_task);
@@ -53,6 +57,7 @@ void init_task() {
 
   Create(1, idle_task);
   // Create(1, replay_task);
+#endif
   for (;;) {
   }  // spin forever when no other tasks are running
 }
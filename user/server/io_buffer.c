@@ -0,0 +1,147 @@
+#include "io_buffer.h"
+
+#include "timer.h"
+#include "util.h"
+
+void io_buffer_init(struct IOBuffer *io_buffer, enum IOOverflowPolicy policy) {
+  circular_buffer_init(&io_buffer->buffer);
+  io_buffer->policy = policy;
+  io_buffer->written = 0;
+  io_buffer->read = 0;
+
+  memset(&io_buffer->stats, 0, sizeof(io_buffer->stats));
+  io_buffer->latency_total = 0;
+  io_buffer->latency_samples = 0;
+
+  io_buffer->marks_head = 0;
+  io_buffer->marks_len = 0;
+}
+
+// record the latency of every write whose last byte has left the buffer
+static void io_buffer_update_latency(struct IOBuffer *io_buffer) {
+  uint64_t now = timer_get_time();
+
+  while (io_buffer->marks_len > 0) {
+    struct IOBufferMark *mark = &io_buffer->marks[io_buffer->marks_head];
+    if (io_buffer->read < mark->offset) {
+      break;
+    }
+
+    uint32_t latency = now - mark->time;
+    io_buffer->latency_total += latency;
+    ++io_buffer->latency_samples;
+
+    if (latency > io_buffer->stats.latency_max) {
+      io_buffer->stats.latency_max = latency;
+    }
+
+    io_buffer->marks_head = (io_buffer->marks_head + 1) % IO_BUFFER_MARKS;
+    --io_buffer->marks_len;
+  }
+}
+
+// drops the oldest len bytes, writes that were thrown away never left the buffer so they are not
+// latency samples
+static void io_buffer_evict(struct IOBuffer *io_buffer, unsigned int len) {
+  circular_buffer_consume(&io_buffer->buffer, len);
+  io_buffer->read += len;
+
+  while (io_buffer->marks_len > 0 &&
+         io_buffer->read >= io_buffer->marks[io_buffer->marks_head].offset) {
+    io_buffer->marks_head = (io_buffer->marks_head + 1) % IO_BUFFER_MARKS;
+    --io_buffer->marks_len;
+  }
+}
+
+void io_buffer_consume(struct IOBuffer *io_buffer, unsigned int len) {
+  circular_buffer_consume(&io_buffer->buffer, len);
+  io_buffer->read += len;
+  io_buffer_update_latency(io_buffer);
+}
+
+unsigned int io_buffer_write(
+    struct IOBuffer *io_buffer,
+    const unsigned char *data,
+    unsigned int len
+) {
+  unsigned int space = BUFFER_CAPACITY - circular_buffer_size(&io_buffer->buffer);
+  unsigned int taken = len;
+
+  if (len > space) {
+    if (io_buffer->policy == IO_OVERFLOW_DROP_OLDEST) {
+      // only the newest bytes can be kept if there are more than fit in the buffer at all
+      if (len > BUFFER_CAPACITY) {
+        io_buffer->stats.dropped += len - BUFFER_CAPACITY;
+        data += len - BUFFER_CAPACITY;
+        len = BUFFER_CAPACITY;
+      }
+
+      unsigned int evicted = len - space;
+      io_buffer->stats.dropped += evicted;
+      io_buffer_evict(io_buffer, evicted);
+    } else {
+      if (io_buffer->policy == IO_OVERFLOW_DROP_NEWEST) {
+        io_buffer->stats.dropped += len - space;
+      } else {
+        taken = space;
+      }
+
+      len = space;
+    }
+  }
+
+  if (len == 0) {
+    return taken;
+  }
+
+  circular_buffer_write_n(&io_buffer->buffer, data, len);
+  io_buffer->written += len;
+  io_buffer->stats.enqueued += len;
+
+  unsigned int size = circular_buffer_size(&io_buffer->buffer);
+  if (size > io_buffer->stats.high_water) {
+    io_buffer->stats.high_water = size;
+  }
+
+  // writes are sampled while the marks are full
+  if (io_buffer->marks_len < IO_BUFFER_MARKS) {
+    unsigned int index = (io_buffer->marks_head + io_buffer->marks_len) % IO_BUFFER_MARKS;
+    io_buffer->marks[index].offset = io_buffer->written;
+    io_buffer->marks[index].time = timer_get_time();
+    ++io_buffer->marks_len;
+  }
+
+  return taken;
+}
+
+unsigned int io_buffer_read_n(struct IOBuffer *io_buffer, unsigned char *out, unsigned int len) {
+  unsigned int count = circular_buffer_read_n(&io_buffer->buffer, out, len);
+  io_buffer->read += count;
+  io_buffer_update_latency(io_buffer);
+
+  return count;
+}
+
+const unsigned char *io_buffer_peek_contiguous(struct IOBuffer *io_buffer, unsigned int *len) {
+  return circular_buffer_peek_contiguous(&io_buffer->buffer, len);
+}
+
+char io_buffer_peek_at(struct IOBuffer *io_buffer, unsigned int offset) {
+  return circular_buffer_peek_at(&io_buffer->buffer, offset);
+}
+
+unsigned int io_buffer_size(struct IOBuffer *io_buffer) {
+  return circular_buffer_size(&io_buffer->buffer);
+}
+
+bool io_buffer_empty(struct IOBuffer *io_buffer) {
+  return circular_buffer_empty(&io_buffer->buffer);
+}
+
+void io_buffer_get_stats(struct IOBuffer *io_buffer, struct IOStats *stats) {
+  *stats = io_buffer->stats;
+
+  if (io_buffer->latency_samples > 0) {
+    stats->latency_avg = io_buffer->latency_total / io_buffer->latency_samples;
+  }
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "circular_buffer.h"
+
+// what an io server does with bytes that do not fit in its buffer
+enum IOOverflowPolicy {
+  // keep the sender blocked until there is space, tx only
+  IO_OVERFLOW_BLOCK,
+  IO_OVERFLOW_DROP_NEWEST,
+  IO_OVERFLOW_DROP_OLDEST
+};
+
+struct IOStats {
+  uint32_t enqueued;
+  uint32_t dropped;
+  // most bytes the buffer has held at once
+  uint32_t high_water;
+  // time bytes spent in the buffer in microseconds, sampled
+  uint32_t latency_avg;
+  uint32_t latency_max;
+};
+
+#define IO_BUFFER_MARKS 16
+
+// a write that is timed until its last byte leaves the buffer
+struct IOBufferMark {
+  uint64_t offset;
+  uint64_t time;
+};
+
+// circular buffer for the io servers that applies an overflow policy and keeps statistics
+struct IOBuffer {
+  struct CircularBuffer buffer;
+  enum IOOverflowPolicy policy;
+
+  // bytes ever written to and removed from the buffer
+  uint64_t written;
+  uint64_t read;
+
+  struct IOStats stats;
+  uint64_t latency_total;
+  uint32_t latency_samples;
+
+  struct IOBufferMark marks[IO_BUFFER_MARKS];
+  unsigned int marks_head;
+  unsigned int marks_len;
+};
+
+void io_buffer_init(struct IOBuffer *io_buffer, enum IOOverflowPolicy policy);
+// returns the number of bytes taken, only less than len with IO_OVERFLOW_BLOCK
+unsigned int io_buffer_write(
+    struct IOBuffer *io_buffer,
+    const unsigned char *data,
+    unsigned int len
+);
+unsigned int io_buffer_read_n(struct IOBuffer *io_buffer, unsigned char *out, unsigned int len);
+const unsigned char *io_buffer_peek_contiguous(struct IOBuffer *io_buffer, unsigned int *len);
+void io_buffer_consume(struct IOBuffer *io_buffer, unsigned int len);
+char io_buffer_peek_at(struct IOBuffer *io_buffer, unsigned int offset);
+unsigned int io_buffer_size(struct IOBuffer *io_buffer);
+bool io_buffer_empty(struct IOBuffer *io_buffer);
+void io_buffer_get_stats(struct IOBuffer *io_buffer, struct IOStats *stats);
@@ -2,13 +2,17 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "circular_buffer.h"
+#include "clock_server.h"
+#include "io_buffer.h"
 #include "irq.h"
 #include "name_server.h"
 #include "syscall.h"
 #include "uart.h"
 #include "user/tid_queue.h"
+#include "util.h"
 
 const int IO_TASK_PRIORITY = 20;
 
@@ -34,6 +38,14 @@ void io_server_task() {
   Exit();
 }
 
+// handled by every io server, the type has the same value in the tx and rx requests
+struct IOControlRequest {
+  // -1 to leave the policy unchanged
+  int policy;
+  // NULL if the stats are not wanted
+  struct IOStats *stats;
+};
+
 struct IOTxPutcRequest {
   unsigned char data;
 };
@@ -43,12 +55,19 @@ struct IOTxPutlRequest {
   int datalen;
 };
 
-enum IOTxRequestType { TX_REQ_NOTIFY_TX, TX_REQ_PUTC, TX_REQ_PUTL, TX_REQ_NOTIFY_CTS, TX_REQ_READ };
+enum IOTxRequestType {
+  TX_REQ_CONTROL,
+  TX_REQ_NOTIFY_TX,
+  TX_REQ_PUTC,
+  TX_REQ_PUTL,
+  TX_REQ_PUTL_SYNC
+};
 
 struct IOTxRequest {
   enum IOTxRequestType type;
 
   union {
+    struct IOControlRequest control_req;
     struct IOTxPutcRequest putc_req;
     struct IOTxPutlRequest putl_req;
   };
@@ -68,87 +87,279 @@ void io_tx_notify_task() {
   }
 }
 
-void io_marklin_tx_notify_cts_task() {
+void io_marklin_tx_notify_task() {
   int marklin_tx_io_task = MyParentTid();
 
-  struct IOTxRequest req = {.type = TX_REQ_NOTIFY_CTS};
+  struct IOTxRequest req = {.type = TX_REQ_NOTIFY_TX};
   while (true) {
-    AwaitEvent(EVENT_UART_MARKLIN_CTS);
+    // only fires once the kernel tx ring has been drained
+    AwaitEvent(EVENT_UART_MARKLIN_TX);
     Send(marklin_tx_io_task, (const char *) &req, sizeof(req), NULL, 0);
   }
 }
 
-enum MarklinState { MARKLIN_READY, MARKLIN_CMD_SENT, MARKLIN_BUSY };
+static int io_control(struct IOBuffer *io_buffer, struct IOControlRequest *req, bool can_block) {
+  if (req->policy == IO_OVERFLOW_BLOCK && !can_block) {
+    return -1;
+  }
 
-void io_marklin_tx_task() {
-  int clock_server = WhoIs("clock_server");
+  if (req->policy >= 0) {
+    io_buffer->policy = req->policy;
+  }
+
+  if (req->stats) {
+    io_buffer_get_stats(io_buffer, req->stats);
+  }
+
+  return 0;
+}
+
+// a task blocked on a full tx buffer, the rest of its data is written once there is space
+struct IOTxBlockedWriter {
+  const unsigned char *data;
+  int len;
+  int written;
+  // PutlSync, the writer is only replied to once its data has left the kernel ring
+  bool sync;
+  // putc data, the request it came in is gone by the time it is written
+  unsigned char ch;
+};
 
-  bool done_reading = true;
+// replies to a fully buffered writer, or parks it until its data has been sent if it is synchronous
+static void io_marklin_tx_done(
+    struct IOBuffer *tx_buffer,
+    struct TIDQueue *sync_queue,
+    uint64_t *sync_until,
+    int tid,
+    bool sync
+) {
+  if (!sync) {
+    Reply(tid, NULL, 0);
+    return;
+  }
 
+  sync_until[tid] = tx_buffer->written;
+  tid_queue_add(sync_queue, tid);
+}
+
+void io_marklin_tx_task() {
   RegisterAs("marklin_io_tx");
 
-  int line = UART_MARKLIN;
+  // bytes that did not fit in the kernel tx ring, the CTS handshake and holding commands until
+  // a sensor dump has been read are done by the fast irq path
+  struct IOBuffer tx_buffer;
+  io_buffer_init(&tx_buffer, IO_OVERFLOW_DROP_NEWEST);
+
+  // writers waiting for space with IO_OVERFLOW_BLOCK, indexed by tid
+  struct TIDQueue blocked_queue;
+  tid_queue_init(&blocked_queue);
+  struct IOTxBlockedWriter blocked_writers[TASKS_MAX];
 
-  struct CircularBuffer tx_buffer;
-  circular_buffer_init(&tx_buffer);
+  // PutlSync writers waiting for their data to be sent, in order. indexed by tid, the value of
+  // tx_buffer.written once the writer's last byte was buffered.
+  struct TIDQueue sync_queue;
+  tid_queue_init(&sync_queue);
+  uint64_t sync_until[TASKS_MAX];
 
   // create notifier task
-  Create(NOTIFIER_PRIORITY, io_marklin_tx_notify_cts_task);
+  Create(NOTIFIER_PRIORITY, io_marklin_tx_notify_task);
 
   int tid;
   struct IOTxRequest req;
 
-  enum MarklinState marklin_state = MARKLIN_READY;
-
   while (true) {
     Receive(&tid, (char *) &req, sizeof(req));
 
     switch (req.type) {
-      case TX_REQ_NOTIFY_CTS:
-        if (marklin_state == MARKLIN_CMD_SENT) {
-          marklin_state = MARKLIN_BUSY;
-        } else if (marklin_state == MARKLIN_BUSY) {
-          marklin_state = MARKLIN_READY;
-        }
-
-        Reply(tid, NULL, 0);
+      case TX_REQ_CONTROL: {
+        int ret = io_control(&tx_buffer, &req.control_req, true);
+        Reply(tid, (const char *) &ret, sizeof(ret));
         break;
-      case TX_REQ_PUTC:
-        circular_buffer_write(&tx_buffer, req.putc_req.data);
-
+      }
+      case TX_REQ_NOTIFY_TX:
         Reply(tid, NULL, 0);
-
         break;
+      case TX_REQ_PUTC:
       case TX_REQ_PUTL:
-        for (int i = 0; i < req.putl_req.datalen; ++i) {
-          circular_buffer_write(&tx_buffer, req.putl_req.data[i]);
+      case TX_REQ_PUTL_SYNC: {
+        // the kernel ring is drained a byte per cts cycle, so there is nothing to gain from
+        // streaming out of the caller's buffer
+        struct IOTxBlockedWriter *writer = &blocked_writers[tid];
+        writer->ch = req.putc_req.data;
+        writer->data = &writer->ch;
+        writer->len = 1;
+        writer->written = 0;
+        writer->sync = req.type == TX_REQ_PUTL_SYNC;
+
+        if (req.type != TX_REQ_PUTC) {
+          writer->data = req.putl_req.data;
+          writer->len = req.putl_req.datalen;
         }
 
-        // must reply after, if we reply before, the request data can be corrupted
-        // in the middle of our write to UART.
-        Reply(tid, NULL, 0);
-        break;
-      case TX_REQ_READ:
-        done_reading = true;
-        Reply(tid, NULL, 0);
+        // stay behind writers that are already blocked
+        if (tid_queue_empty(&blocked_queue)) {
+          writer->written = io_buffer_write(&tx_buffer, writer->data, writer->len);
+        }
+
+        if (writer->written < writer->len) {
+          tid_queue_add(&blocked_queue, tid);
+        } else {
+          io_marklin_tx_done(&tx_buffer, &sync_queue, sync_until, tid, writer->sync);
+        }
         break;
+      }
       default:
-        // do not use tx
         break;
     }
 
-    if (!circular_buffer_empty(&tx_buffer) && marklin_state == MARKLIN_READY && done_reading) {
-      char ch = circular_buffer_read(&tx_buffer);
-      uart_putc(line, ch);
+    bool queued = false;
+    while (!io_buffer_empty(&tx_buffer)) {
+      unsigned int len;
+      const unsigned char *data = io_buffer_peek_contiguous(&tx_buffer, &len);
 
-      // read all sensors
-      if (ch == 0x80 + 5) {
-        done_reading = false;
+      size_t written = uart_marklin_write(data, len);
+      io_buffer_consume(&tx_buffer, written);
+      queued = queued || written > 0;
+
+      if (written < len) {
+        // kernel ring is full, wait for it to drain
+        break;
       }
+    }
+
+    // move blocked writers into the space that was freed up
+    while (!tid_queue_empty(&blocked_queue)) {
+      int blocked_tid = tid_queue_head(&blocked_queue);
+      struct IOTxBlockedWriter *writer = &blocked_writers[blocked_tid];
+
+      writer->written += io_buffer_write(
+          &tx_buffer, writer->data + writer->written, writer->len - writer->written
+      );
+
+      if (writer->written < writer->len) {
+        break;
+      }
+
+      tid_queue_poll(&blocked_queue);
+      io_marklin_tx_done(&tx_buffer, &sync_queue, sync_until, blocked_tid, writer->sync);
+    }
+
+    if (queued) {
+      uart_marklin_kick();
+    } else if (uart_marklin_tx_pending() == 0) {
+      // everything that was moved into the kernel ring has been handed to the uart
+      while (!tid_queue_empty(&sync_queue) &&
+             sync_until[tid_queue_head(&sync_queue)] <= tx_buffer.read) {
+        Reply(tid_queue_poll(&sync_queue), NULL, 0);
+      }
+    }
+  }
+}
+
+// a task blocked in PutlSync, or on a full buffer with IO_OVERFLOW_BLOCK. the rest of its data is
+// sent straight from its memory.
+struct IOTxSyncWriter {
+  const unsigned char *data;
+  int len;
+  int sent;
+  // bytes written to the tx buffer before the request, they have to go out first
+  uint64_t buffered_before;
+  // putc data, the request it came in is gone by the time it is sent
+  unsigned char ch;
+};
+
+struct IOTxState {
+  int line;
+  struct IOBuffer tx_buffer;
+
+  struct TIDQueue sync_queue;
+  // indexed by tid
+  struct IOTxSyncWriter sync_writers[TASKS_MAX];
+};
+
+static void io_tx_add_sync_writer(
+    struct IOTxState *state,
+    int tid,
+    const unsigned char *data,
+    int len
+) {
+  struct IOTxSyncWriter *writer = &state->sync_writers[tid];
+  writer->data = data;
+  writer->len = len;
+  writer->sent = 0;
+  writer->buffered_before = state->tx_buffer.written;
+
+  tid_queue_add(&state->sync_queue, tid);
+}
+
+// buffers the data, the sender is replied to once it has all been buffered or sent
+static void io_tx_buffer(struct IOTxState *state, int tid, const unsigned char *data, int len) {
+  int taken = io_buffer_write(&state->tx_buffer, data, len);
+
+  if (taken < len) {
+    // the rest goes out after what was buffered
+    io_tx_add_sync_writer(state, tid, data + taken, len - taken);
+  } else {
+    Reply(tid, NULL, 0);
+  }
+}
+
+// send up to limit bytes from the buffer, a contiguous segment at a time. returns false once the
+// fifo is full.
+static bool io_tx_drain_buffer(struct IOTxState *state, uint64_t limit) {
+  while (limit > 0 && !io_buffer_empty(&state->tx_buffer)) {
+    unsigned int len;
+    const unsigned char *data = io_buffer_peek_contiguous(&state->tx_buffer, &len);
+    if (len > limit) {
+      len = limit;
+    }
+
+    unsigned int sent = 0;
+    while (sent < len && !uart_tx_fifo_full(state->line)) {
+      uart_putc(state->line, data[sent++]);
+    }
+
+    io_buffer_consume(&state->tx_buffer, sent);
+    limit -= sent;
 
-      marklin_state = MARKLIN_CMD_SENT;
+    if (sent < len) {
+      return false;
     }
   }
+
+  return true;
+}
+
+// fill the fifo in the order the requests came in, sync writers are replied to once the last of
+// their bytes is in the fifo
+static void io_tx_drain(struct IOTxState *state) {
+  while (!tid_queue_empty(&state->sync_queue)) {
+    int tid = tid_queue_head(&state->sync_queue);
+    struct IOTxSyncWriter *writer = &state->sync_writers[tid];
+
+    uint64_t drained = state->tx_buffer.read;
+    if (drained < writer->buffered_before &&
+        !io_tx_drain_buffer(state, writer->buffered_before - drained)) {
+      return;
+    }
+
+    while (writer->sent < writer->len && !uart_tx_fifo_full(state->line)) {
+      uart_putc(state->line, writer->data[writer->sent++]);
+    }
+
+    if (writer->sent < writer->len) {
+      return;
+    }
+
+    tid_queue_poll(&state->sync_queue);
+    Reply(tid, NULL, 0);
+  }
+
+  io_tx_drain_buffer(state, UINT64_MAX);
+}
+
+static bool io_tx_idle(struct IOTxState *state) {
+  return io_buffer_empty(&state->tx_buffer) && tid_queue_empty(&state->sync_queue);
 }
 
 void io_tx_task() {
@@ -167,8 +378,9 @@ void io_tx_task() {
     RegisterAs("marklin_io_tx");
   }
 
-  struct CircularBuffer tx_buffer;
-  circular_buffer_init(&tx_buffer);
+  struct IOTxState state = {.line = line};
+  io_buffer_init(&state.tx_buffer, IO_OVERFLOW_DROP_NEWEST);
+  tid_queue_init(&state.sync_queue);
 
   // create notifier task
   int notifier_tid = Create(NOTIFIER_PRIORITY, io_tx_notify_task);
@@ -181,45 +393,64 @@ void io_tx_task() {
     Receive(&tid, (char *) &req, sizeof(req));
 
     switch (req.type) {
+      case TX_REQ_CONTROL: {
+        int ret = io_control(&state.tx_buffer, &req.control_req, true);
+        Reply(tid, (const char *) &ret, sizeof(ret));
+        break;
+      }
       case TX_REQ_NOTIFY_TX:
         // unblock notify task
         Reply(tid, NULL, 0);
 
         // tx fifo buffer not empty
-        // fill fifo buffer until full or tx_buffer empty
-        while (!uart_tx_fifo_full(line) && !circular_buffer_empty(&tx_buffer)) {
-          uart_putc(line, circular_buffer_read(&tx_buffer));
-        }
+        // fill fifo buffer until full or nothing is left to send
+        io_tx_drain(&state);
 
-        if (circular_buffer_empty(&tx_buffer)) {
+        if (io_tx_idle(&state)) {
           // disable interrupts since we have no more data to send
           uart_disable_tx_irq(line);
         }
 
         break;
       case TX_REQ_PUTC:
-        if (!circular_buffer_empty(&tx_buffer) || uart_tx_fifo_full(line)) {
-          circular_buffer_write(&tx_buffer, req.putc_req.data);
+        if (!io_tx_idle(&state) || uart_tx_fifo_full(line)) {
+          uart_enable_tx_irq(line);
+
+          struct IOTxSyncWriter *writer = &state.sync_writers[tid];
+          writer->ch = req.putc_req.data;
+          io_tx_buffer(&state, tid, &writer->ch, 1);
         } else {
           uart_putc(line, req.putc_req.data);
+          Reply(tid, NULL, 0);
         }
-
-        Reply(tid, NULL, 0);
         break;
-      case TX_REQ_PUTL:
+      case TX_REQ_PUTL: {
         uart_enable_tx_irq(line);
 
-        for (int i = 0; i < req.putl_req.datalen; ++i) {
-          circular_buffer_write(&tx_buffer, req.putl_req.data[i]);
-        }
+        const unsigned char *data = req.putl_req.data;
+        int len = req.putl_req.datalen;
 
-        // write as much as we can and wait for tx
-        while (!uart_tx_fifo_full(line) && !circular_buffer_empty(&tx_buffer)) {
-          uart_putc(line, circular_buffer_read(&tx_buffer));
+        // nothing queued ahead of us, go straight from the caller's buffer to the fifo
+        int sent = 0;
+        if (io_tx_idle(&state)) {
+          while (sent < len && !uart_tx_fifo_full(line)) {
+            uart_putc(line, data[sent++]);
+          }
         }
 
-        Reply(tid, NULL, 0);
+        // buffer the rest and wait for tx
+        io_tx_buffer(&state, tid, data + sent, len - sent);
+        io_tx_drain(&state);
         break;
+      }
+      case TX_REQ_PUTL_SYNC: {
+        uart_enable_tx_irq(line);
+
+        // the caller stays blocked until its data is in the fifo, so we can read it in place
+        io_tx_add_sync_writer(&state, tid, req.putl_req.data, req.putl_req.datalen);
+        io_tx_drain(&state);
+        break;
+      }
       default:
         // do not use cts
         break;
@@ -227,7 +458,153 @@ void io_tx_task() {
   }
 }
 
-enum IORxRequestType { RX_REQ_NOTIFY, RX_REQ_GETC };
+enum IORxRequestType {
+  RX_REQ_CONTROL,
+  RX_REQ_NOTIFY,
+  RX_REQ_GET,
+  RX_REQ_TIMEOUT,
+  RX_REQ_SET_CANONICAL
+};
+
+struct IORxGetRequest {
+  int len;
+  // -1 to only return once len bytes have been read
+  int delimiter;
+  // in ticks, 0 to wait forever
+  int timeout;
+};
+
+struct IORxTimeoutRequest {
+  // current time, -1 on the first request
+  int time;
+};
+
+struct IORxCanonicalRequest {
+  bool canonical;
+  int echo_tid;
+  int row;
+  int col;
+};
+
+struct IORxRequest {
+  enum IORxRequestType type;
+
+  union {
+    struct IOControlRequest control_req;
+    struct IORxGetRequest get_req;
+    struct IORxTimeoutRequest timeout_req;
+    struct IORxCanonicalRequest canonical_req;
+  };
+};
+
+static const unsigned char CHAR_LINE_END = '\r';
+static const unsigned char CHAR_BACKSPACE = 8;
+static const unsigned char CHAR_DELETE = 127;
+
+// enough for a few cursor moves per received byte
+#define IO_ECHO_MAX 512
+
+// edits lines in canonical mode, only complete lines are put in the rx buffer
+struct IORxLineDiscipline {
+  bool canonical;
+  // -1 to not echo
+  int echo_tid;
+  // where the line being edited is echoed on the console
+  int row;
+  int col;
+
+  unsigned char line[IO_LINE_MAX];
+  int len;
+
+  // echo for the bytes handled in one notify, sent together
+  unsigned char echo[IO_ECHO_MAX];
+  int echo_len;
+};
+
+static void io_rx_echo_str(struct IORxLineDiscipline *discipline, const char *str) {
+  while (*str && discipline->echo_len < IO_ECHO_MAX) {
+    discipline->echo[discipline->echo_len++] = *str++;
+  }
+}
+
+// save the cursor and move to the given column of the line being edited
+static void io_rx_echo_move(struct IORxLineDiscipline *discipline, int offset) {
+  char bf[12];
+
+  io_rx_echo_str(discipline, "\0337\033[");
+  ui2a(discipline->row, 10, bf);
+  io_rx_echo_str(discipline, bf);
+  io_rx_echo_str(discipline, ";");
+  ui2a(discipline->col + offset, 10, bf);
+  io_rx_echo_str(discipline, bf);
+  io_rx_echo_str(discipline, "H");
+}
+
+static void io_rx_canonical(
+    struct IORxLineDiscipline *discipline,
+    struct IOBuffer *rx_buffer,
+    unsigned char c
+) {
+  if (c == CHAR_LINE_END) {
+    // the delimiter stays in the buffer so readers can find the end of the line
+    io_buffer_write(rx_buffer, discipline->line, discipline->len);
+    io_buffer_write(rx_buffer, &c, 1);
+
+    // clear the echoed line
+    io_rx_echo_move(discipline, 0);
+    for (int i = 0; i < discipline->len; ++i) {
+      io_rx_echo_str(discipline, " ");
+    }
+    io_rx_echo_str(discipline, "\0338");
+
+    discipline->len = 0;
+  } else if (c == CHAR_BACKSPACE || c == CHAR_DELETE) {
+    if (discipline->len > 0) {
+      --discipline->len;
+
+      io_rx_echo_move(discipline, discipline->len);
+      io_rx_echo_str(discipline, " \0338");
+    }
+  } else if (discipline->len < IO_LINE_MAX - 1) {
+    // the last byte is left for the delimiter
+    io_rx_echo_move(discipline, discipline->len);
+    char str[] = {c, '\0'};
+    io_rx_echo_str(discipline, str);
+    io_rx_echo_str(discipline, "\0338");
+
+    discipline->line[discipline->len++] = c;
+  }
+}
+
+// write received bytes into the rx buffer, through the line discipline in canonical mode
+static void io_rx_receive(
+    struct IORxLineDiscipline *discipline,
+    struct IOBuffer *rx_buffer,
+    const unsigned char *data,
+    int len
+) {
+  if (!discipline->canonical) {
+    io_buffer_write(rx_buffer, data, len);
+    return;
+  }
+
+  for (int i = 0; i < len; ++i) {
+    io_rx_canonical(discipline, rx_buffer, data[i]);
+  }
+
+  if (discipline->echo_tid >= 0 && discipline->echo_len > 0) {
+    Putl(discipline->echo_tid, discipline->echo, discipline->echo_len);
+  }
+  discipline->echo_len = 0;
+}
+
+// a task blocked in GetN/GetUntil
+struct IORxWaiter {
+  int len;
+  int delimiter;
+  // tick at which the request times out, -1 for none
+  int deadline;
+};
 
 void io_rx_notify_task() {
   int rx_task;
@@ -236,7 +613,7 @@ void io_rx_notify_task() {
   Receive(&rx_task, (char *) &event, sizeof(event));
   Reply(rx_task, NULL, 0);
 
-  enum IORxRequestType req = RX_REQ_NOTIFY;
+  struct IORxRequest req = {.type = RX_REQ_NOTIFY};
   while (true) {
     AwaitEvent(event);
 
@@ -245,6 +622,64 @@ void io_rx_notify_task() {
   }
 }
 
+// sleeps until the deadline of the oldest waiter, the rx task only replies when there is one
+void io_rx_timeout_courier() {
+  int rx_task = MyParentTid();
+  int clock_server = WhoIs("clock_server");
+
+  struct IORxRequest req = {.type = RX_REQ_TIMEOUT, .timeout_req = {.time = -1}};
+  int deadline;
+  while (true) {
+    Send(rx_task, (const char *) &req, sizeof(req), (char *) &deadline, sizeof(deadline));
+    req.timeout_req.time = DelayUntil(clock_server, deadline);
+  }
+}
+
+// returns the number of bytes the waiter can take, 0 if it has to keep waiting
+static int io_rx_ready_len(struct IOBuffer *rx_buffer, struct IORxWaiter *waiter) {
+  int size = io_buffer_size(rx_buffer);
+
+  if (waiter->delimiter >= 0) {
+    for (int i = 0; i < size && i < waiter->len; ++i) {
+      if ((unsigned char) io_buffer_peek_at(rx_buffer, i) == waiter->delimiter) {
+        return i + 1;
+      }
+    }
+  }
+
+  return size >= waiter->len ? waiter->len : 0;
+}
+
+// requests are served in order, so only the oldest waiter can take data or time out. now is -1 if
+// timeouts should not be checked.
+static void io_rx_serve(
+    struct IOBuffer *rx_buffer,
+    struct TIDQueue *rx_queue,
+    struct IORxWaiter *waiters,
+    int now
+) {
+  unsigned char data[IO_GET_MAX];
+
+  while (!tid_queue_empty(rx_queue)) {
+    int tid = tid_queue_head(rx_queue);
+    struct IORxWaiter *waiter = &waiters[tid];
+    int len = io_rx_ready_len(rx_buffer, waiter);
+
+    if (len == 0) {
+      if (now < 0 || waiter->deadline < 0 || now < waiter->deadline) {
+        break;
+      }
+
+      // timed out, hand over whatever has arrived
+      len = min(io_buffer_size(rx_buffer), waiter->len);
+    }
+
+    tid_queue_poll(rx_queue);
+    io_buffer_read_n(rx_buffer, data, len);
+    Reply(tid, (const char *) data, len);
+  }
+}
+
 void io_rx_task() {
   int parent_tid;
   enum Event event;
@@ -261,64 +696,195 @@ void io_rx_task() {
     RegisterAs("marklin_io_rx");
   }
 
-  struct CircularBuffer rx_buffer;
-  circular_buffer_init(&rx_buffer);
+  int clock_server = WhoIs("clock_server");
+
+  // the uart cannot be blocked, so the sender is never held up
+  struct IOBuffer rx_buffer;
+  io_buffer_init(&rx_buffer, IO_OVERFLOW_DROP_NEWEST);
 
   struct TIDQueue rx_queue;
   tid_queue_init(&rx_queue);
 
+  // indexed by tid
+  struct IORxWaiter waiters[TASKS_MAX];
+
+  // raw until a reader asks for lines
+  struct IORxLineDiscipline discipline = {.canonical = false, .echo_tid = -1, .len = 0};
+
   // create notifier task
   int notifier_tid = Create(NOTIFIER_PRIORITY, io_rx_notify_task);
   Send(notifier_tid, (const char *) &event, sizeof(event), NULL, 0);
 
+  Create(NOTIFIER_PRIORITY, io_rx_timeout_courier);
+  // courier waiting for a deadline, -1 if it is asleep
+  int courier_tid = -1;
+
   int tid;
-  enum IORxRequestType req_type;
+  struct IORxRequest req;
 
   while (true) {
-    Receive(&tid, (char *) &req_type, sizeof(req_type));
+    Receive(&tid, (char *) &req, sizeof(req));
 
-    switch (req_type) {
+    switch (req.type) {
+      case RX_REQ_CONTROL: {
+        int ret = io_control(&rx_buffer, &req.control_req, false);
+        Reply(tid, (const char *) &ret, sizeof(ret));
+        break;
+      }
       case RX_REQ_NOTIFY:
         // unblock notify task
         Reply(tid, NULL, 0);
 
-        // read from DR, put in rx_buffer
-        // transfer to rx_buffer from fifo buffer so interrupts stop firing
-        while (uart_hasc(line)) {
-          char c = uart_getc(line);
-          circular_buffer_write(&rx_buffer, c);
+        if (line == UART_MARKLIN) {
+          // the fast irq path has already moved the bytes out of the fifo
+          unsigned char data[IO_GET_MAX];
+          size_t len;
+          while ((len = uart_marklin_read(data, sizeof(data))) > 0) {
+            io_rx_receive(&discipline, &rx_buffer, data, len);
+          }
+        } else {
+          // read from DR, put in rx_buffer
+          // transfer to rx_buffer from fifo buffer so interrupts stop firing
+          unsigned char data[IO_GET_MAX];
+          int len = 0;
+          while (uart_hasc(line) && len < IO_GET_MAX) {
+            data[len++] = uart_getc(line);
+          }
+
+          io_rx_receive(&discipline, &rx_buffer, data, len);
         }
 
         // unblock tasks that are waiting for data
-        while (!circular_buffer_empty(&rx_buffer) && !tid_queue_empty(&rx_queue)) {
-          char ch = circular_buffer_read(&rx_buffer);
-          Reply(tid_queue_poll(&rx_queue), &ch, sizeof(char));
+        io_rx_serve(&rx_buffer, &rx_queue, waiters, -1);
+        break;
+      case RX_REQ_GET: {
+        // nothing to wait for, or more than a reply can hold
+        if (req.get_req.len <= 0 || req.get_req.len > IO_GET_MAX) {
+          Reply(tid, NULL, 0);
+          break;
         }
 
-        break;
-      case RX_REQ_GETC:
-        if (!circular_buffer_empty(&rx_buffer)) {
-          char ch = circular_buffer_read(&rx_buffer);
-          Reply(tid, &ch, sizeof(char));
-        } else {
-          // block task and put it in a queue for when data is available
-          tid_queue_add(&rx_queue, tid);
+        struct IORxWaiter *waiter = &waiters[tid];
+        waiter->len = req.get_req.len;
+        waiter->delimiter = req.get_req.delimiter;
+        waiter->deadline = -1;
+
+        if (req.get_req.timeout > 0) {
+          waiter->deadline = Time(clock_server) + req.get_req.timeout;
         }
+
+        // block task and put it in a queue for when data is available
+        tid_queue_add(&rx_queue, tid);
+        io_rx_serve(&rx_buffer, &rx_queue, waiters, -1);
+        break;
+      }
+      case RX_REQ_SET_CANONICAL:
+        discipline.canonical = req.canonical_req.canonical;
+        discipline.echo_tid = req.canonical_req.echo_tid;
+        discipline.row = req.canonical_req.row;
+        discipline.col = req.canonical_req.col;
+        // a partial line is dropped when switching modes
+        discipline.len = 0;
+
+        Reply(tid, NULL, 0);
+        break;
+      case RX_REQ_TIMEOUT:
+        courier_tid = tid;
+        io_rx_serve(&rx_buffer, &rx_queue, waiters, req.timeout_req.time);
+        break;
+    }
+
+    // wake the courier up at the deadline of the oldest waiter. if an earlier deadline comes in
+    // while the courier is asleep it is only checked once the courier wakes up.
+    if (courier_tid >= 0 && !tid_queue_empty(&rx_queue)) {
+      int deadline = waiters[tid_queue_head(&rx_queue)].deadline;
+
+      if (deadline >= 0) {
+        Reply(courier_tid, (const char *) &deadline, sizeof(deadline));
+        courier_tid = -1;
+      }
     }
   }
   Exit();
 }
 
 int Getc(int tid) {
-  enum IORxRequestType req_type = RX_REQ_GETC;
-
-  char ch;
-  if (Send(tid, (const char *) &req_type, sizeof(req_type), &ch, sizeof(ch)) <= 0) {
+  unsigned char ch;
+  if (GetN(tid, &ch, 1, 0) <= 0) {
     return -1;
   }
   return ch;
 }
 
+static int io_get(int tid, unsigned char *buf, int len, int delimiter, int timeout) {
+  if (len < 0 || len > IO_GET_MAX) {
+    return -1;
+  }
+
+  if (len == 0) {
+    return 0;
+  }
+
+  struct IORxRequest req = {
+      .type = RX_REQ_GET, .get_req = {.len = len, .delimiter = delimiter, .timeout = timeout}
+  };
+  return Send(tid, (const char *) &req, sizeof(req), (char *) buf, len);
+}
+
+int GetN(int tid, unsigned char *buf, int len, int timeout) {
+  return io_get(tid, buf, len, -1, timeout);
+}
+
+int GetUntil(int tid, unsigned char *buf, int len, unsigned char delimiter, int timeout) {
+  return io_get(tid, buf, len, delimiter, timeout);
+}
+
+int IOSetCanonical(int tid, bool canonical, int echo_tid, int row, int col) {
+  struct IORxRequest req = {
+      .type = RX_REQ_SET_CANONICAL,
+      .canonical_req = {.canonical = canonical, .echo_tid = echo_tid, .row = row, .col = col}
+  };
+  return Send(tid, (const char *) &req, sizeof(req), NULL, 0);
+}
+
+int GetLine(int tid, char *buf, int len) {
+  int read = GetUntil(tid, (unsigned char *) buf, len, CHAR_LINE_END, 0);
+  if (read <= 0) {
+    return -1;
+  }
+
+  // replace the delimiter, or the last byte if the line did not fit
+  buf[read - 1] = '\0';
+  return read - 1;
+}
+
+_Static_assert(
+    (int) TX_REQ_CONTROL == (int) RX_REQ_CONTROL &&
+        offsetof(struct IOTxRequest, control_req) == offsetof(struct IORxRequest, control_req),
+    "control requests have to be understood by both tx and rx servers"
+);
+
+static int io_send_control(int tid, int policy, struct IOStats *stats) {
+  struct IOTxRequest req = {
+      .type = TX_REQ_CONTROL, .control_req = {.policy = policy, .stats = stats}
+  };
+  int ret;
+
+  if (Send(tid, (const char *) &req, sizeof(req), (char *) &ret, sizeof(ret)) < 0) {
+    return -1;
+  }
+
+  return ret;
+}
+
+int IOSetOverflowPolicy(int tid, enum IOOverflowPolicy policy) {
+  return io_send_control(tid, policy, NULL);
+}
+
+int IOGetStats(int tid, struct IOStats *stats) {
+  return io_send_control(tid, -1, stats);
+}
+
 int Putc(int tid, unsigned char ch) {
   struct IOTxRequest req = {.type = TX_REQ_PUTC, .putc_req = {.data = ch}};
   return Send(tid, (const char *) &req, sizeof(req), NULL, 0);
@@ -329,7 +895,7 @@ int Putl(int tid, const unsigned char *data, unsigned int len) {
   return Send(tid, (const char *) &req, sizeof(req), NULL, 0);
 }
 
-int NotifyMarklinRead(int tid) {
-  struct IOTxRequest req = {.type = TX_REQ_READ};
+int PutlSync(int tid, const unsigned char *data, unsigned int len) {
+  struct IOTxRequest req = {.type = TX_REQ_PUTL_SYNC, .putl_req = {.data = data, .datalen = len}};
   return Send(tid, (const char *) &req, sizeof(req), NULL, 0);
 }
@@ -1,7 +1,16 @@
 #pragma once
 
+#include <stdbool.h>
+
+#include "io_buffer.h"
+
 extern const int IO_TASK_PRIORITY;
 
+// largest number of bytes a single GetN/GetUntil can ask for, longer requests return -1
+#define IO_GET_MAX 256
+// longest line in canonical mode, including the delimiter
+#define IO_LINE_MAX 64
+
 void io_server_task();
 
 /**
@@ -16,6 +25,54 @@ void io_server_task();
  */
 int Getc(int tid);
 
+/**
+ * the tid refers to the server that handles the appropriate channel.
+ * reads exactly len bytes into buf, blocking until they have all arrived. If timeout is greater than
+ * 0 and the request has not been completed after timeout ticks, returns with whatever has arrived
+ * so far. Requests are completed in the order they are received. A len of 0 returns at once.
+ *
+ * Return Value
+ * >=0	number of bytes read.
+ * -1	tid is not a valid uart server task, or len is negative or more than IO_GET_MAX.
+ */
+int GetN(int tid, unsigned char *buf, int len, int timeout);
+
+/**
+ * the tid refers to the server that handles the appropriate channel.
+ * same as GetN() but also returns as soon as delimiter has been read. The delimiter is included in
+ * buf.
+ *
+ * Return Value
+ * >=0	number of bytes read, including the delimiter.
+ * -1	tid is not a valid uart server task, or len is negative or more than IO_GET_MAX.
+ */
+int GetUntil(int tid, unsigned char *buf, int len, unsigned char delimiter, int timeout);
+
+/**
+ * the tid refers to an rx server.
+ * switches between raw mode, where every byte is handed out as it arrives, and canonical mode.
+ * In canonical mode the server edits lines itself and only hands out complete lines ending in a
+ * carriage return. Backspace and delete remove the last character and extra characters past
+ * IO_LINE_MAX are ignored. If echo_tid is a tx server the line being edited is echoed at the given
+ * row and column of the console, the cursor is saved and restored around every echo.
+ *
+ * Return Value
+ * 0	success.
+ * -1	tid is not a valid uart server task.
+ */
+int IOSetCanonical(int tid, bool canonical, int echo_tid, int row, int col);
+
+/**
+ * the tid refers to an rx server in canonical mode.
+ * reads the next line into buf as a null terminated string without the carriage return. buf should
+ * hold IO_LINE_MAX characters, the rest of a longer line is returned by the next call.
+ *
+ * Return Value
+ * >=0	length of the line.
+ * -1	tid is not a valid uart server task.
+ */
+int GetLine(int tid, char *buf, int len);
+
 /**
  * the tid refers to the server that handles the appropriate channel.
  * queues the given character for transmission by the given UART. On return the only guarantee is
@@ -29,6 +86,27 @@ int Getc(int tid);
  */
 int Putc(int tid, unsigned char ch);
 
+/**
+ * the tid refers to any io server.
+ * sets what the server does with data that does not fit in its buffer. Every server starts with
+ * IO_OVERFLOW_DROP_NEWEST. Only tx servers can block their senders.
+ *
+ * Return Value
+ * 0	success.
+ * -1	tid is not a valid uart server task or the server cannot use the policy.
+ */
+int IOSetOverflowPolicy(int tid, enum IOOverflowPolicy policy);
+
+/**
+ * the tid refers to any io server.
+ * copies the counters of the server's buffer into stats.
+ *
+ * Return Value
+ * 0	success.
+ * -1	tid is not a valid uart server task.
+ */
+int IOGetStats(int tid, struct IOStats *stats);
+
 /**
  * the tid refers to the server that handles the appropriate channel.
  * queues the given array of characters for transmission by the given UART. On return the only
@@ -42,4 +120,14 @@ int Putc(int tid, unsigned char ch);
  */
 int Putl(int tid, const unsigned char *data, unsigned int len);
 
-int NotifyMarklinRead(int tid);
+/**
+ * the tid refers to the server that handles the appropriate channel.
+ * same as Putl() but the data is sent straight from the given array instead of being copied into
+ * the server, so there is no limit on len. Blocks until all of the data has been handed to the
+ * UART, the array must not be modified before then.
+ *
+ * Return Value
+ * 0	success.
+ * -1	tid is not a valid uart server task.
+ */
+int PutlSync(int tid, const unsigned char *data, unsigned int len);
@@ -1,7 +1,9 @@
 #include <stdarg.h>
 
 #include "../train/track_reservations.h"
+#include "shell_view.h"
 #include "terminal_screen.h"
+#include "terminal_task.h"
 #include "user/train/trainset.h"
 
 #define DECISECOND_IN_CENTISECONDS 10
@@ -289,7 +291,7 @@ update_train_speed(struct TerminalScreen *screen, int train_index, uint8_t train
 
 static void update_command(struct TerminalScreen *screen, char *command, unsigned int len) {
   terminal_save_cursor(screen);
-  terminal_move_cursor(screen, 19, 1);
+  terminal_move_cursor(screen, SHELL_COMMAND_ROW, SHELL_COMMAND_COL - 2);
   terminal_puts(screen, "> ");
   terminal_putl(screen, command, len);
   // padding to clear previous values
@@ -373,7 +375,7 @@ static void
 update_max_sensor_duration(struct TerminalScreen *screen, unsigned int max_sensor_query_duration) {
   terminal_save_cursor(screen);
   terminal_move_cursor(screen, 3, 1);
-  terminal_printf(screen, "Sensor query duration in ticks (max): %u", max_sensor_query_duration);
+  terminal_printf(screen, "Sensor query duration in us (max): %u", max_sensor_query_duration);
   terminal_restore_cursor(screen);
 }
 
@@ -462,6 +464,38 @@ static void log_print_va(struct TerminalScreen *screen, char *fmt, va_list va) {
   terminal_restore_cursor(screen);
 }
 
+static const int IO_STATS_TITLE_ROW = 5;
+static const int IO_STATS_COL = 60;
+static const char *IO_STATS_LINES[TERMINAL_IO_LINES] =
+    {"console tx", "console rx", "marklin tx", "marklin rx"};
+
+static void update_io_stats(struct TerminalScreen *screen, struct IOStats *stats) {
+  terminal_save_cursor(screen);
+  terminal_move_cursor(screen, IO_STATS_TITLE_ROW, IO_STATS_COL);
+  terminal_print_title(screen, "UART buffers (bytes, latency in us):");
+
+  terminal_move_cursor(screen, IO_STATS_TITLE_ROW + 1, IO_STATS_COL);
+  terminal_printf(
+      screen, "%12s%10s%10s%10s%10s%10s", "", "enqueued", "dropped", "max size", "avg", "max"
+  );
+
+  for (int i = 0; i < TERMINAL_IO_LINES; ++i) {
+    terminal_move_cursor(screen, IO_STATS_TITLE_ROW + 2 + i, IO_STATS_COL);
+    terminal_printf(
+        screen,
+        "%12s%10u%10u%10u%10u%10u",
+        IO_STATS_LINES[i],
+        stats[i].enqueued,
+        stats[i].dropped,
+        stats[i].high_water,
+        stats[i].latency_avg,
+        stats[i].latency_max
+    );
+  }
+
+  terminal_restore_cursor(screen);
+}
+
 static void print_next_sensor_time(struct TerminalScreen *screen, int time) {
   terminal_save_cursor(screen);
   terminal_move_cursor(screen, 0, 70);
@@ -504,6 +538,7 @@ struct TerminalView shell_view_create() {
       update_zone_reservation,
       update_selected_track,
       init_train_zones,
+      update_io_stats,
   };
 
   return view;
@@ -1,3 +1,7 @@
 #pragma once
 
+// where commands are echoed by the console rx server
+#define SHELL_COMMAND_ROW 19
+#define SHELL_COMMAND_COL 3
+
 struct TerminalView shell_view_create();
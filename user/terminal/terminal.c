@@ -8,16 +8,14 @@
 #include "user/server/io_server.h"
 #include "user/server/name_server.h"
 #include "user/train/train_calibrator.h"
+#include "user/train/train_dispatcher.h"
 #include "user/train/train_manager.h"
 #include "user/train/trainset_task.h"
 #include "util.h"
 
 static const char CHAR_DELIMITER = ' ';
-static const char CHAR_COMMAND_END = '\r';
-static const char CHAR_BACKSPACE = 8;
 
 void terminal_init(struct Terminal *terminal, int screen_tid) {
-  terminal->command_len = 0;
   terminal->screen_tid = screen_tid;
 }
 
@@ -38,6 +36,13 @@ static int get_move_time(int train, int speed, int distance) {
   return TRAINSET_ACCEL_TIMES[trainset_get_train_index(train)][speed] + constant_velocity_time;
 }
 
+static void rethrow_switch(int train_tid, int switch_num) {
+  int switch_direction = TrainGetSwitchState(train_tid, switch_num) == DIRECTION_CURVED
+                             ? TRAINSET_DIRECTION_CURVED
+                             : TRAINSET_DIRECTION_STRAIGHT;
+  TrainSetSwitchDir(train_tid, switch_num, switch_direction);
+}
+
 // Executes a command and returns 1 if the quit command is executed,
 // otherwise returns 0. Modifies command.
 bool terminal_execute_command(
@@ -133,6 +138,41 @@ bool terminal_execute_command(
 
     TrainSetSwitchDir(train_tid, switch_number, switch_direction);
     TerminalUpdateStatus(terminal->screen_tid, "Changing direction of switch!");
+  } else if (strcmp("stoplat", command_name)) {
+    char *str_train_number = strtok_r(NULL, CHAR_DELIMITER, &saveptr);
+    if (!str_train_number || !is_number(str_train_number)) {
+      TerminalUpdateStatus(terminal->screen_tid, "Train provided is not a valid train!");
+      return false;
+    }
+
+    int train_number = atoi(str_train_number);
+    if (!trainset_is_valid_train(train_number)) {
+      TerminalUpdateStatus(terminal->screen_tid, "Train provided is not a valid train!");
+      return false;
+    }
+
+    // throw every switch in its current direction and stop the train behind the burst
+    for (int switch_num = 1; switch_num <= 18; ++switch_num) {
+      rethrow_switch(train_tid, switch_num);
+    }
+
+    for (int switch_num = 153; switch_num <= 156; ++switch_num) {
+      rethrow_switch(train_tid, switch_num);
+    }
+
+    TrainSetSpeed(train_tid, train_number, 0);
+
+    // the stop should overtake the switches, give the whole burst time to go out
+    Delay(WhoIs("clock_server"), 100);
+
+    struct DispatchStats stats;
+    DispatchGetStats(WhoIs("train_dispatch"), &stats);
+    TerminalUpdateStatus(
+        terminal->screen_tid,
+        "Stop sent after %u us, switches after up to %u us",
+        stats.latency_last[DISPATCH_LANE_STOP],
+        stats.latency_max[DISPATCH_LANE_SWITCH]
+    );
   } else if (strcmp("calib", command_name)) {
     char *str_train_number = strtok_r(NULL, CHAR_DELIMITER, &saveptr);
     if (!str_train_number || !is_number(str_train_number)) {
@@ -431,41 +471,3 @@ bool terminal_execute_command(
 
   return false;
 }
-
-void terminal_clear_command_buffer(struct Terminal *terminal) {
-  terminal->command_len = 0;
-}
-
-bool terminal_handle_keypress(
-    struct Terminal *terminal,
-    int train_tid,
-    int train_calib_tid,
-    int train_manager_tid,
-    char c
-) {
-  if (c == CHAR_COMMAND_END) {
-    terminal->command_buffer[terminal->command_len] = '\0';
-    bool exit = terminal_execute_command(
-        terminal, train_tid, train_calib_tid, train_manager_tid, terminal->command_buffer
-    );
-    terminal_clear_command_buffer(terminal);
-    TerminalUpdateCommand(terminal->screen_tid, terminal->command_buffer, terminal->command_len);
-    return exit;
-  }
-
-  if (c == CHAR_BACKSPACE && terminal->command_len > 0) {
-    --terminal->command_len;
-    TerminalUpdateCommand(terminal->screen_tid, terminal->command_buffer, terminal->command_len);
-    return false;
-  }
-
-  // Clear command buffer if command length exceeds buffer size - 1.
-  // Last char must be null terminator.
-  if (terminal->command_len == COMMAND_BUFFER_SIZE - 1) {
-    terminal_clear_command_buffer(terminal);
-  }
-
-  terminal->command_buffer[terminal->command_len++] = c;
-  TerminalUpdateCommand(terminal->screen_tid, terminal->command_buffer, terminal->command_len);
-  return false;
-}
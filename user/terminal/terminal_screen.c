@@ -16,12 +16,19 @@ static const char SEQ_CURSOR_MOVE_TOP_LEFT[] = "\033[H";
 
 const char TEXT_RESET[] = "\033[0m";
 
+// longer writes are sent straight from our buffer so redraws are never cut off by the tx buffer
+static const size_t SYNC_WRITE_THRESHOLD = 256;
+
 void terminal_putc(struct TerminalScreen *screen, char ch) {
   Putc(screen->console_tx, ch);
 }
 
 void terminal_putl(struct TerminalScreen *screen, const char *buf, size_t blen) {
-  Putl(screen->console_tx, (const unsigned char *) buf, blen);
+  if (blen >= SYNC_WRITE_THRESHOLD) {
+    PutlSync(screen->console_tx, (const unsigned char *) buf, blen);
+  } else {
+    Putl(screen->console_tx, (const unsigned char *) buf, blen);
+  }
 }
 
 int terminal_puts(struct TerminalScreen *screen, const char *str) {
@@ -5,6 +5,7 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "user/server/io_buffer.h"
 #include "user/train/trainset.h"
 #include "user/train/trainset_calib_data.h"
 
@@ -39,6 +40,7 @@ struct TerminalView {
   void (*update_zone_reservation)(struct TerminalScreen *, int, int, int);
   void (*update_selected_track)(struct TerminalScreen *, char);
   void (*init_train_zones)(struct TerminalScreen *, char);
+  void (*update_io_stats)(struct TerminalScreen *, struct IOStats *);
   // void (*print_next_sensor)(struct TerminalScreen *, int);
 };
 
@@ -172,6 +174,10 @@ inline void terminal_init_train_zones(struct TerminalScreen *screen, char track)
   screen->view.init_train_zones(screen, track);
 }
 
+inline void terminal_update_io_stats(struct TerminalScreen *screen, struct IOStats *stats) {
+  screen->view.update_io_stats(screen, stats);
+}
+
 inline void terminal_print_loop_time(
     struct TerminalScreen *screen,
     int train,
@@ -10,6 +10,7 @@
 #include "user/server/io_server.h"
 #include "user/server/name_server.h"
 #include "user/train/train_calibrator.h"
+#include "user/train/train_sensor_notifier.h"
 
 const int TERMINAL_TASK_PRIORITY = 4;
 
@@ -17,9 +18,15 @@ void terminal_key_press_task() {
   int terminal = MyParentTid();
   int console_rx = WhoIs("console_io_rx");
 
+  // the rx server echoes and edits the command line, we only see complete commands
+  IOSetCanonical(console_rx, true, WhoIs("console_io_tx"), SHELL_COMMAND_ROW, SHELL_COMMAND_COL);
+
+  char command[COMMAND_BUFFER_SIZE];
   while (true) {
-    char ch = Getc(console_rx);
-    Send(terminal, (const char *) &ch, sizeof(ch), NULL, 0);
+    int len = GetLine(console_rx, command, sizeof(command));
+    if (len >= 0) {
+      Send(terminal, command, len + 1, NULL, 0);
+    }
   }
 }
 
@@ -35,10 +42,32 @@ void terminal_time_update_task() {
   }
 }
 
+void terminal_io_stats_task() {
+  int terminal = MyParentTid();
+  int clock_server = WhoIs("clock_server");
+
+  int io_servers[TERMINAL_IO_LINES] = {
+      WhoIs("console_io_tx"), WhoIs("console_io_rx"), WhoIs("marklin_io_tx"), WhoIs("marklin_io_rx")
+  };
+  struct IOStats stats[TERMINAL_IO_LINES];
+
+  while (true) {
+    // 1s
+    Delay(clock_server, 100);
+
+    for (int i = 0; i < TERMINAL_IO_LINES; ++i) {
+      IOGetStats(io_servers[i], &stats[i]);
+    }
+
+    TerminalUpdateIOStats(terminal, stats);
+  }
+}
+
 void terminal_screen_task() {
   RegisterAs("terminal");
 
   Create(TERMINAL_TASK_PRIORITY, terminal_time_update_task);
+  Create(TERMINAL_TASK_PRIORITY, terminal_io_stats_task);
 
   int console_tx = WhoIs("console_io_tx");
 
@@ -46,6 +75,10 @@ void terminal_screen_task() {
   struct TerminalView shell_view = shell_view_create();
   terminal_screen_init(&screen, console_tx, shell_view);
 
+  // rebuilt from the sensor events, the view shows every contact that is closed
+  bool sensors[TRAINSET_SENSORS_LEN] = {0};
+  SensorSubscribe(WhoIs("sensor_pub"), TerminalUpdateSensors, MyTid());
+
   int tid;
   struct TerminalRequest req;
   while (true) {
@@ -59,10 +92,13 @@ void terminal_screen_task() {
         );
         break;
       case UPDATE_SENSORS:
-        terminal_update_sensors(
-            &screen, req.update_sensors_req.sensors, req.update_sensors_req.sensors_len
-        );
+        for (int i = 0; i < req.update_sensors_req.len; ++i) {
+          struct SensorEvent *event = &req.update_sensors_req.events[i];
+          sensors[event->sensor] = event->triggered;
+        }
+
         Reply(tid, NULL, 0);
+        terminal_update_sensors(&screen, sensors, TRAINSET_SENSORS_LEN);
         break;
       case UPDATE_STATUS:
         terminal_update_status_va(&screen, req.update_status_req.fmt, req.update_status_req.va);
@@ -150,6 +186,10 @@ void terminal_screen_task() {
         );
         Reply(tid, NULL, 0);
         break;
+      case UPDATE_IO_STATS:
+        terminal_update_io_stats(&screen, req.update_io_stats_req.stats);
+        Reply(tid, NULL, 0);
+        break;
     }
   }
 }
@@ -166,11 +206,13 @@ void terminal_task() {
   terminal_init(&terminal, terminal_screen);
 
   int tid;
-  char ch;
+  char command[COMMAND_BUFFER_SIZE];
   while (true) {
-    Receive(&tid, (char *) &ch, sizeof(ch));
+    Receive(&tid, command, sizeof(command));
 
-    if (terminal_handle_keypress(&terminal, train_tid, train_calib_tid, train_manager_tid, ch)) {
+    if (terminal_execute_command(
+            &terminal, train_tid, train_calib_tid, train_manager_tid, command
+        )) {
       TerminalUpdateStatus(terminal_screen, "Exited.");
       Exit();
     }
@@ -189,9 +231,9 @@ void TerminalUpdateTrainSpeed(int tid, int train_index, uint8_t train_speed) {
   Send(tid, (const char *) &req, sizeof(req), NULL, 0);
 }
 
-void TerminalUpdateSensors(int tid, bool *sensors, size_t sensors_len) {
+void TerminalUpdateSensors(int tid, struct SensorEvent *events, int len) {
   struct TerminalRequest req = {
-      .type = UPDATE_SENSORS, .update_sensors_req = {.sensors = sensors, .sensors_len = sensors_len}
+      .type = UPDATE_SENSORS, .update_sensors_req = {.events = events, .len = len}
   };
   Send(tid, (const char *) &req, sizeof(req), NULL, 0);
 }
@@ -200,8 +242,11 @@ void TerminalUpdateStatus(int tid, char *fmt, ...) {
   va_list va;
 
   va_start(va, fmt);
-  struct TerminalRequest req = {.type = UPDATE_STATUS, .update_status_req = {.fmt = fmt, .va = va}};
+  // va_copy since va_list is an array on some targets and cannot be assigned
+  struct TerminalRequest req = {.type = UPDATE_STATUS, .update_status_req = {.fmt = fmt}};
+  va_copy(req.update_status_req.va, va);
   Send(tid, (const char *) &req, sizeof(req), NULL, 0);
+  va_end(req.update_status_req.va);
   va_end(va);
 }
 
@@ -209,8 +254,10 @@ void TerminalLogPrint(int tid, char *fmt, ...) {
   va_list va;
 
   va_start(va, fmt);
-  struct TerminalRequest req = {.type = LOG_PRINT, .log_print_req = {.fmt = fmt, .va = va}};
+  struct TerminalRequest req = {.type = LOG_PRINT, .log_print_req = {.fmt = fmt}};
+  va_copy(req.log_print_req.va, va);
   Send(tid, (const char *) &req, sizeof(req), NULL, 0);
+  va_end(req.log_print_req.va);
   va_end(va);
 }
 
@@ -307,6 +354,11 @@ void TerminalUpdateTrainInfo(
   Send(tid, (const char *) &req, sizeof(req), NULL, 0);
 }
 
+void TerminalUpdateIOStats(int tid, struct IOStats *stats) {
+  struct TerminalRequest req = {.type = UPDATE_IO_STATS, .update_io_stats_req = {.stats = stats}};
+  Send(tid, (const char *) &req, sizeof(req), NULL, 0);
+}
+
 void TerminalUpdateSelectedTrack(int tid, char track) {
   struct TerminalRequest req = {
       .type = UPDATE_SELECTED_TRACK, .update_selected_track_req = {.track = track}
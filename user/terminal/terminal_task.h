@@ -4,6 +4,8 @@
 #include <stdint.h>
 
 #include "terminal.h"
+#include "user/server/io_buffer.h"
+#include "user/train/sensor_publisher.h"
 #include "user/train/trainset.h"
 #include "user/train/trainset_calib_data.h"
 
@@ -21,7 +23,8 @@ enum TerminalRequestType {
   TERMINAL_DISTANCE,
   TERMINAL_TIME_LOOP,
   LOG_PRINT,
-  TERMINAL_ZONE_RESERVATION
+  TERMINAL_ZONE_RESERVATION,
+  UPDATE_IO_STATS
 };
 
 // struct VelocityMeasurementInfo{
@@ -41,8 +44,8 @@ struct TerminalUpdateZoneReservationRequest {
 };
 
 struct TerminalUpdateSensorsRequest {
-  bool *sensors;
-  size_t sensors_len;
+  struct SensorEvent *events;
+  int len;
 };
 
 struct TerminalUpdateIdleRequest {
@@ -67,6 +70,7 @@ struct TerminalUpdateSwitchRequest {
 };
 
 struct TerminalUpdateMaxSensorDurationRequest {
+  // in microseconds
   unsigned int duration;
 };
 
@@ -105,6 +109,13 @@ struct TerminalUpdateSelectedTrackRequest {
   char track;
 };
 
+// console tx, console rx, marklin tx, marklin rx
+#define TERMINAL_IO_LINES 4
+
+struct TerminalUpdateIOStatsRequest {
+  struct IOStats *stats;
+};
+
 struct TerminalRequest {
   enum TerminalRequestType type;
 
@@ -125,13 +136,14 @@ struct TerminalRequest {
     struct TerminalUpdateSelectedTrackRequest update_selected_track_req;
     struct TerminalLogPrintRequest log_print_req;
     struct TerminalUpdateZoneReservationRequest update_zone_reservation_req;
+    struct TerminalUpdateIOStatsRequest update_io_stats_req;
   };
 };
 
 extern const int TERMINAL_TASK_PRIORITY;
 
 void TerminalUpdateTrainSpeed(int tid, int train_index, uint8_t train_speed);
-void TerminalUpdateSensors(int tid, bool *sensors, size_t sensors_len);
+void TerminalUpdateSensors(int tid, struct SensorEvent *events, int len);
 void TerminalUpdateStatus(int tid, char *status, ...);
 void TerminalUpdateSwitchState(int tid, int switch_num, enum SwitchDirection dir);
 void TerminalUpdateMaxSensorDuration(int tid, unsigned int duration);
@@ -163,3 +175,4 @@ void TerminalLogPrint(int tid, char *fmt, ...);
 void terminal_task();
 void terminal_screen_task();
 void TerminalUpdateZoneReservation(int tid, int zone, int train, int type);
+void TerminalUpdateIOStats(int tid, struct IOStats *stats);
@@ -0,0 +1,526 @@
+#include "bench_suite.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "circular_buffer.h"
+#include "irq.h"
+#include "kernel_config.h"
+#include "pmu.h"
+#include "rpi.h"
+#include "spsc_ring.h"
+#include "syscall.h"
+#include "timer.h"
+#include "user/server/clock_server.h"
+#include "user/server/io_server.h"
+#include "user/server/name_server.h"
+#include "util.h"
+
+// each case runs in its own task above the tasks it spawns, so they only start once
+// everything has been created and the case task blocks waiting for them to finish
+static const int BENCH_CASE_PRIORITY = 60;
+static const int BENCH_TASK_PRIORITY = 50;
+
+#define BENCH_ITERATIONS 1000
+// each sample is a timer tick
+#define BENCH_AWAIT_ITERATIONS 100
+#define BENCH_SENDERS_MAX 16
+#define BENCH_MSG_SIZE_MAX 256
+
+#define INPUT_BUFFER_SIZE 32
+
+#define BENCH_CONSOLE_RUNS 16
+#define BENCH_CONSOLE_LEN 1024
+
+// a dump takes ~46ms on the wire at 2400 baud
+#define BENCH_SENSOR_ITERATIONS 100
+#define BENCH_SENSOR_DUMP_LEN 10
+// ticks to wait for a dump before deciding nothing is attached to the marklin line
+#define BENCH_SENSOR_TIMEOUT 100
+
+static const int SRR_MSG_SIZES[] = {4, 64, 256};
+static const int CONTENTION_SENDERS[] = {1, 2, 4, 8, 16};
+static const int BUFFER_CHUNK_SIZES[] = {1, 16, 64, 256};
+
+// every task writes its samples into its own slice, indexed by the order it was spawned in
+static uint64_t samples[BENCH_ITERATIONS * BENCH_SENDERS_MAX];
+
+// parameters for the case that is running, set by the runner before the case task is created
+static int bench_msg_size;
+static int bench_senders;
+static int bench_receiver;
+
+enum BenchSrrOrder { SRR_SEND_FIRST, SRR_RECEIVE_FIRST };
+static enum BenchSrrOrder bench_srr_order;
+
+static void sort(uint64_t *data, int len) {
+  // shell sort, no recursion and good enough for a few thousand samples
+  for (int gap = len / 2; gap > 0; gap /= 2) {
+    for (int i = gap; i < len; ++i) {
+      uint64_t val = data[i];
+      int j = i;
+
+      for (; j >= gap && data[j - gap] > val; j -= gap) {
+        data[j] = data[j - gap];
+      }
+
+      data[j] = val;
+    }
+  }
+}
+
+static void report(const char *name, int param, int len) {
+  sort(samples, len);
+
+  printf(
+      "%s,%d,%d,%u,%u,%u\r\n",
+      name,
+      param,
+      len,
+      (unsigned int) samples[0],
+      (unsigned int) samples[len / 2],
+      (unsigned int) samples[(len * 99) / 100]
+  );
+}
+
+// spawn a task for the running case and hand it its index, it runs once the case task blocks
+static int spawn(int priority, void (*function)(), int index) {
+  int tid = Create(priority, function);
+  Send(tid, (const char *) &index, sizeof(index), NULL, 0);
+  return tid;
+}
+
+static int get_index() {
+  int tid;
+  int index;
+
+  Receive(&tid, (char *) &index, sizeof(index));
+  Reply(tid, NULL, 0);
+  return index;
+}
+
+// wait for the spawned tasks to tell us they are done
+static void join(int count) {
+  int tid;
+
+  for (int i = 0; i < count; ++i) {
+    Receive(&tid, NULL, 0);
+    Reply(tid, NULL, 0);
+  }
+}
+
+static void done() {
+  Send(MyParentTid(), NULL, 0, NULL, 0);
+  Exit();
+}
+
+static void bench_null_syscall() {
+  for (int i = 0; i < BENCH_ITERATIONS; ++i) {
+    uint64_t start = pmu_cycles();
+    MyTid();
+    samples[i] = pmu_cycles() - start;
+  }
+
+  report("null_syscall", 0, BENCH_ITERATIONS);
+}
+
+static void bench_yield_task() {
+  int index = get_index();
+
+  // the partner does one more iteration so every measured yield switches tasks
+  for (int i = 0; i < BENCH_ITERATIONS + 1; ++i) {
+    uint64_t start = pmu_cycles();
+    Yield();
+
+    if (index == 0 && i < BENCH_ITERATIONS) {
+      samples[i] = pmu_cycles() - start;
+    }
+  }
+
+  done();
+}
+
+static void bench_yield() {
+  spawn(BENCH_TASK_PRIORITY, bench_yield_task, 0);
+  spawn(BENCH_TASK_PRIORITY, bench_yield_task, 1);
+  join(2);
+
+  // one sample is a switch to the partner and back
+  report("yield_pingpong", 0, BENCH_ITERATIONS);
+}
+
+static void bench_srr_receiver() {
+  get_index();
+
+  char msg[BENCH_MSG_SIZE_MAX];
+  int tid;
+
+  for (int i = 0; i < bench_senders * BENCH_ITERATIONS; ++i) {
+    Receive(&tid, msg, bench_msg_size);
+    Reply(tid, msg, bench_msg_size);
+  }
+
+  done();
+}
+
+static void bench_srr_sender() {
+  int index = get_index();
+
+  char msg[BENCH_MSG_SIZE_MAX] = {0};
+  char reply[BENCH_MSG_SIZE_MAX];
+
+  for (int i = 0; i < BENCH_ITERATIONS; ++i) {
+    uint64_t start = pmu_cycles();
+    Send(bench_receiver, msg, bench_msg_size, reply, bench_msg_size);
+    samples[index * BENCH_ITERATIONS + i] = pmu_cycles() - start;
+  }
+
+  done();
+}
+
+static void bench_srr() {
+  bench_senders = 1;
+
+  if (bench_srr_order == SRR_SEND_FIRST) {
+    // same priority, the sender is queued first and gets there before the receiver every time
+    spawn(BENCH_TASK_PRIORITY, bench_srr_sender, 0);
+    bench_receiver = spawn(BENCH_TASK_PRIORITY, bench_srr_receiver, 0);
+  } else {
+    // the receiver runs first and is always blocked in Receive when the sender sends
+    bench_receiver = spawn(BENCH_TASK_PRIORITY + 1, bench_srr_receiver, 0);
+    spawn(BENCH_TASK_PRIORITY, bench_srr_sender, 0);
+  }
+
+  join(2);
+
+  report(
+      bench_srr_order == SRR_SEND_FIRST ? "srr_send_first" : "srr_receive_first",
+      bench_msg_size,
+      BENCH_ITERATIONS
+  );
+}
+
+static void bench_exit_task() {
+  Exit();
+}
+
+static void bench_create_exit() {
+  for (int i = 0; i < BENCH_ITERATIONS; ++i) {
+    uint64_t start = pmu_cycles();
+    // higher priority so it runs and exits before Create returns
+    Create(BENCH_CASE_PRIORITY + 1, bench_exit_task);
+    samples[i] = pmu_cycles() - start;
+  }
+
+  report("create_exit", 0, BENCH_ITERATIONS);
+}
+
+static void bench_await_event() {
+  for (int i = 0; i < BENCH_AWAIT_ITERATIONS; ++i) {
+    AwaitEvent(EVENT_TIMER);
+    samples[i] = pmu_cycles() - irq_get_event_cycles(EVENT_TIMER);
+  }
+
+  // the clock notifier is also woken by the tick and runs first
+  report("await_event", 0, BENCH_AWAIT_ITERATIONS);
+}
+
+static void bench_contention() {
+  bench_msg_size = 4;
+  bench_receiver = spawn(BENCH_TASK_PRIORITY, bench_srr_receiver, 0);
+
+  for (int i = 0; i < bench_senders; ++i) {
+    spawn(BENCH_TASK_PRIORITY, bench_srr_sender, i);
+  }
+
+  join(bench_senders + 1);
+
+  report("contention", bench_senders, bench_senders * BENCH_ITERATIONS);
+}
+
+static struct CircularBuffer bench_buffer;
+
+static void bench_buffer_copy() {
+  unsigned char chunk[BENCH_MSG_SIZE_MAX] = {0};
+
+  // the buffer is never full or empty, so every chunk moves in full and half of them wrap once
+  // the head and tail have drifted apart
+  circular_buffer_init(&bench_buffer);
+  circular_buffer_write_n(&bench_buffer, chunk, BUFFER_CAPACITY / 2);
+
+  for (int i = 0; i < BENCH_ITERATIONS; ++i) {
+    uint64_t start = pmu_cycles();
+    circular_buffer_write_n(&bench_buffer, chunk, bench_msg_size);
+    circular_buffer_read_n(&bench_buffer, chunk, bench_msg_size);
+    samples[i] = pmu_cycles() - start;
+  }
+
+  // one sample is a write and a read of the chunk, divide by param for cycles per byte
+  report("buffer_copy", bench_msg_size, BENCH_ITERATIONS);
+}
+
+static struct SpscRing bench_ring;
+static int bench_ring_errors;
+
+static void bench_ring_producer() {
+  get_index();
+
+  unsigned char chunk[BENCH_MSG_SIZE_MAX];
+  unsigned char seq = 0;
+
+  for (int i = 0; i < BENCH_ITERATIONS; ++i) {
+    for (int j = 0; j < bench_msg_size; ++j) {
+      chunk[j] = seq++;
+    }
+
+    // only the time spent in the ring is counted, not the yields while it is full
+    uint64_t cycles = 0;
+    for (int written = 0; written < bench_msg_size;) {
+      uint64_t start = pmu_cycles();
+      written += spsc_ring_write(&bench_ring, chunk + written, bench_msg_size - written);
+      cycles += pmu_cycles() - start;
+
+      if (written < bench_msg_size) {
+        Yield();
+      }
+    }
+
+    samples[i] = cycles;
+  }
+
+  done();
+}
+
+static void bench_ring_consumer() {
+  get_index();
+
+  unsigned char chunk[BENCH_MSG_SIZE_MAX];
+  unsigned char seq = 0;
+
+  for (int remaining = bench_msg_size * BENCH_ITERATIONS; remaining > 0;) {
+    int len = spsc_ring_read(&bench_ring, chunk, min(remaining, BENCH_MSG_SIZE_MAX));
+    if (len == 0) {
+      Yield();
+      continue;
+    }
+
+    // bytes have to come out in the order they went in
+    for (int i = 0; i < len; ++i) {
+      if (chunk[i] != seq++) {
+        ++bench_ring_errors;
+      }
+    }
+
+    remaining -= len;
+  }
+
+  done();
+}
+
+static void bench_ring_transfer() {
+  spsc_ring_init(&bench_ring);
+  bench_ring_errors = 0;
+
+  spawn(BENCH_TASK_PRIORITY, bench_ring_producer, 0);
+  spawn(BENCH_TASK_PRIORITY, bench_ring_consumer, 0);
+  join(2);
+
+  if (bench_ring_errors > 0) {
+    printf("bench: spsc ring corrupted %d bytes\r\n", bench_ring_errors);
+  }
+
+  // one sample is writing a chunk into the ring, divide by param for cycles per byte
+  report("spsc_ring", bench_msg_size, BENCH_ITERATIONS);
+}
+
+static unsigned char bench_console_data[BENCH_CONSOLE_LEN];
+
+static void bench_console() {
+  int console_tx = WhoIs("console_io_tx");
+
+  // rows of dots so the output does not garble the terminal
+  for (int i = 0; i < BENCH_CONSOLE_LEN; ++i) {
+    bench_console_data[i] = i % 64 == 62 ? '\r' : i % 64 == 63 ? '\n' : '.';
+  }
+
+  // the first write only fills the fifo, every write after it is paced by the uart
+  PutlSync(console_tx, bench_console_data, BENCH_CONSOLE_LEN);
+
+  for (int i = 0; i < BENCH_CONSOLE_RUNS; ++i) {
+    uint64_t start = timer_get_time();
+    PutlSync(console_tx, bench_console_data, BENCH_CONSOLE_LEN);
+    samples[i] = (BENCH_CONSOLE_LEN * 1000000ULL) / (timer_get_time() - start);
+  }
+
+  // wait for the fifo to empty so the results are not interleaved with the dots
+  Delay(WhoIs("clock_server"), 10);
+
+  // samples are bytes per second, compare against baud / 10
+  report("console_putl_sync", CONFIG_CONSOLE_BAUD, BENCH_CONSOLE_RUNS);
+}
+
+// same as the dispatcher's read of every feedback module
+static const unsigned char BENCH_SENSOR_READ_ALL = 0x80 + 5;
+
+static void bench_sensor_query() {
+  int marklin_tx = WhoIs("marklin_io_tx");
+  int marklin_rx = WhoIs("marklin_io_rx");
+
+  unsigned char dump[BENCH_SENSOR_DUMP_LEN];
+
+  for (int i = 0; i < BENCH_SENSOR_ITERATIONS; ++i) {
+    uint64_t start = pmu_cycles();
+    Putc(marklin_tx, BENCH_SENSOR_READ_ALL);
+    int len = GetN(marklin_rx, dump, BENCH_SENSOR_DUMP_LEN, BENCH_SENSOR_TIMEOUT);
+    samples[i] = pmu_cycles() - start;
+
+    if (len < BENCH_SENSOR_DUMP_LEN) {
+      printf("bench: no sensor dump from marklin\r\n");
+      return;
+    }
+  }
+
+  // the wire time is the same for every kernel, compare against the previous build's numbers
+  report("sensor_query", BENCH_SENSOR_DUMP_LEN, BENCH_SENSOR_ITERATIONS);
+}
+
+static void (*bench_case)();
+
+static void bench_case_task() {
+  bench_case();
+
+  // let the runner continue
+  Send(MyParentTid(), NULL, 0, NULL, 0);
+  Exit();
+}
+
+static void run(void (*function)()) {
+  int tid;
+
+  bench_case = function;
+  Create(BENCH_CASE_PRIORITY, bench_case_task);
+
+  // wait for the case to finish
+  Receive(&tid, NULL, 0);
+  Reply(tid, NULL, 0);
+}
+
+static void run_srr() {
+  for (unsigned int i = 0; i < sizeof(SRR_MSG_SIZES) / sizeof(SRR_MSG_SIZES[0]); ++i) {
+    bench_msg_size = SRR_MSG_SIZES[i];
+
+    bench_srr_order = SRR_SEND_FIRST;
+    run(bench_srr);
+    bench_srr_order = SRR_RECEIVE_FIRST;
+    run(bench_srr);
+  }
+}
+
+static void run_contention() {
+  for (unsigned int i = 0; i < sizeof(CONTENTION_SENDERS) / sizeof(CONTENTION_SENDERS[0]); ++i) {
+    bench_senders = CONTENTION_SENDERS[i];
+    run(bench_contention);
+  }
+}
+
+static void run_buffer() {
+  for (unsigned int i = 0; i < sizeof(BUFFER_CHUNK_SIZES) / sizeof(BUFFER_CHUNK_SIZES[0]); ++i) {
+    bench_msg_size = BUFFER_CHUNK_SIZES[i];
+    run(bench_buffer_copy);
+  }
+}
+
+static void run_ring() {
+  for (unsigned int i = 0; i < sizeof(BUFFER_CHUNK_SIZES) / sizeof(BUFFER_CHUNK_SIZES[0]); ++i) {
+    bench_msg_size = BUFFER_CHUNK_SIZES[i];
+    run(bench_ring_transfer);
+  }
+}
+
+static bool run_case(char *name) {
+  bool all = strcmp(name, "all") == 0;
+  bool found = all;
+
+  printf("case,param,samples,min,median,p99\r\n");
+
+  if (all || strcmp(name, "null") == 0) {
+    run(bench_null_syscall);
+    found = true;
+  }
+
+  if (all || strcmp(name, "yield") == 0) {
+    run(bench_yield);
+    found = true;
+  }
+
+  if (all || strcmp(name, "srr") == 0) {
+    run_srr();
+    found = true;
+  }
+
+  if (all || strcmp(name, "create") == 0) {
+    run(bench_create_exit);
+    found = true;
+  }
+
+  if (all || strcmp(name, "await") == 0) {
+    run(bench_await_event);
+    found = true;
+  }
+
+  if (all || strcmp(name, "contention") == 0) {
+    run_contention();
+    found = true;
+  }
+
+  if (all || strcmp(name, "buffer") == 0) {
+    run_buffer();
+    found = true;
+  }
+
+  if (all || strcmp(name, "ring") == 0) {
+    run_ring();
+    found = true;
+  }
+
+  if (all || strcmp(name, "console") == 0) {
+    run(bench_console);
+    found = true;
+  }
+
+  // needs the marklin box or marklin_emu on the other end of the line, not part of all
+  if (strcmp(name, "sensor") == 0) {
+    run(bench_sensor_query);
+    found = true;
+  }
+
+  return found;
+}
+
+void bench_task() {
+  int console_rx = WhoIs("console_io_rx");
+
+  char input[INPUT_BUFFER_SIZE];
+
+  while (true) {
+    printf(
+        "bench: enter a case (all, null, yield, srr, create, await, contention, buffer, ring, "
+        "console, sensor)\r\n> "
+    );
+
+    int len = 0;
+    for (char ch = Getc(console_rx); ch != '\r'; ch = Getc(console_rx)) {
+      if (len < INPUT_BUFFER_SIZE - 1) {
+        input[len++] = ch;
+        printf("%c", ch);
+      }
+    }
+    input[len] = '\0';
+    printf("\r\n");
+
+    // all results are in cycles
+    if (!run_case(input)) {
+      printf("bench: unknown case %s\r\n", input);
+    }
+  }
+}
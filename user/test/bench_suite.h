@@ -0,0 +1,4 @@
+#pragma once
+
+// reads a case name from the console and prints its results as csv, in cycles
+void bench_task();
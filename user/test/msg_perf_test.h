@@ -1,5 +0,0 @@
-#pragma once
-
-void msg_perf_test();
-void msg_perf_server();
-void msg_perf_spawner();
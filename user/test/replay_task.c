@@ -14,11 +14,8 @@
 #define TRAINSET_NUM_FEEDBACK_MODULES 5
 #define TRAINSET_NUM_SENSORS_PER_MODULE 16
 
-// static const int CMD_READ_ALL_SENSORS = 0x80 + TRAINSET_NUM_FEEDBACK_MODULES;
-static const unsigned char CMD_READ_ALL_SENSORS[] = {0x80 + TRAINSET_NUM_FEEDBACK_MODULES};
-
 static void read_sensor_data(int train_dispatcher) {
-  DispatchTrainCommand(train_dispatcher, CMD_READ_ALL_SENSORS, 1);
+  DispatchTrainCommand(train_dispatcher, MARKLIN_CMD_SENSOR_READ, 0, 0);
 }
 
 static void process_sensor_data(struct CircularBuffer *buffer, bool *sensors_occupied) {
@@ -58,7 +55,7 @@ void replay_task() {
   // int console_rx = WhoIs("console_io_rx");
   // int console_tx = WhoIs("console_io_tx");
   int marklin_rx = WhoIs("marklin_io_rx");
-  int train_dispatch = WhoIs("marklin_io_tx");
+  int train_dispatch = WhoIs("train_dispatch");
 
   struct Trainset trainset;
   trainset_init(&trainset, train_dispatch);
@@ -97,9 +94,6 @@ void replay_task() {
       circular_buffer_write(&rx_buffer, marklin_ch);
     }
 
-    printf("notify marklin read\r\n");
-    NotifyMarklinRead(train_dispatch);
-
     printf("got train data!\r\n");
     process_sensor_data(&rx_buffer, sensors);
 
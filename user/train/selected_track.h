@@ -1,5 +1,9 @@
 #pragma once
 
 #include "trackdata/track_data.h"
+#include "trackdata/track_graph.h"
 
-extern struct TrackNode track[TRACK_MAX];
+// TRACKA_NODES or TRACKB_NODES
+extern const struct TrackNode *track;
+// the same track, TRACKA_GRAPH or TRACKB_GRAPH
+extern const struct TrackGraph *track_graph;
@@ -0,0 +1,173 @@
+#include "sensor_publisher.h"
+
+#include <stddef.h>
+
+#include "syscall.h"
+#include "user/server/name_server.h"
+
+const int SENSOR_PUBLISHER_PRIORITY = 18;
+
+// events kept for subscribers that are behind, a subscriber further behind skips the oldest ones
+#define SENSOR_EVENTS_MAX 256
+#define SENSOR_SUBSCRIBERS_MAX 8
+
+enum SensorPublisherRequestType { SENSOR_PUBLISH, SENSOR_SUBSCRIBE, SENSOR_AWAIT };
+
+struct SensorPublishRequest {
+  struct SensorEvent *events;
+  int len;
+};
+
+struct SensorAwaitRequest {
+  // sequence number of the next event the subscriber wants, -1 for the next one published
+  int cursor;
+};
+
+struct SensorPublisherRequest {
+  enum SensorPublisherRequestType type;
+
+  union {
+    struct SensorPublishRequest publish_req;
+    struct SensorAwaitRequest await_req;
+  };
+};
+
+struct SensorEventBatch {
+  // cursor for the next await
+  int cursor;
+  int len;
+  struct SensorEvent events[SENSOR_EVENT_BATCH_MAX];
+};
+
+struct SensorSubscription {
+  int publisher;
+  SensorEventHandler handler;
+  int consumer;
+};
+
+struct SensorWaiter {
+  int tid;
+  int cursor;
+};
+
+void sensor_subscriber_courier() {
+  int tid;
+  struct SensorSubscription sub;
+  Receive(&tid, (char *) &sub, sizeof(sub));
+  Reply(tid, NULL, 0);
+
+  struct SensorPublisherRequest req = {.type = SENSOR_AWAIT, .await_req = {.cursor = -1}};
+  struct SensorEventBatch batch;
+  while (true) {
+    Send(sub.publisher, (const char *) &req, sizeof(req), (char *) &batch, sizeof(batch));
+    req.await_req.cursor = batch.cursor;
+
+    if (batch.len > 0) {
+      sub.handler(sub.consumer, batch.events, batch.len);
+    }
+  }
+}
+
+// replies with the events from cursor onwards, next is the sequence number of the next event
+static void sensor_publisher_reply(struct SensorEvent *events, int next, int tid, int cursor) {
+  struct SensorEventBatch batch = {.len = 0};
+
+  // the oldest events have been overwritten
+  if (next - cursor > SENSOR_EVENTS_MAX) {
+    cursor = next - SENSOR_EVENTS_MAX;
+  }
+
+  while (cursor < next && batch.len < SENSOR_EVENT_BATCH_MAX) {
+    batch.events[batch.len++] = events[cursor++ % SENSOR_EVENTS_MAX];
+  }
+
+  batch.cursor = cursor;
+  Reply(tid, (const char *) &batch, sizeof(batch));
+}
+
+void sensor_publisher_task() {
+  RegisterAs("sensor_pub");
+
+  struct SensorEvent events[SENSOR_EVENTS_MAX];
+  // sequence number of the next event to be published
+  int next = 0;
+
+  // every subscriber's courier can be waiting at once, so there are never more than this many
+  int subscribers = 0;
+  // subscribers that are up to date and waiting for the next event
+  struct SensorWaiter waiters[SENSOR_SUBSCRIBERS_MAX];
+  int waiters_len = 0;
+
+  int tid;
+  struct SensorPublisherRequest req;
+  while (true) {
+    Receive(&tid, (char *) &req, sizeof(req));
+
+    switch (req.type) {
+      case SENSOR_PUBLISH:
+        for (int i = 0; i < req.publish_req.len; ++i) {
+          events[next++ % SENSOR_EVENTS_MAX] = req.publish_req.events[i];
+        }
+
+        // the publisher is let go before any subscriber is served
+        Reply(tid, NULL, 0);
+
+        for (int i = 0; i < waiters_len; ++i) {
+          sensor_publisher_reply(events, next, waiters[i].tid, waiters[i].cursor);
+        }
+
+        waiters_len = 0;
+        break;
+      case SENSOR_SUBSCRIBE: {
+        int ret = -1;
+        if (subscribers < SENSOR_SUBSCRIBERS_MAX) {
+          ++subscribers;
+          ret = 0;
+        }
+
+        Reply(tid, (const char *) &ret, sizeof(ret));
+        break;
+      }
+      case SENSOR_AWAIT: {
+        int cursor = req.await_req.cursor < 0 ? next : req.await_req.cursor;
+
+        if (cursor < next) {
+          sensor_publisher_reply(events, next, tid, cursor);
+        } else {
+          waiters[waiters_len].tid = tid;
+          waiters[waiters_len].cursor = cursor;
+          ++waiters_len;
+        }
+        break;
+      }
+    }
+  }
+}
+
+int SensorPublish(int tid, struct SensorEvent *events, int len) {
+  struct SensorPublisherRequest req = {
+      .type = SENSOR_PUBLISH, .publish_req = {.events = events, .len = len}
+  };
+  return Send(tid, (const char *) &req, sizeof(req), NULL, 0) < 0 ? -1 : 0;
+}
+
+int SensorSubscribe(int tid, SensorEventHandler handler, int consumer) {
+  struct SensorPublisherRequest req = {.type = SENSOR_SUBSCRIBE};
+  int ret;
+  if (Send(tid, (const char *) &req, sizeof(req), (char *) &ret, sizeof(ret)) < 0) {
+    return -1;
+  }
+
+  if (ret < 0) {
+    return -2;
+  }
+
+  int courier = Create(SENSOR_PUBLISHER_PRIORITY - 1, sensor_subscriber_courier);
+  if (courier < 0) {
+    return -1;
+  }
+
+  struct SensorSubscription sub = {.publisher = tid, .handler = handler, .consumer = consumer};
+  Send(courier, (const char *) &sub, sizeof(sub), NULL, 0);
+  return courier;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define SENSOR_EVENT_BATCH_MAX 16
+
+extern const int SENSOR_PUBLISHER_PRIORITY;
+
+// a sensor changing state between two polls
+struct SensorEvent {
+  // index into the track, (bucket - 'A') * 16 + contact - 1
+  uint8_t sensor;
+  // true when the contact closed, false when it opened again
+  bool triggered;
+  // middle of the sampling window the change happened in, in ticks. the window runs from the
+  // previous time the module's byte arrived to this one.
+  int time;
+  // half the sampling window in ticks, rounded up, the change happened within this much of time.
+  // -1 for the first sample, when there is no previous one.
+  int time_error;
+};
+
+// called from the subscriber's courier with every batch of events, consumer is the tid given to
+// SensorSubscribe
+typedef void (*SensorEventHandler)(int consumer, struct SensorEvent *events, int len);
+
+void sensor_publisher_task();
+
+/**
+ * tid is the sensor publisher. adds the events to the stream, they are copied before the call
+ * returns. the caller never waits on a subscriber.
+ *
+ * Return Value
+ * 0	success.
+ * -1	tid is not a valid sensor publisher.
+ */
+int SensorPublish(int tid, struct SensorEvent *events, int len);
+
+/**
+ * tid is the sensor publisher. creates a courier that calls handler(consumer, ...) with every
+ * event published from now on. a consumer that falls more than the publisher's backlog behind
+ * skips the events it missed, it only ever slows down its own courier.
+ *
+ * Return Value
+ * >0	tid of the courier.
+ * -1	tid is not a valid sensor publisher, or the courier could not be created.
+ * -2	the publisher already has as many subscribers as it can serve.
+ */
+int SensorSubscribe(int tid, SensorEventHandler handler, int consumer);
@@ -0,0 +1,91 @@
+#include "switch_snapshot.h"
+
+#include "util.h"
+
+struct SwitchBits {
+  uint64_t known[SWITCH_SNAPSHOT_WORDS];
+  uint64_t curved[SWITCH_SNAPSHOT_WORDS];
+};
+
+// two copies of the states, copies[version % 2] is the published one. the train task writes the
+// other copy and then moves the version on, so a reader never waits for it to finish. a reader
+// copies the published one and checks the version has not moved, the train task may have started
+// on that copy again.
+static struct {
+  uint32_t version __attribute__((aligned(CACHE_LINE_SIZE)));
+  struct SwitchBits copies[2];
+} published;
+
+static uint32_t load_acquire(const uint32_t *version) {
+  return __atomic_load_n(version, __ATOMIC_ACQUIRE);
+}
+
+static void store_release(uint32_t *version, uint32_t val) {
+  __atomic_store_n(version, val, __ATOMIC_RELEASE);
+}
+
+void switch_snapshot_reset() {
+  struct SwitchBits *next = &published.copies[(published.version + 1) % 2];
+
+  for (int i = 0; i < SWITCH_SNAPSHOT_WORDS; ++i) {
+    next->known[i] = 0;
+    next->curved[i] = 0;
+  }
+
+  store_release(&published.version, published.version + 1);
+}
+
+void switch_snapshot_publish(int switch_num, enum SwitchDirection direction) {
+  struct SwitchBits *current = &published.copies[published.version % 2];
+  struct SwitchBits *next = &published.copies[(published.version + 1) % 2];
+
+  for (int i = 0; i < SWITCH_SNAPSHOT_WORDS; ++i) {
+    next->known[i] = current->known[i];
+    next->curved[i] = current->curved[i];
+  }
+
+  int word = switch_num / 64;
+  uint64_t bit = (uint64_t) 1 << (switch_num % 64);
+
+  if (direction == DIRECTION_UNKNOWN) {
+    next->known[word] &= ~bit;
+  } else {
+    next->known[word] |= bit;
+  }
+
+  if (direction == DIRECTION_CURVED) {
+    next->curved[word] |= bit;
+  } else {
+    next->curved[word] &= ~bit;
+  }
+
+  store_release(&published.version, published.version + 1);
+}
+
+void switch_snapshot_take(struct SwitchSnapshot *snapshot) {
+  uint32_t version;
+
+  do {
+    version = load_acquire(&published.version);
+    struct SwitchBits *bits = &published.copies[version % 2];
+
+    for (int i = 0; i < SWITCH_SNAPSHOT_WORDS; ++i) {
+      snapshot->known[i] = bits->known[i];
+      snapshot->curved[i] = bits->curved[i];
+    }
+
+    // the copy is read before the version is looked at again
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+  } while (__atomic_load_n(&published.version, __ATOMIC_RELAXED) != version);
+}
+
+enum SwitchDirection switch_snapshot_get(const struct SwitchSnapshot *snapshot, int switch_num) {
+  int word = switch_num / 64;
+  uint64_t bit = (uint64_t) 1 << (switch_num % 64);
+
+  if (!(snapshot->known[word] & bit)) {
+    return DIRECTION_UNKNOWN;
+  }
+
+  return snapshot->curved[word] & bit ? DIRECTION_CURVED : DIRECTION_STRAIGHT;
+}
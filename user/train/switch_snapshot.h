@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "trainset.h"
+
+// 64 switches to a word
+#define SWITCH_SNAPSHOT_WORDS ((TRAINSET_NUM_MAX_SWITCHES + 63) / 64)
+
+// the switch states at one point in time. walks along the track take one and read switches from
+// it instead of asking the train task for each one.
+struct SwitchSnapshot {
+  // bit n is set once switch n has been set at all, and when it is curved
+  uint64_t known[SWITCH_SNAPSHOT_WORDS];
+  uint64_t curved[SWITCH_SNAPSHOT_WORDS];
+};
+
+// train task only, every switch is unknown again
+void switch_snapshot_reset();
+
+// train task only, publishes the switch's new direction. tasks that take a snapshot never wait on
+// this, and never see a switch half set.
+void switch_snapshot_publish(int switch_num, enum SwitchDirection direction);
+
+// any task, copies the switch states as of the last publish
+void switch_snapshot_take(struct SwitchSnapshot *snapshot);
+
+enum SwitchDirection switch_snapshot_get(const struct SwitchSnapshot *snapshot, int switch_num);
@@ -7,7 +7,7 @@
 
 struct Path {
   // nodes starting from destination
-  struct TrackNode *nodes[TRACK_MAX];
+  const struct TrackNode *nodes[TRACK_MAX];
   int directions[TRACK_MAX];
   int nodes_len;
   bool path_found;
@@ -1,21 +1,22 @@
 #include "track_position.h"
 
 #include "selected_track.h"
+#include "switch_snapshot.h"
 #include "trackdata/track_data.h"
+#include "trackdata/track_graph.h"
 #include "train_planner.h"
-#include "trainset_task.h"
 #include "util.h"
 
 struct TrackPosition track_position_random() {
-  struct TrackNode *node = &track[rand() % TRACK_MAX];
-  // struct TrackNode *node = &track[8];
+  int node = rand() % TRACK_MAX;
+  // int node = 8;
 
-  while (node->type != NODE_SENSOR) {
-    node = &track[rand() % TRACK_MAX];
+  while (track_graph_type(track_graph, node) != NODE_SENSOR) {
+    node = rand() % TRACK_MAX;
   }
 
   // TODO: generate random number for offset?
-  struct TrackPosition pos = {.node = node, .offset = 0};
+  struct TrackPosition pos = {.node = &track[node], .offset = 0};
   return pos;
 }
 
@@ -24,7 +25,7 @@ struct TrackPosition track_position_random() {
 
 // returns a track position with node relative to current position.
 struct TrainPosition train_position_add(struct TrainPosition pos, struct Path *path, int offset) {
-  struct TrackNode *node = pos.position.node;
+  const struct TrackNode *node = pos.position.node;
   int new_offset = pos.position.offset + offset;
   // index of node in path
   int node_index = -1;
@@ -45,29 +46,39 @@ struct TrainPosition train_position_add(struct TrainPosition pos, struct Path *p
   }
 
   int last_dir = DIR_AHEAD;
+  int graph_node = node->index;
 
   // we need path to determine the next node that we'll be on.
   // TODO: the DIR_REVERSE check is not ideal. we should pass the SimplePath in.
   while (node_index < path->nodes_len - 1 && path->directions[node_index] != DIR_REVERSE &&
-         node->edge[path->directions[node_index]].dist <= new_offset) {
+         track_graph_dist(track_graph, graph_node, path->directions[node_index]) <= new_offset) {
     int dir = path->directions[node_index];
 
-    new_offset -= node->edge[dir].dist;
-    node = node->edge[dir].dest;
+    new_offset -= track_graph_dist(track_graph, graph_node, dir);
+    graph_node = track_graph_dest(track_graph, graph_node, dir);
     last_dir = dir;
 
     ++node_index;
   }
 
   struct TrainPosition new_pos = {
-      .last_dir = last_dir, .position = {.node = node, .offset = new_offset}
+      .last_dir = last_dir, .position = {.node = &track[graph_node], .offset = new_offset}
   };
   return new_pos;
 }
 
+// the way the train goes over node, straight for anything that is not a branch
+static enum SwitchDirection get_switch_direction(struct SwitchSnapshot *switches, int node) {
+  return track_graph_type(track_graph, node) == NODE_BRANCH
+             ? switch_snapshot_get(switches, track_graph_num(track_graph, node))
+             : DIRECTION_STRAIGHT;
+}
+
 // returns a position relative to the same direction of pos
-struct TrainPosition train_position_subtract(struct TrainPosition pos, int train_tid, int offset) {
+struct TrainPosition train_position_subtract(struct TrainPosition pos, int offset) {
   struct TrackPosition track_pos = pos.position;
+  struct SwitchSnapshot switches;
+  switch_snapshot_take(&switches);
 
   int new_offset = track_pos.offset - offset;
   if (new_offset >= 0) {
@@ -75,7 +86,7 @@ struct TrainPosition train_position_subtract(struct TrainPosition pos, int train
     int last_dir = DIR_AHEAD;
 
     if (track_pos.node->type == NODE_BRANCH) {
-      last_dir = TrainGetSwitchState(train_tid, track_pos.node->num);
+      last_dir = switch_snapshot_get(&switches, track_pos.node->num);
     }
 
     struct TrainPosition new_pos = {.position = new_track_pos, .last_dir = last_dir};
@@ -86,26 +97,22 @@ struct TrainPosition train_position_subtract(struct TrainPosition pos, int train
   // we turn the offset into a positive offset in the opposite direction
   new_offset = offset - track_pos.offset;
 
-  struct TrackNode *cur_node = track_pos.node->reverse;
-  enum SwitchDirection next_dir = cur_node->type == NODE_BRANCH
-                                      ? TrainGetSwitchState(train_tid, cur_node->num)
-                                      : DIRECTION_STRAIGHT;
-  struct TrackEdge *next_edge =
-      &cur_node->edge[next_dir == DIRECTION_STRAIGHT ? DIR_AHEAD : DIR_CURVED];
-
-  while (new_offset >= next_edge->dist) {
-    new_offset -= next_edge->dist;
-    cur_node = next_edge->dest;
-    next_dir = cur_node->type == NODE_BRANCH ? TrainGetSwitchState(train_tid, cur_node->num)
-                                             : DIRECTION_STRAIGHT;
-    next_edge = &cur_node->edge[next_dir == DIRECTION_STRAIGHT ? DIR_AHEAD : DIR_CURVED];
+  int cur_node = track_graph_reverse(track_graph, track_pos.node->index);
+  enum SwitchDirection next_dir = get_switch_direction(&switches, cur_node);
+  int edge_dir = next_dir == DIRECTION_STRAIGHT ? DIR_AHEAD : DIR_CURVED;
+
+  while (new_offset >= track_graph_dist(track_graph, cur_node, edge_dir)) {
+    new_offset -= track_graph_dist(track_graph, cur_node, edge_dir);
+    cur_node = track_graph_dest(track_graph, cur_node, edge_dir);
+    next_dir = get_switch_direction(&switches, cur_node);
+    edge_dir = next_dir == DIRECTION_STRAIGHT ? DIR_AHEAD : DIR_CURVED;
   }
 
   // reverse offset direction
-  new_offset = next_edge->dist - new_offset;
-  struct TrackNode *node = next_edge->dest->reverse;
+  new_offset = track_graph_dist(track_graph, cur_node, edge_dir) - new_offset;
+  int node = track_graph_reverse(track_graph, track_graph_dest(track_graph, cur_node, edge_dir));
 
-  struct TrackPosition new_track_pos = {.node = node, .offset = new_offset};
+  struct TrackPosition new_track_pos = {.node = &track[node], .offset = new_offset};
   // next_dir is the direction to take from the current node.
   struct TrainPosition new_pos = {
       .position = new_track_pos, .last_dir = next_dir == DIRECTION_CURVED ? DIR_CURVED : DIR_AHEAD
@@ -113,13 +120,13 @@ struct TrainPosition train_position_subtract(struct TrainPosition pos, int train
   return new_pos;
 }
 
-struct TrainPosition train_position_reverse_node(struct TrainPosition pos, int train_tid) {
+struct TrainPosition train_position_reverse_node(struct TrainPosition pos) {
   struct TrainPosition reverse_pos = {
       .position = {.node = pos.position.node->reverse, .offset = 0}, .last_dir = DIR_AHEAD
   };
 
   // pos' offset is negative relative to the reverse node.
-  return train_position_subtract(reverse_pos, train_tid, pos.position.offset);
+  return train_position_subtract(reverse_pos, pos.position.offset);
 }
 
 // // track position for the reverse node
@@ -5,7 +5,7 @@
 struct Path;
 
 struct TrackPosition {
-  struct TrackNode *node;
+  const struct TrackNode *node;
   int offset;
 };
 
@@ -19,4 +19,4 @@ struct TrainPosition {
 
 struct TrackPosition track_position_random();
 struct TrainPosition train_position_add(struct TrainPosition pos, struct Path *path, int offset);
-struct TrainPosition train_position_reverse_node(struct TrainPosition pos, int train_tid);
+struct TrainPosition train_position_reverse_node(struct TrainPosition pos);
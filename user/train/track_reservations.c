@@ -319,7 +319,7 @@ bool ReservePath(
 ) {
   // check if zones are reservable
   for (int i = start_node_index; i <= path->end_index; ++i) {
-    struct TrackNode *node = plan->path.nodes[i];
+    const struct TrackNode *node = plan->path.nodes[i];
     int zone = node->zone;
 
     if ((node->type == NODE_SENSOR || node->type == NODE_BRANCH || node->type == NODE_MERGE) &&
@@ -336,7 +336,7 @@ bool ReservePath(
   }
 
     for (int i = start_node_index; i <= path->end_index; ++i) {
-        struct TrackNode *node = plan->path.nodes[i];
+        const struct TrackNode *node = plan->path.nodes[i];
     int zone = node->zone;
 
     if (node->type == NODE_SENSOR || node->type == NODE_BRANCH || node->type == NODE_MERGE) {
@@ -2,54 +2,51 @@
 
 #include <stdbool.h>
 
-#include "../../server/name_server.h"
-#include "../trainset.h"
-#include "../trainset_task.h"
+#include "../selected_track.h"
+#include "../switch_snapshot.h"
 #include "track_data.h"
+#include "track_graph.h"
 
 // TESTED
-struct TrackDistance
-track_distance(struct TrackNode *track, struct TrackNode begin, struct TrackNode end) {
-  // struct TrackNode *track;
-  // tracka_init(track);
-  // from sensor A3
-  // struct TrackNode begin = track[2];
-  // struct TrackNode sensor = begin;
-  struct TrackDistance ret = {.distance = -1, .begin = begin.name, .end = NULL};
-  struct TrackNode node = begin;
-  int train = WhoIs("train");
+struct TrackDistance track_distance(int begin, int end) {
+  struct TrackDistance ret = {
+      .distance = -1, .begin = track_graph_name(track_graph, begin), .end = NULL
+  };
+  int node = begin;
   int dist = 0;
 
+  // the switches as they are now, the walk does not ask the train task for each one
+  struct SwitchSnapshot switches;
+  switch_snapshot_take(&switches);
+
   while (true) {
-    // nextnode = *sensor.edge[DIR_AHEAD].dest;
-    // dist+=sensor.edge[DIR_AHEAD].dist;
-    if ((dist != 0) && (node.index == end.index)) {
+    if ((dist != 0) && (node == end)) {
       // loop
       ret.distance = dist;
-      ret.end = node.name;
+      ret.end = track_graph_name(track_graph, node);
       return ret;
     }
 
-    if (node.type == NODE_BRANCH) {
-      // printf("%s ",node.name);
-      enum SwitchDirection direction = TrainGetSwitchState(train, node.num);
+    enum NodeType type = track_graph_type(track_graph, node);
+    int dir = DIR_AHEAD;
+
+    if (type == NODE_BRANCH) {
+      enum SwitchDirection direction =
+          switch_snapshot_get(&switches, track_graph_num(track_graph, node));
       if (direction == DIRECTION_CURVED) {
-        dist += node.edge[DIR_CURVED].dist;
-        node = *node.edge[DIR_CURVED].dest;
-      } else if (direction == DIRECTION_STRAIGHT) {
-        dist += node.edge[DIR_STRAIGHT].dist;
-        node = *node.edge[DIR_STRAIGHT].dest;
-      } else {
+        dir = DIR_CURVED;
+      } else if (direction != DIRECTION_STRAIGHT) {
         return ret;
       }
-    } else if (node.type == NODE_MERGE || node.type == NODE_SENSOR) {
-      // printf("%s ",node.name);
-      dist += node.edge[DIR_AHEAD].dist;
-      node = *node.edge[DIR_AHEAD].dest;
-    } else if (node.type == NODE_EXIT) {
+    }
+
+    if (type == NODE_BRANCH || type == NODE_MERGE || type == NODE_SENSOR) {
+      dist += track_graph_dist(track_graph, node, dir);
+      node = track_graph_dest(track_graph, node, dir);
+    } else if (type == NODE_EXIT) {
       // reach the exit of the track
       ret.distance = dist;
-      ret.end = node.name;
+      ret.end = track_graph_name(track_graph, node);
       return ret;
     } else {
       return ret;
@@ -6,5 +6,6 @@ struct TrackDistance {
   const char *end;
 };
 
-struct TrackDistance
-track_distance(struct TrackNode *track, struct TrackNode begin, struct TrackNode end);
+// distance from node begin to node end following the switches as they are set, or to the exit
+// the switches lead to. -1 if a switch on the way has not been set.
+struct TrackDistance track_distance(int begin, int end);
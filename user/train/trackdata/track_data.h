@@ -11,3 +11,8 @@
 
 void tracka_init(struct TrackNode *track);
 void trackb_init(struct TrackNode *track);
+
+// the same nodes as const arrays, generated from track_data.c by sim/track_tables.c, in
+// track_node_data.c
+extern const struct TrackNode TRACKA_NODES[TRACK_MAX];
+extern const struct TrackNode TRACKB_NODES[TRACK_MAX];
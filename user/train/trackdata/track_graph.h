@@ -0,0 +1,60 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "track_data.h"
+
+// longest node name, with its terminator
+#define TRACK_GRAPH_NAME_MAX 8
+
+// the track as arrays indexed by node, for searches and walks that only follow edges. a node is
+// its index in the TrackNode array, its edge[DIR_AHEAD] and edge[DIR_CURVED] are dests[node][dir]
+// and dists[node][dir]. the arrays searches read take under two kilobytes against the TrackNode
+// array's fourteen, names are kept after them. there are no pointers in it, so both tracks are
+// const tables the kernel does not have to relocate.
+struct TrackGraph {
+  uint16_t dests[TRACK_MAX][2];
+  // in millimetres
+  uint16_t dists[TRACK_MAX][2];
+  uint16_t reverses[TRACK_MAX];
+  uint8_t types[TRACK_MAX];
+  // sensor or switch number
+  uint8_t nums[TRACK_MAX];
+  uint8_t zones[TRACK_MAX];
+  char names[TRACK_MAX][TRACK_GRAPH_NAME_MAX];
+};
+
+// where a node has no edge in a direction
+#define TRACK_GRAPH_NONE UINT16_MAX
+
+// generated from track_data.c by sim/track_tables.c, in track_graph_data.c
+extern const struct TrackGraph TRACKA_GRAPH;
+extern const struct TrackGraph TRACKB_GRAPH;
+
+static inline enum NodeType track_graph_type(const struct TrackGraph *graph, int node) {
+  return graph->types[node];
+}
+
+static inline int track_graph_num(const struct TrackGraph *graph, int node) {
+  return graph->nums[node];
+}
+
+static inline int track_graph_zone(const struct TrackGraph *graph, int node) {
+  return graph->zones[node];
+}
+
+static inline int track_graph_reverse(const struct TrackGraph *graph, int node) {
+  return graph->reverses[node];
+}
+
+static inline int track_graph_dest(const struct TrackGraph *graph, int node, int dir) {
+  return graph->dests[node][dir];
+}
+
+static inline int track_graph_dist(const struct TrackGraph *graph, int node, int dir) {
+  return graph->dists[node][dir];
+}
+
+static inline const char *track_graph_name(const struct TrackGraph *graph, int node) {
+  return graph->names[node];
+}
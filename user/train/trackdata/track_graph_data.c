@@ -0,0 +1,217 @@
+/* THIS FILE IS GENERATED CODE -- DO NOT EDIT */
+// generated by sim/track_tables.c from track_data.c
+
+#include "track_graph.h"
+
+const struct TrackGraph TRACKA_GRAPH = {
+    .dests =
+      {{103, TRACK_GRAPH_NONE}, {133, TRACK_GRAPH_NONE}, {106, TRACK_GRAPH_NONE},
+      {31, TRACK_GRAPH_NONE}, {85, TRACK_GRAPH_NONE}, {25, TRACK_GRAPH_NONE},
+      {27, TRACK_GRAPH_NONE}, {83, TRACK_GRAPH_NONE}, {23, TRACK_GRAPH_NONE},
+      {81, TRACK_GRAPH_NONE}, {81, TRACK_GRAPH_NONE}, {139, TRACK_GRAPH_NONE},
+      {87, TRACK_GRAPH_NONE}, {131, TRACK_GRAPH_NONE}, {135, TRACK_GRAPH_NONE},
+      {87, TRACK_GRAPH_NONE}, {61, TRACK_GRAPH_NONE}, {111, TRACK_GRAPH_NONE},
+      {33, TRACK_GRAPH_NONE}, {111, TRACK_GRAPH_NONE}, {50, TRACK_GRAPH_NONE},
+      {105, TRACK_GRAPH_NONE}, {9, TRACK_GRAPH_NONE}, {137, TRACK_GRAPH_NONE},
+      {4, TRACK_GRAPH_NONE}, {141, TRACK_GRAPH_NONE}, {7, TRACK_GRAPH_NONE},
+      {143, TRACK_GRAPH_NONE}, {119, TRACK_GRAPH_NONE}, {63, TRACK_GRAPH_NONE},
+      {2, TRACK_GRAPH_NONE}, {108, TRACK_GRAPH_NONE}, {19, TRACK_GRAPH_NONE},
+      {117, TRACK_GRAPH_NONE}, {129, TRACK_GRAPH_NONE}, {89, TRACK_GRAPH_NONE},
+      {90, TRACK_GRAPH_NONE}, {109, TRACK_GRAPH_NONE}, {115, TRACK_GRAPH_NONE},
+      {84, TRACK_GRAPH_NONE}, {109, TRACK_GRAPH_NONE}, {110, TRACK_GRAPH_NONE},
+      {104, TRACK_GRAPH_NONE}, {107, TRACK_GRAPH_NONE}, {70, TRACK_GRAPH_NONE},
+      {100, TRACK_GRAPH_NONE}, {59, TRACK_GRAPH_NONE}, {91, TRACK_GRAPH_NONE},
+      {121, TRACK_GRAPH_NONE}, {67, TRACK_GRAPH_NONE}, {99, TRACK_GRAPH_NONE},
+      {21, TRACK_GRAPH_NONE}, {69, TRACK_GRAPH_NONE}, {97, TRACK_GRAPH_NONE},
+      {97, TRACK_GRAPH_NONE}, {71, TRACK_GRAPH_NONE}, {75, TRACK_GRAPH_NONE},
+      {95, TRACK_GRAPH_NONE}, {47, TRACK_GRAPH_NONE}, {93, TRACK_GRAPH_NONE},
+      {17, TRACK_GRAPH_NONE}, {113, TRACK_GRAPH_NONE}, {28, TRACK_GRAPH_NONE},
+      {113, TRACK_GRAPH_NONE}, {123, TRACK_GRAPH_NONE}, {78, TRACK_GRAPH_NONE},
+      {48, TRACK_GRAPH_NONE}, {99, TRACK_GRAPH_NONE}, {53, TRACK_GRAPH_NONE},
+      {98, TRACK_GRAPH_NONE}, {54, TRACK_GRAPH_NONE}, {45, TRACK_GRAPH_NONE},
+      {95, TRACK_GRAPH_NONE}, {76, TRACK_GRAPH_NONE}, {57, TRACK_GRAPH_NONE},
+      {92, TRACK_GRAPH_NONE}, {112, TRACK_GRAPH_NONE}, {72, TRACK_GRAPH_NONE},
+      {105, TRACK_GRAPH_NONE}, {64, TRACK_GRAPH_NONE}, {11, 8}, {83, TRACK_GRAPH_NONE}, {80, 6},
+      {85, TRACK_GRAPH_NONE}, {5, 82}, {38, TRACK_GRAPH_NONE}, {14, 13}, {103, TRACK_GRAPH_NONE},
+      {34, 93}, {114, TRACK_GRAPH_NONE}, {46, 115}, {37, TRACK_GRAPH_NONE}, {58, 89},
+      {74, TRACK_GRAPH_NONE}, {56, 73}, {96, TRACK_GRAPH_NONE}, {55, 52}, {94, TRACK_GRAPH_NONE},
+      {51, 66}, {68, TRACK_GRAPH_NONE}, {102, 107}, {44, TRACK_GRAPH_NONE}, {1, 86},
+      {101, TRACK_GRAPH_NONE}, {20, 79}, {43, TRACK_GRAPH_NONE}, {101, 42}, {3, TRACK_GRAPH_NONE},
+      {36, 41}, {30, TRACK_GRAPH_NONE}, {16, 18}, {40, TRACK_GRAPH_NONE}, {60, 62},
+      {77, TRACK_GRAPH_NONE}, {39, 91}, {88, TRACK_GRAPH_NONE}, {125, 32}, {119, TRACK_GRAPH_NONE},
+      {116, 29}, {122, TRACK_GRAPH_NONE}, {127, 49}, {123, TRACK_GRAPH_NONE}, {120, 65},
+      {118, TRACK_GRAPH_NONE}, {117, TRACK_GRAPH_NONE}, {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE},
+      {121, TRACK_GRAPH_NONE}, {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {35, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {12, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {0, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {15, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {22, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {10, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {24, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {26, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}},
+    .dists =
+      {{231, 0}, {504, 0}, {43, 0}, {437, 0}, {231, 0}, {642, 0}, {470, 0}, {229, 0}, {289, 0},
+      {229, 0}, {518, 0}, {43, 0}, {236, 0}, {325, 0}, {144, 0}, {417, 0}, {404, 0}, {231, 0},
+      {201, 0}, {239, 0}, {404, 0}, {231, 0}, {289, 0}, {43, 0}, {642, 0}, {50, 0}, {470, 0},
+      {50, 0}, {239, 0}, {201, 0}, {437, 0}, {50, 0}, {201, 0}, {246, 0}, {514, 0}, {239, 0},
+      {61, 0}, {433, 0}, {231, 0}, {128, 0}, {326, 0}, {128, 0}, {120, 0}, {333, 0}, {875, 0},
+      {43, 0}, {404, 0}, {239, 0}, {246, 0}, {201, 0}, {239, 0}, {404, 0}, {376, 0}, {239, 0},
+      {309, 0}, {384, 0}, {369, 0}, {316, 0}, {404, 0}, {231, 0}, {404, 0}, {239, 0}, {201, 0},
+      {246, 0}, {239, 0}, {201, 0}, {201, 0}, {239, 0}, {376, 0}, {50, 0}, {384, 0}, {875, 0},
+      {239, 0}, {376, 0}, {369, 0}, {50, 0}, {43, 0}, {376, 0}, {246, 0}, {201, 0}, {518, 229},
+      {188, 0}, {188, 229}, {185, 0}, {231, 185}, {128, 0}, {417, 236}, {185, 0}, {239, 371},
+      {155, 0}, {239, 371}, {61, 0}, {231, 371}, {50, 0}, {316, 239}, {155, 0}, {309, 239},
+      {155, 0}, {239, 239}, {50, 0}, {188, 495}, {43, 0}, {231, 185}, {188, 0}, {231, 246},
+      {120, 0}, {495, 333}, {43, 0}, {433, 326}, {50, 0}, {231, 239}, {128, 0}, {239, 246}, {43, 0},
+      {231, 371}, {155, 0}, {253, 246}, {0, 0}, {0, 239}, {0, 0}, {282, 246}, {0, 0}, {0, 239},
+      {0, 0}, {253, 0}, {0, 0}, {282, 0}, {0, 0}, {514, 0}, {0, 0}, {325, 0}, {0, 0}, {504, 0},
+      {0, 0}, {144, 0}, {0, 0}, {43, 0}, {0, 0}, {43, 0}, {0, 0}, {50, 0}, {0, 0}, {50, 0}, {0, 0}},
+    .reverses =
+      {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 17, 16, 19, 18, 21, 20, 23, 22, 25, 24,
+      27, 26, 29, 28, 31, 30, 33, 32, 35, 34, 37, 36, 39, 38, 41, 40, 43, 42, 45, 44, 47, 46, 49,
+      48, 51, 50, 53, 52, 55, 54, 57, 56, 59, 58, 61, 60, 63, 62, 65, 64, 67, 66, 69, 68, 71, 70,
+      73, 72, 75, 74, 77, 76, 79, 78, 81, 80, 83, 82, 85, 84, 87, 86, 89, 88, 91, 90, 93, 92, 95,
+      94, 97, 96, 99, 98, 101, 100, 103, 102, 105, 104, 107, 106, 109, 108, 111, 110, 113, 112, 115,
+      114, 117, 116, 119, 118, 121, 120, 123, 122, 125, 124, 127, 126, 129, 128, 131, 130, 133, 132,
+      135, 134, 137, 136, 139, 138, 141, 140, 143, 142},
+    .types =
+      {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+      3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+      4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5},
+    .nums =
+      {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+      26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+      49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+      72, 73, 74, 75, 76, 77, 78, 79, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10,
+      11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16, 16, 17, 17, 18, 18, 153, 153, 154, 154, 155, 155,
+      156, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    .zones =
+      {4, 1, 4, 7, 26, 29, 28, 26, 27, 26, 26, 0, 4, 2, 3, 4, 23, 22, 20, 22, 9, 6, 27, 31, 29, 32,
+      28, 33, 11, 19, 7, 21, 20, 11, 30, 24, 24, 21, 24, 26, 21, 22, 6, 4, 5, 4, 25, 24, 11, 12, 13,
+      9, 14, 15, 15, 8, 16, 15, 25, 24, 23, 18, 19, 18, 11, 10, 12, 13, 14, 13, 8, 5, 15, 17, 16,
+      24, 18, 17, 6, 10, 26, 26, 26, 26, 26, 26, 4, 4, 24, 24, 24, 24, 24, 24, 15, 15, 15, 15, 13,
+      13, 4, 4, 4, 4, 6, 6, 4, 4, 21, 21, 22, 22, 18, 18, 24, 24, 11, 11, 11, 11, 11, 11, 11, 11, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    .names =
+      {"A1", "A2", "A3", "A4", "A5", "A6", "A7", "A8", "A9", "A10", "A11", "A12", "A13", "A14",
+      "A15", "A16", "B1", "B2", "B3", "B4", "B5", "B6", "B7", "B8", "B9", "B10", "B11", "B12",
+      "B13", "B14", "B15", "B16", "C1", "C2", "C3", "C4", "C5", "C6", "C7", "C8", "C9", "C10",
+      "C11", "C12", "C13", "C14", "C15", "C16", "D1", "D2", "D3", "D4", "D5", "D6", "D7", "D8",
+      "D9", "D10", "D11", "D12", "D13", "D14", "D15", "D16", "E1", "E2", "E3", "E4", "E5", "E6",
+      "E7", "E8", "E9", "E10", "E11", "E12", "E13", "E14", "E15", "E16", "BR1", "MR1", "BR2", "MR2",
+      "BR3", "MR3", "BR4", "MR4", "BR5", "MR5", "BR6", "MR6", "BR7", "MR7", "BR8", "MR8", "BR9",
+      "MR9", "BR10", "MR10", "BR11", "MR11", "BR12", "MR12", "BR13", "MR13", "BR14", "MR14", "BR15",
+      "MR15", "BR16", "MR16", "BR17", "MR17", "BR18", "MR18", "BR153", "MR153", "BR154", "MR154",
+      "BR155", "MR155", "BR156", "MR156", "EN1", "EX1", "EN2", "EX2", "EN3", "EX3", "EN4", "EX4",
+      "EN5", "EX5", "EN6", "EX6", "EN7", "EX7", "EN8", "EX8", "EN9", "EX9", "EN10", "EX10"},
+};
+
+const struct TrackGraph TRACKB_GRAPH = {
+    .dests =
+      {{103, TRACK_GRAPH_NONE}, {133, TRACK_GRAPH_NONE}, {106, TRACK_GRAPH_NONE},
+      {31, TRACK_GRAPH_NONE}, {85, TRACK_GRAPH_NONE}, {25, TRACK_GRAPH_NONE},
+      {27, TRACK_GRAPH_NONE}, {83, TRACK_GRAPH_NONE}, {23, TRACK_GRAPH_NONE},
+      {81, TRACK_GRAPH_NONE}, {81, TRACK_GRAPH_NONE}, {15, TRACK_GRAPH_NONE},
+      {87, TRACK_GRAPH_NONE}, {131, TRACK_GRAPH_NONE}, {10, TRACK_GRAPH_NONE},
+      {87, TRACK_GRAPH_NONE}, {61, TRACK_GRAPH_NONE}, {111, TRACK_GRAPH_NONE},
+      {33, TRACK_GRAPH_NONE}, {111, TRACK_GRAPH_NONE}, {50, TRACK_GRAPH_NONE},
+      {105, TRACK_GRAPH_NONE}, {9, TRACK_GRAPH_NONE}, {135, TRACK_GRAPH_NONE},
+      {4, TRACK_GRAPH_NONE}, {137, TRACK_GRAPH_NONE}, {7, TRACK_GRAPH_NONE},
+      {139, TRACK_GRAPH_NONE}, {119, TRACK_GRAPH_NONE}, {63, TRACK_GRAPH_NONE},
+      {2, TRACK_GRAPH_NONE}, {108, TRACK_GRAPH_NONE}, {19, TRACK_GRAPH_NONE},
+      {117, TRACK_GRAPH_NONE}, {129, TRACK_GRAPH_NONE}, {89, TRACK_GRAPH_NONE},
+      {90, TRACK_GRAPH_NONE}, {109, TRACK_GRAPH_NONE}, {115, TRACK_GRAPH_NONE},
+      {84, TRACK_GRAPH_NONE}, {109, TRACK_GRAPH_NONE}, {110, TRACK_GRAPH_NONE},
+      {104, TRACK_GRAPH_NONE}, {107, TRACK_GRAPH_NONE}, {70, TRACK_GRAPH_NONE},
+      {100, TRACK_GRAPH_NONE}, {59, TRACK_GRAPH_NONE}, {91, TRACK_GRAPH_NONE},
+      {121, TRACK_GRAPH_NONE}, {67, TRACK_GRAPH_NONE}, {99, TRACK_GRAPH_NONE},
+      {21, TRACK_GRAPH_NONE}, {69, TRACK_GRAPH_NONE}, {97, TRACK_GRAPH_NONE},
+      {97, TRACK_GRAPH_NONE}, {71, TRACK_GRAPH_NONE}, {75, TRACK_GRAPH_NONE},
+      {95, TRACK_GRAPH_NONE}, {47, TRACK_GRAPH_NONE}, {93, TRACK_GRAPH_NONE},
+      {17, TRACK_GRAPH_NONE}, {113, TRACK_GRAPH_NONE}, {28, TRACK_GRAPH_NONE},
+      {113, TRACK_GRAPH_NONE}, {123, TRACK_GRAPH_NONE}, {78, TRACK_GRAPH_NONE},
+      {48, TRACK_GRAPH_NONE}, {99, TRACK_GRAPH_NONE}, {53, TRACK_GRAPH_NONE},
+      {98, TRACK_GRAPH_NONE}, {54, TRACK_GRAPH_NONE}, {45, TRACK_GRAPH_NONE},
+      {95, TRACK_GRAPH_NONE}, {76, TRACK_GRAPH_NONE}, {57, TRACK_GRAPH_NONE},
+      {92, TRACK_GRAPH_NONE}, {112, TRACK_GRAPH_NONE}, {72, TRACK_GRAPH_NONE},
+      {105, TRACK_GRAPH_NONE}, {64, TRACK_GRAPH_NONE}, {11, 8}, {83, TRACK_GRAPH_NONE}, {80, 6},
+      {85, TRACK_GRAPH_NONE}, {5, 82}, {38, TRACK_GRAPH_NONE}, {14, 13}, {103, TRACK_GRAPH_NONE},
+      {34, 93}, {114, TRACK_GRAPH_NONE}, {46, 115}, {37, TRACK_GRAPH_NONE}, {58, 89},
+      {74, TRACK_GRAPH_NONE}, {56, 73}, {96, TRACK_GRAPH_NONE}, {55, 52}, {94, TRACK_GRAPH_NONE},
+      {51, 66}, {68, TRACK_GRAPH_NONE}, {102, 107}, {44, TRACK_GRAPH_NONE}, {1, 86},
+      {101, TRACK_GRAPH_NONE}, {20, 79}, {43, TRACK_GRAPH_NONE}, {101, 42}, {3, TRACK_GRAPH_NONE},
+      {36, 41}, {30, TRACK_GRAPH_NONE}, {16, 18}, {40, TRACK_GRAPH_NONE}, {60, 62},
+      {77, TRACK_GRAPH_NONE}, {39, 91}, {88, TRACK_GRAPH_NONE}, {125, 32}, {119, TRACK_GRAPH_NONE},
+      {116, 29}, {122, TRACK_GRAPH_NONE}, {127, 49}, {123, TRACK_GRAPH_NONE}, {120, 65},
+      {118, TRACK_GRAPH_NONE}, {117, TRACK_GRAPH_NONE}, {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE},
+      {121, TRACK_GRAPH_NONE}, {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {35, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {12, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {0, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {22, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {24, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {26, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}, {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE},
+      {TRACK_GRAPH_NONE, TRACK_GRAPH_NONE}},
+    .dists =
+      {{231, 0}, {504, 0}, {43, 0}, {437, 0}, {231, 0}, {642, 0}, {470, 0}, {229, 0}, {289, 0},
+      {229, 0}, {282, 0}, {814, 0}, {236, 0}, {325, 0}, {814, 0}, {275, 0}, {404, 0}, {231, 0},
+      {201, 0}, {239, 0}, {404, 0}, {231, 0}, {289, 0}, {43, 0}, {642, 0}, {50, 0}, {470, 0},
+      {50, 0}, {239, 0}, {201, 0}, {437, 0}, {50, 0}, {201, 0}, {246, 0}, {514, 0}, {239, 0},
+      {61, 0}, {433, 0}, {231, 0}, {128, 0}, {326, 0}, {128, 0}, {120, 0}, {333, 0}, {780, 0},
+      {50, 0}, {404, 0}, {239, 0}, {246, 0}, {201, 0}, {239, 0}, {404, 0}, {282, 0}, {229, 0},
+      {309, 0}, {376, 0}, {282, 0}, {316, 0}, {404, 0}, {231, 0}, {404, 0}, {239, 0}, {201, 0},
+      {246, 0}, {239, 0}, {201, 0}, {201, 0}, {239, 0}, {282, 0}, {50, 0}, {376, 0}, {780, 0},
+      {239, 0}, {282, 0}, {282, 0}, {43, 0}, {43, 0}, {282, 0}, {246, 0}, {201, 0}, {282, 229},
+      {188, 0}, {188, 229}, {185, 0}, {231, 185}, {128, 0}, {275, 236}, {185, 0}, {239, 371},
+      {155, 0}, {239, 371}, {61, 0}, {231, 371}, {43, 0}, {316, 239}, {155, 0}, {309, 229},
+      {155, 0}, {239, 239}, {50, 0}, {188, 495}, {50, 0}, {231, 185}, {188, 0}, {231, 246},
+      {120, 0}, {495, 333}, {43, 0}, {433, 326}, {50, 0}, {231, 239}, {128, 0}, {239, 246}, {43, 0},
+      {231, 371}, {155, 0}, {253, 246}, {0, 0}, {0, 239}, {0, 0}, {282, 246}, {0, 0}, {0, 239},
+      {0, 0}, {253, 0}, {0, 0}, {282, 0}, {0, 0}, {514, 0}, {0, 0}, {325, 0}, {0, 0}, {504, 0},
+      {0, 0}, {43, 0}, {0, 0}, {50, 0}, {0, 0}, {50, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}, {0, 0}},
+    .reverses =
+      {1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14, 17, 16, 19, 18, 21, 20, 23, 22, 25, 24,
+      27, 26, 29, 28, 31, 30, 33, 32, 35, 34, 37, 36, 39, 38, 41, 40, 43, 42, 45, 44, 47, 46, 49,
+      48, 51, 50, 53, 52, 55, 54, 57, 56, 59, 58, 61, 60, 63, 62, 65, 64, 67, 66, 69, 68, 71, 70,
+      73, 72, 75, 74, 77, 76, 79, 78, 81, 80, 83, 82, 85, 84, 87, 86, 89, 88, 91, 90, 93, 92, 95,
+      94, 97, 96, 99, 98, 101, 100, 103, 102, 105, 104, 107, 106, 109, 108, 111, 110, 113, 112, 115,
+      114, 117, 116, 119, 118, 121, 120, 123, 122, 125, 124, 127, 126, 129, 128, 131, 130, 133, 132,
+      135, 134, 137, 136, 139, 138, TRACK_GRAPH_NONE, TRACK_GRAPH_NONE, TRACK_GRAPH_NONE,
+      TRACK_GRAPH_NONE},
+    .types =
+      {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+      1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2,
+      3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3, 2, 3,
+      4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 4, 5, 0, 0, 0, 0},
+    .nums =
+      {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+      26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48,
+      49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+      72, 73, 74, 75, 76, 77, 78, 79, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10,
+      11, 11, 12, 12, 13, 13, 14, 14, 15, 15, 16, 16, 17, 17, 18, 18, 153, 153, 154, 154, 155, 155,
+      156, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    .zones =
+      {4, 1, 4, 7, 26, 29, 28, 26, 27, 26, 26, 3, 4, 2, 3, 4, 23, 22, 20, 22, 9, 6, 27, 31, 29, 32,
+      28, 33, 11, 19, 7, 21, 20, 11, 30, 24, 24, 21, 24, 26, 21, 22, 6, 4, 5, 4, 25, 24, 11, 12, 13,
+      9, 14, 15, 15, 8, 16, 15, 25, 24, 23, 18, 19, 18, 11, 10, 12, 13, 14, 13, 8, 5, 15, 17, 16,
+      24, 18, 17, 6, 10, 26, 26, 26, 26, 26, 26, 4, 4, 24, 24, 24, 24, 24, 24, 15, 15, 15, 15, 13,
+      13, 4, 4, 4, 4, 6, 6, 4, 4, 21, 21, 22, 22, 18, 18, 24, 24, 11, 11, 11, 11, 11, 11, 11, 11, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},
+    .names =
+      {"A1", "A2", "A3", "A4", "A5", "A6", "A7", "A8", "A9", "A10", "A11", "A12", "A13", "A14",
+      "A15", "A16", "B1", "B2", "B3", "B4", "B5", "B6", "B7", "B8", "B9", "B10", "B11", "B12",
+      "B13", "B14", "B15", "B16", "C1", "C2", "C3", "C4", "C5", "C6", "C7", "C8", "C9", "C10",
+      "C11", "C12", "C13", "C14", "C15", "C16", "D1", "D2", "D3", "D4", "D5", "D6", "D7", "D8",
+      "D9", "D10", "D11", "D12", "D13", "D14", "D15", "D16", "E1", "E2", "E3", "E4", "E5", "E6",
+      "E7", "E8", "E9", "E10", "E11", "E12", "E13", "E14", "E15", "E16", "BR1", "MR1", "BR2", "MR2",
+      "BR3", "MR3", "BR4", "MR4", "BR5", "MR5", "BR6", "MR6", "BR7", "MR7", "BR8", "MR8", "BR9",
+      "MR9", "BR10", "MR10", "BR11", "MR11", "BR12", "MR12", "BR13", "MR13", "BR14", "MR14", "BR15",
+      "MR15", "BR16", "MR16", "BR17", "MR17", "BR18", "MR18", "BR153", "MR153", "BR154", "MR154",
+      "BR155", "MR155", "BR156", "MR156", "EN1", "EX1", "EN2", "EX2", "EN3", "EX3", "EN4", "EX4",
+      "EN5", "EX5", "EN7", "EX7", "EN9", "EX9", "EN10", "EX10", "", "", "", ""},
+};
@@ -15,8 +15,8 @@ enum NodeType {
 #define DIR_REVERSE 2
 
 struct TrackEdge {
-  struct TrackEdge *reverse;
-  struct TrackNode *src, *dest;
+  const struct TrackEdge *reverse;
+  const struct TrackNode *src, *dest;
   int dist; /* in millimetres */
   int index;
 };
@@ -25,7 +25,7 @@ struct TrackNode {
   const char *name;
   enum NodeType type;
   int num;                   /* sensor or switch number */
-  struct TrackNode *reverse; /* same location, but opposite direction */
+  const struct TrackNode *reverse; /* same location, but opposite direction */
   struct TrackEdge edge[2];
   int index;
   int zone;
@@ -0,0 +1,1756 @@
+/* THIS FILE IS GENERATED CODE -- DO NOT EDIT */
+// generated by sim/track_tables.c from track_data.c
+
+#include "track_data.h"
+
+const struct TrackNode TRACKA_NODES[TRACK_MAX] = {
+    {.name = "A1", .type = NODE_SENSOR, .num = 0, .index = 0, .zone = 4,
+     .reverse = &TRACKA_NODES[1],
+     .edge =
+         {{.reverse = &TRACKA_NODES[102].edge[0], .src = &TRACKA_NODES[0],
+           .dest = &TRACKA_NODES[103], .dist = 231, .index = 0},
+          {.index = 1}}},
+    {.name = "A2", .type = NODE_SENSOR, .num = 1, .index = 1, .zone = 1,
+     .reverse = &TRACKA_NODES[0],
+     .edge =
+         {{.reverse = &TRACKA_NODES[132].edge[0], .src = &TRACKA_NODES[1],
+           .dest = &TRACKA_NODES[133], .dist = 504, .index = 2},
+          {.index = 3}}},
+    {.name = "A3", .type = NODE_SENSOR, .num = 2, .index = 2, .zone = 4,
+     .reverse = &TRACKA_NODES[3],
+     .edge =
+         {{.reverse = &TRACKA_NODES[107].edge[0], .src = &TRACKA_NODES[2],
+           .dest = &TRACKA_NODES[106], .dist = 43, .index = 4},
+          {.index = 5}}},
+    {.name = "A4", .type = NODE_SENSOR, .num = 3, .index = 3, .zone = 7,
+     .reverse = &TRACKA_NODES[2],
+     .edge =
+         {{.reverse = &TRACKA_NODES[30].edge[0], .src = &TRACKA_NODES[3],
+           .dest = &TRACKA_NODES[31], .dist = 437, .index = 6},
+          {.index = 7}}},
+    {.name = "A5", .type = NODE_SENSOR, .num = 4, .index = 4, .zone = 26,
+     .reverse = &TRACKA_NODES[5],
+     .edge =
+         {{.reverse = &TRACKA_NODES[84].edge[0], .src = &TRACKA_NODES[4],
+           .dest = &TRACKA_NODES[85], .dist = 231, .index = 8},
+          {.index = 9}}},
+    {.name = "A6", .type = NODE_SENSOR, .num = 5, .index = 5, .zone = 29,
+     .reverse = &TRACKA_NODES[4],
+     .edge =
+         {{.reverse = &TRACKA_NODES[24].edge[0], .src = &TRACKA_NODES[5],
+           .dest = &TRACKA_NODES[25], .dist = 642, .index = 10},
+          {.index = 11}}},
+    {.name = "A7", .type = NODE_SENSOR, .num = 6, .index = 6, .zone = 28,
+     .reverse = &TRACKA_NODES[7],
+     .edge =
+         {{.reverse = &TRACKA_NODES[26].edge[0], .src = &TRACKA_NODES[6],
+           .dest = &TRACKA_NODES[27], .dist = 470, .index = 12},
+          {.index = 13}}},
+    {.name = "A8", .type = NODE_SENSOR, .num = 7, .index = 7, .zone = 26,
+     .reverse = &TRACKA_NODES[6],
+     .edge =
+         {{.reverse = &TRACKA_NODES[82].edge[1], .src = &TRACKA_NODES[7],
+           .dest = &TRACKA_NODES[83], .dist = 229, .index = 14},
+          {.index = 15}}},
+    {.name = "A9", .type = NODE_SENSOR, .num = 8, .index = 8, .zone = 27,
+     .reverse = &TRACKA_NODES[9],
+     .edge =
+         {{.reverse = &TRACKA_NODES[22].edge[0], .src = &TRACKA_NODES[8],
+           .dest = &TRACKA_NODES[23], .dist = 289, .index = 16},
+          {.index = 17}}},
+    {.name = "A10", .type = NODE_SENSOR, .num = 9, .index = 9, .zone = 26,
+     .reverse = &TRACKA_NODES[8],
+     .edge =
+         {{.reverse = &TRACKA_NODES[80].edge[1], .src = &TRACKA_NODES[9],
+           .dest = &TRACKA_NODES[81], .dist = 229, .index = 18},
+          {.index = 19}}},
+    {.name = "A11", .type = NODE_SENSOR, .num = 10, .index = 10, .zone = 26,
+     .reverse = &TRACKA_NODES[11],
+     .edge =
+         {{.reverse = &TRACKA_NODES[80].edge[0], .src = &TRACKA_NODES[10],
+           .dest = &TRACKA_NODES[81], .dist = 518, .index = 20},
+          {.index = 21}}},
+    {.name = "A12", .type = NODE_SENSOR, .num = 11, .index = 11, .zone = 0,
+     .reverse = &TRACKA_NODES[10],
+     .edge =
+         {{.reverse = &TRACKA_NODES[138].edge[0], .src = &TRACKA_NODES[11],
+           .dest = &TRACKA_NODES[139], .dist = 43, .index = 22},
+          {.index = 23}}},
+    {.name = "A13", .type = NODE_SENSOR, .num = 12, .index = 12, .zone = 4,
+     .reverse = &TRACKA_NODES[13],
+     .edge =
+         {{.reverse = &TRACKA_NODES[86].edge[1], .src = &TRACKA_NODES[12],
+           .dest = &TRACKA_NODES[87], .dist = 236, .index = 24},
+          {.index = 25}}},
+    {.name = "A14", .type = NODE_SENSOR, .num = 13, .index = 13, .zone = 2,
+     .reverse = &TRACKA_NODES[12],
+     .edge =
+         {{.reverse = &TRACKA_NODES[130].edge[0], .src = &TRACKA_NODES[13],
+           .dest = &TRACKA_NODES[131], .dist = 325, .index = 26},
+          {.index = 27}}},
+    {.name = "A15", .type = NODE_SENSOR, .num = 14, .index = 14, .zone = 3,
+     .reverse = &TRACKA_NODES[15],
+     .edge =
+         {{.reverse = &TRACKA_NODES[134].edge[0], .src = &TRACKA_NODES[14],
+           .dest = &TRACKA_NODES[135], .dist = 144, .index = 28},
+          {.index = 29}}},
+    {.name = "A16", .type = NODE_SENSOR, .num = 15, .index = 15, .zone = 4,
+     .reverse = &TRACKA_NODES[14],
+     .edge =
+         {{.reverse = &TRACKA_NODES[86].edge[0], .src = &TRACKA_NODES[15],
+           .dest = &TRACKA_NODES[87], .dist = 417, .index = 30},
+          {.index = 31}}},
+    {.name = "B1", .type = NODE_SENSOR, .num = 16, .index = 16, .zone = 23,
+     .reverse = &TRACKA_NODES[17],
+     .edge =
+         {{.reverse = &TRACKA_NODES[60].edge[0], .src = &TRACKA_NODES[16],
+           .dest = &TRACKA_NODES[61], .dist = 404, .index = 32},
+          {.index = 33}}},
+    {.name = "B2", .type = NODE_SENSOR, .num = 17, .index = 17, .zone = 22,
+     .reverse = &TRACKA_NODES[16],
+     .edge =
+         {{.reverse = &TRACKA_NODES[110].edge[0], .src = &TRACKA_NODES[17],
+           .dest = &TRACKA_NODES[111], .dist = 231, .index = 34},
+          {.index = 35}}},
+    {.name = "B3", .type = NODE_SENSOR, .num = 18, .index = 18, .zone = 20,
+     .reverse = &TRACKA_NODES[19],
+     .edge =
+         {{.reverse = &TRACKA_NODES[32].edge[0], .src = &TRACKA_NODES[18],
+           .dest = &TRACKA_NODES[33], .dist = 201, .index = 36},
+          {.index = 37}}},
+    {.name = "B4", .type = NODE_SENSOR, .num = 19, .index = 19, .zone = 22,
+     .reverse = &TRACKA_NODES[18],
+     .edge =
+         {{.reverse = &TRACKA_NODES[110].edge[1], .src = &TRACKA_NODES[19],
+           .dest = &TRACKA_NODES[111], .dist = 239, .index = 38},
+          {.index = 39}}},
+    {.name = "B5", .type = NODE_SENSOR, .num = 20, .index = 20, .zone = 9,
+     .reverse = &TRACKA_NODES[21],
+     .edge =
+         {{.reverse = &TRACKA_NODES[51].edge[0], .src = &TRACKA_NODES[20],
+           .dest = &TRACKA_NODES[50], .dist = 404, .index = 40},
+          {.index = 41}}},
+    {.name = "B6", .type = NODE_SENSOR, .num = 21, .index = 21, .zone = 6,
+     .reverse = &TRACKA_NODES[20],
+     .edge =
+         {{.reverse = &TRACKA_NODES[104].edge[0], .src = &TRACKA_NODES[21],
+           .dest = &TRACKA_NODES[105], .dist = 231, .index = 42},
+          {.index = 43}}},
+    {.name = "B7", .type = NODE_SENSOR, .num = 22, .index = 22, .zone = 27,
+     .reverse = &TRACKA_NODES[23],
+     .edge =
+         {{.reverse = &TRACKA_NODES[8].edge[0], .src = &TRACKA_NODES[22],
+           .dest = &TRACKA_NODES[9], .dist = 289, .index = 44},
+          {.index = 45}}},
+    {.name = "B8", .type = NODE_SENSOR, .num = 23, .index = 23, .zone = 31,
+     .reverse = &TRACKA_NODES[22],
+     .edge =
+         {{.reverse = &TRACKA_NODES[136].edge[0], .src = &TRACKA_NODES[23],
+           .dest = &TRACKA_NODES[137], .dist = 43, .index = 46},
+          {.index = 47}}},
+    {.name = "B9", .type = NODE_SENSOR, .num = 24, .index = 24, .zone = 29,
+     .reverse = &TRACKA_NODES[25],
+     .edge =
+         {{.reverse = &TRACKA_NODES[5].edge[0], .src = &TRACKA_NODES[24],
+           .dest = &TRACKA_NODES[4], .dist = 642, .index = 48},
+          {.index = 49}}},
+    {.name = "B10", .type = NODE_SENSOR, .num = 25, .index = 25, .zone = 32,
+     .reverse = &TRACKA_NODES[24],
+     .edge =
+         {{.reverse = &TRACKA_NODES[140].edge[0], .src = &TRACKA_NODES[25],
+           .dest = &TRACKA_NODES[141], .dist = 50, .index = 50},
+          {.index = 51}}},
+    {.name = "B11", .type = NODE_SENSOR, .num = 26, .index = 26, .zone = 28,
+     .reverse = &TRACKA_NODES[27],
+     .edge =
+         {{.reverse = &TRACKA_NODES[6].edge[0], .src = &TRACKA_NODES[26],
+           .dest = &TRACKA_NODES[7], .dist = 470, .index = 52},
+          {.index = 53}}},
+    {.name = "B12", .type = NODE_SENSOR, .num = 27, .index = 27, .zone = 33,
+     .reverse = &TRACKA_NODES[26],
+     .edge =
+         {{.reverse = &TRACKA_NODES[142].edge[0], .src = &TRACKA_NODES[27],
+           .dest = &TRACKA_NODES[143], .dist = 50, .index = 54},
+          {.index = 55}}},
+    {.name = "B13", .type = NODE_SENSOR, .num = 28, .index = 28, .zone = 11,
+     .reverse = &TRACKA_NODES[29],
+     .edge =
+         {{.reverse = &TRACKA_NODES[118].edge[1], .src = &TRACKA_NODES[28],
+           .dest = &TRACKA_NODES[119], .dist = 239, .index = 56},
+          {.index = 57}}},
+    {.name = "B14", .type = NODE_SENSOR, .num = 29, .index = 29, .zone = 19,
+     .reverse = &TRACKA_NODES[28],
+     .edge =
+         {{.reverse = &TRACKA_NODES[62].edge[0], .src = &TRACKA_NODES[29],
+           .dest = &TRACKA_NODES[63], .dist = 201, .index = 58},
+          {.index = 59}}},
+    {.name = "B15", .type = NODE_SENSOR, .num = 30, .index = 30, .zone = 7,
+     .reverse = &TRACKA_NODES[31],
+     .edge =
+         {{.reverse = &TRACKA_NODES[3].edge[0], .src = &TRACKA_NODES[30],
+           .dest = &TRACKA_NODES[2], .dist = 437, .index = 60},
+          {.index = 61}}},
+    {.name = "B16", .type = NODE_SENSOR, .num = 31, .index = 31, .zone = 21,
+     .reverse = &TRACKA_NODES[30],
+     .edge =
+         {{.reverse = &TRACKA_NODES[109].edge[0], .src = &TRACKA_NODES[31],
+           .dest = &TRACKA_NODES[108], .dist = 50, .index = 62},
+          {.index = 63}}},
+    {.name = "C1", .type = NODE_SENSOR, .num = 32, .index = 32, .zone = 20,
+     .reverse = &TRACKA_NODES[33],
+     .edge =
+         {{.reverse = &TRACKA_NODES[18].edge[0], .src = &TRACKA_NODES[32],
+           .dest = &TRACKA_NODES[19], .dist = 201, .index = 64},
+          {.index = 65}}},
+    {.name = "C2", .type = NODE_SENSOR, .num = 33, .index = 33, .zone = 11,
+     .reverse = &TRACKA_NODES[32],
+     .edge =
+         {{.reverse = &TRACKA_NODES[116].edge[1], .src = &TRACKA_NODES[33],
+           .dest = &TRACKA_NODES[117], .dist = 246, .index = 66},
+          {.index = 67}}},
+    {.name = "C3", .type = NODE_SENSOR, .num = 34, .index = 34, .zone = 30,
+     .reverse = &TRACKA_NODES[35],
+     .edge =
+         {{.reverse = &TRACKA_NODES[128].edge[0], .src = &TRACKA_NODES[34],
+           .dest = &TRACKA_NODES[129], .dist = 514, .index = 68},
+          {.index = 69}}},
+    {.name = "C4", .type = NODE_SENSOR, .num = 35, .index = 35, .zone = 24,
+     .reverse = &TRACKA_NODES[34],
+     .edge =
+         {{.reverse = &TRACKA_NODES[88].edge[0], .src = &TRACKA_NODES[35],
+           .dest = &TRACKA_NODES[89], .dist = 239, .index = 70},
+          {.index = 71}}},
+    {.name = "C5", .type = NODE_SENSOR, .num = 36, .index = 36, .zone = 24,
+     .reverse = &TRACKA_NODES[37],
+     .edge =
+         {{.reverse = &TRACKA_NODES[91].edge[0], .src = &TRACKA_NODES[36],
+           .dest = &TRACKA_NODES[90], .dist = 61, .index = 72},
+          {.index = 73}}},
+    {.name = "C6", .type = NODE_SENSOR, .num = 37, .index = 37, .zone = 21,
+     .reverse = &TRACKA_NODES[36],
+     .edge =
+         {{.reverse = &TRACKA_NODES[108].edge[0], .src = &TRACKA_NODES[37],
+           .dest = &TRACKA_NODES[109], .dist = 433, .index = 74},
+          {.index = 75}}},
+    {.name = "C7", .type = NODE_SENSOR, .num = 38, .index = 38, .zone = 24,
+     .reverse = &TRACKA_NODES[39],
+     .edge =
+         {{.reverse = &TRACKA_NODES[114].edge[0], .src = &TRACKA_NODES[38],
+           .dest = &TRACKA_NODES[115], .dist = 231, .index = 76},
+          {.index = 77}}},
+    {.name = "C8", .type = NODE_SENSOR, .num = 39, .index = 39, .zone = 26,
+     .reverse = &TRACKA_NODES[38],
+     .edge =
+         {{.reverse = &TRACKA_NODES[85].edge[0], .src = &TRACKA_NODES[39],
+           .dest = &TRACKA_NODES[84], .dist = 128, .index = 78},
+          {.index = 79}}},
+    {.name = "C9", .type = NODE_SENSOR, .num = 40, .index = 40, .zone = 21,
+     .reverse = &TRACKA_NODES[41],
+     .edge =
+         {{.reverse = &TRACKA_NODES[108].edge[1], .src = &TRACKA_NODES[40],
+           .dest = &TRACKA_NODES[109], .dist = 326, .index = 80},
+          {.index = 81}}},
+    {.name = "C10", .type = NODE_SENSOR, .num = 41, .index = 41, .zone = 22,
+     .reverse = &TRACKA_NODES[40],
+     .edge =
+         {{.reverse = &TRACKA_NODES[111].edge[0], .src = &TRACKA_NODES[41],
+           .dest = &TRACKA_NODES[110], .dist = 128, .index = 82},
+          {.index = 83}}},
+    {.name = "C11", .type = NODE_SENSOR, .num = 42, .index = 42, .zone = 6,
+     .reverse = &TRACKA_NODES[43],
+     .edge =
+         {{.reverse = &TRACKA_NODES[105].edge[0], .src = &TRACKA_NODES[42],
+           .dest = &TRACKA_NODES[104], .dist = 120, .index = 84},
+          {.index = 85}}},
+    {.name = "C12", .type = NODE_SENSOR, .num = 43, .index = 43, .zone = 4,
+     .reverse = &TRACKA_NODES[42],
+     .edge =
+         {{.reverse = &TRACKA_NODES[106].edge[1], .src = &TRACKA_NODES[43],
+           .dest = &TRACKA_NODES[107], .dist = 333, .index = 86},
+          {.index = 87}}},
+    {.name = "C13", .type = NODE_SENSOR, .num = 44, .index = 44, .zone = 5,
+     .reverse = &TRACKA_NODES[45],
+     .edge =
+         {{.reverse = &TRACKA_NODES[71].edge[0], .src = &TRACKA_NODES[44],
+           .dest = &TRACKA_NODES[70], .dist = 875, .index = 88},
+          {.index = 89}}},
+    {.name = "C14", .type = NODE_SENSOR, .num = 45, .index = 45, .zone = 4,
+     .reverse = &TRACKA_NODES[44],
+     .edge =
+         {{.reverse = &TRACKA_NODES[101].edge[0], .src = &TRACKA_NODES[45],
+           .dest = &TRACKA_NODES[100], .dist = 43, .index = 90},
+          {.index = 91}}},
+    {.name = "C15", .type = NODE_SENSOR, .num = 46, .index = 46, .zone = 25,
+     .reverse = &TRACKA_NODES[47],
+     .edge =
+         {{.reverse = &TRACKA_NODES[58].edge[0], .src = &TRACKA_NODES[46],
+           .dest = &TRACKA_NODES[59], .dist = 404, .index = 92},
+          {.index = 93}}},
+    {.name = "C16", .type = NODE_SENSOR, .num = 47, .index = 47, .zone = 24,
+     .reverse = &TRACKA_NODES[46],
+     .edge =
+         {{.reverse = &TRACKA_NODES[90].edge[0], .src = &TRACKA_NODES[47],
+           .dest = &TRACKA_NODES[91], .dist = 239, .index = 94},
+          {.index = 95}}},
+    {.name = "D1", .type = NODE_SENSOR, .num = 48, .index = 48, .zone = 11,
+     .reverse = &TRACKA_NODES[49],
+     .edge =
+         {{.reverse = &TRACKA_NODES[120].edge[1], .src = &TRACKA_NODES[48],
+           .dest = &TRACKA_NODES[121], .dist = 246, .index = 96},
+          {.index = 97}}},
+    {.name = "D2", .type = NODE_SENSOR, .num = 49, .index = 49, .zone = 12,
+     .reverse = &TRACKA_NODES[48],
+     .edge =
+         {{.reverse = &TRACKA_NODES[66].edge[0], .src = &TRACKA_NODES[49],
+           .dest = &TRACKA_NODES[67], .dist = 201, .index = 98},
+          {.index = 99}}},
+    {.name = "D3", .type = NODE_SENSOR, .num = 50, .index = 50, .zone = 13,
+     .reverse = &TRACKA_NODES[51],
+     .edge =
+         {{.reverse = &TRACKA_NODES[98].edge[0], .src = &TRACKA_NODES[50],
+           .dest = &TRACKA_NODES[99], .dist = 239, .index = 100},
+          {.index = 101}}},
+    {.name = "D4", .type = NODE_SENSOR, .num = 51, .index = 51, .zone = 9,
+     .reverse = &TRACKA_NODES[50],
+     .edge =
+         {{.reverse = &TRACKA_NODES[20].edge[0], .src = &TRACKA_NODES[51],
+           .dest = &TRACKA_NODES[21], .dist = 404, .index = 102},
+          {.index = 103}}},
+    {.name = "D5", .type = NODE_SENSOR, .num = 52, .index = 52, .zone = 14,
+     .reverse = &TRACKA_NODES[53],
+     .edge =
+         {{.reverse = &TRACKA_NODES[68].edge[0], .src = &TRACKA_NODES[52],
+           .dest = &TRACKA_NODES[69], .dist = 376, .index = 104},
+          {.index = 105}}},
+    {.name = "D6", .type = NODE_SENSOR, .num = 53, .index = 53, .zone = 15,
+     .reverse = &TRACKA_NODES[52],
+     .edge =
+         {{.reverse = &TRACKA_NODES[96].edge[1], .src = &TRACKA_NODES[53],
+           .dest = &TRACKA_NODES[97], .dist = 239, .index = 106},
+          {.index = 107}}},
+    {.name = "D7", .type = NODE_SENSOR, .num = 54, .index = 54, .zone = 15,
+     .reverse = &TRACKA_NODES[55],
+     .edge =
+         {{.reverse = &TRACKA_NODES[96].edge[0], .src = &TRACKA_NODES[54],
+           .dest = &TRACKA_NODES[97], .dist = 309, .index = 108},
+          {.index = 109}}},
+    {.name = "D8", .type = NODE_SENSOR, .num = 55, .index = 55, .zone = 8,
+     .reverse = &TRACKA_NODES[54],
+     .edge =
+         {{.reverse = &TRACKA_NODES[70].edge[0], .src = &TRACKA_NODES[55],
+           .dest = &TRACKA_NODES[71], .dist = 384, .index = 110},
+          {.index = 111}}},
+    {.name = "D9", .type = NODE_SENSOR, .num = 56, .index = 56, .zone = 16,
+     .reverse = &TRACKA_NODES[57],
+     .edge =
+         {{.reverse = &TRACKA_NODES[74].edge[0], .src = &TRACKA_NODES[56],
+           .dest = &TRACKA_NODES[75], .dist = 369, .index = 112},
+          {.index = 113}}},
+    {.name = "D10", .type = NODE_SENSOR, .num = 57, .index = 57, .zone = 15,
+     .reverse = &TRACKA_NODES[56],
+     .edge =
+         {{.reverse = &TRACKA_NODES[94].edge[0], .src = &TRACKA_NODES[57],
+           .dest = &TRACKA_NODES[95], .dist = 316, .index = 114},
+          {.index = 115}}},
+    {.name = "D11", .type = NODE_SENSOR, .num = 58, .index = 58, .zone = 25,
+     .reverse = &TRACKA_NODES[59],
+     .edge =
+         {{.reverse = &TRACKA_NODES[46].edge[0], .src = &TRACKA_NODES[58],
+           .dest = &TRACKA_NODES[47], .dist = 404, .index = 116},
+          {.index = 117}}},
+    {.name = "D12", .type = NODE_SENSOR, .num = 59, .index = 59, .zone = 24,
+     .reverse = &TRACKA_NODES[58],
+     .edge =
+         {{.reverse = &TRACKA_NODES[92].edge[0], .src = &TRACKA_NODES[59],
+           .dest = &TRACKA_NODES[93], .dist = 231, .index = 118},
+          {.index = 119}}},
+    {.name = "D13", .type = NODE_SENSOR, .num = 60, .index = 60, .zone = 23,
+     .reverse = &TRACKA_NODES[61],
+     .edge =
+         {{.reverse = &TRACKA_NODES[16].edge[0], .src = &TRACKA_NODES[60],
+           .dest = &TRACKA_NODES[17], .dist = 404, .index = 120},
+          {.index = 121}}},
+    {.name = "D14", .type = NODE_SENSOR, .num = 61, .index = 61, .zone = 18,
+     .reverse = &TRACKA_NODES[60],
+     .edge =
+         {{.reverse = &TRACKA_NODES[112].edge[0], .src = &TRACKA_NODES[61],
+           .dest = &TRACKA_NODES[113], .dist = 239, .index = 122},
+          {.index = 123}}},
+    {.name = "D15", .type = NODE_SENSOR, .num = 62, .index = 62, .zone = 19,
+     .reverse = &TRACKA_NODES[63],
+     .edge =
+         {{.reverse = &TRACKA_NODES[29].edge[0], .src = &TRACKA_NODES[62],
+           .dest = &TRACKA_NODES[28], .dist = 201, .index = 124},
+          {.index = 125}}},
+    {.name = "D16", .type = NODE_SENSOR, .num = 63, .index = 63, .zone = 18,
+     .reverse = &TRACKA_NODES[62],
+     .edge =
+         {{.reverse = &TRACKA_NODES[112].edge[1], .src = &TRACKA_NODES[63],
+           .dest = &TRACKA_NODES[113], .dist = 246, .index = 126},
+          {.index = 127}}},
+    {.name = "E1", .type = NODE_SENSOR, .num = 64, .index = 64, .zone = 11,
+     .reverse = &TRACKA_NODES[65],
+     .edge =
+         {{.reverse = &TRACKA_NODES[122].edge[1], .src = &TRACKA_NODES[64],
+           .dest = &TRACKA_NODES[123], .dist = 239, .index = 128},
+          {.index = 129}}},
+    {.name = "E2", .type = NODE_SENSOR, .num = 65, .index = 65, .zone = 10,
+     .reverse = &TRACKA_NODES[64],
+     .edge =
+         {{.reverse = &TRACKA_NODES[79].edge[0], .src = &TRACKA_NODES[65],
+           .dest = &TRACKA_NODES[78], .dist = 201, .index = 130},
+          {.index = 131}}},
+    {.name = "E3", .type = NODE_SENSOR, .num = 66, .index = 66, .zone = 12,
+     .reverse = &TRACKA_NODES[67],
+     .edge =
+         {{.reverse = &TRACKA_NODES[49].edge[0], .src = &TRACKA_NODES[66],
+           .dest = &TRACKA_NODES[48], .dist = 201, .index = 132},
+          {.index = 133}}},
+    {.name = "E4", .type = NODE_SENSOR, .num = 67, .index = 67, .zone = 13,
+     .reverse = &TRACKA_NODES[66],
+     .edge =
+         {{.reverse = &TRACKA_NODES[98].edge[1], .src = &TRACKA_NODES[67],
+           .dest = &TRACKA_NODES[99], .dist = 239, .index = 134},
+          {.index = 135}}},
+    {.name = "E5", .type = NODE_SENSOR, .num = 68, .index = 68, .zone = 14,
+     .reverse = &TRACKA_NODES[69],
+     .edge =
+         {{.reverse = &TRACKA_NODES[52].edge[0], .src = &TRACKA_NODES[68],
+           .dest = &TRACKA_NODES[53], .dist = 376, .index = 136},
+          {.index = 137}}},
+    {.name = "E6", .type = NODE_SENSOR, .num = 69, .index = 69, .zone = 13,
+     .reverse = &TRACKA_NODES[68],
+     .edge =
+         {{.reverse = &TRACKA_NODES[99].edge[0], .src = &TRACKA_NODES[69],
+           .dest = &TRACKA_NODES[98], .dist = 50, .index = 138},
+          {.index = 139}}},
+    {.name = "E7", .type = NODE_SENSOR, .num = 70, .index = 70, .zone = 8,
+     .reverse = &TRACKA_NODES[71],
+     .edge =
+         {{.reverse = &TRACKA_NODES[55].edge[0], .src = &TRACKA_NODES[70],
+           .dest = &TRACKA_NODES[54], .dist = 384, .index = 140},
+          {.index = 141}}},
+    {.name = "E8", .type = NODE_SENSOR, .num = 71, .index = 71, .zone = 5,
+     .reverse = &TRACKA_NODES[70],
+     .edge =
+         {{.reverse = &TRACKA_NODES[44].edge[0], .src = &TRACKA_NODES[71],
+           .dest = &TRACKA_NODES[45], .dist = 875, .index = 142},
+          {.index = 143}}},
+    {.name = "E9", .type = NODE_SENSOR, .num = 72, .index = 72, .zone = 15,
+     .reverse = &TRACKA_NODES[73],
+     .edge =
+         {{.reverse = &TRACKA_NODES[94].edge[1], .src = &TRACKA_NODES[72],
+           .dest = &TRACKA_NODES[95], .dist = 239, .index = 144},
+          {.index = 145}}},
+    {.name = "E10", .type = NODE_SENSOR, .num = 73, .index = 73, .zone = 17,
+     .reverse = &TRACKA_NODES[72],
+     .edge =
+         {{.reverse = &TRACKA_NODES[77].edge[0], .src = &TRACKA_NODES[73],
+           .dest = &TRACKA_NODES[76], .dist = 376, .index = 146},
+          {.index = 147}}},
+    {.name = "E11", .type = NODE_SENSOR, .num = 74, .index = 74, .zone = 16,
+     .reverse = &TRACKA_NODES[75],
+     .edge =
+         {{.reverse = &TRACKA_NODES[56].edge[0], .src = &TRACKA_NODES[74],
+           .dest = &TRACKA_NODES[57], .dist = 369, .index = 148},
+          {.index = 149}}},
+    {.name = "E12", .type = NODE_SENSOR, .num = 75, .index = 75, .zone = 24,
+     .reverse = &TRACKA_NODES[74],
+     .edge =
+         {{.reverse = &TRACKA_NODES[93].edge[0], .src = &TRACKA_NODES[75],
+           .dest = &TRACKA_NODES[92], .dist = 50, .index = 150},
+          {.index = 151}}},
+    {.name = "E13", .type = NODE_SENSOR, .num = 76, .index = 76, .zone = 18,
+     .reverse = &TRACKA_NODES[77],
+     .edge =
+         {{.reverse = &TRACKA_NODES[113].edge[0], .src = &TRACKA_NODES[76],
+           .dest = &TRACKA_NODES[112], .dist = 43, .index = 152},
+          {.index = 153}}},
+    {.name = "E14", .type = NODE_SENSOR, .num = 77, .index = 77, .zone = 17,
+     .reverse = &TRACKA_NODES[76],
+     .edge =
+         {{.reverse = &TRACKA_NODES[73].edge[0], .src = &TRACKA_NODES[77],
+           .dest = &TRACKA_NODES[72], .dist = 376, .index = 154},
+          {.index = 155}}},
+    {.name = "E15", .type = NODE_SENSOR, .num = 78, .index = 78, .zone = 6,
+     .reverse = &TRACKA_NODES[79],
+     .edge =
+         {{.reverse = &TRACKA_NODES[104].edge[1], .src = &TRACKA_NODES[78],
+           .dest = &TRACKA_NODES[105], .dist = 246, .index = 156},
+          {.index = 157}}},
+    {.name = "E16", .type = NODE_SENSOR, .num = 79, .index = 79, .zone = 10,
+     .reverse = &TRACKA_NODES[78],
+     .edge =
+         {{.reverse = &TRACKA_NODES[65].edge[0], .src = &TRACKA_NODES[79],
+           .dest = &TRACKA_NODES[64], .dist = 201, .index = 158},
+          {.index = 159}}},
+    {.name = "BR1", .type = NODE_BRANCH, .num = 1, .index = 80, .zone = 26,
+     .reverse = &TRACKA_NODES[81],
+     .edge =
+         {{.reverse = &TRACKA_NODES[10].edge[0], .src = &TRACKA_NODES[80],
+           .dest = &TRACKA_NODES[11], .dist = 518, .index = 160},
+          {.reverse = &TRACKA_NODES[9].edge[0], .src = &TRACKA_NODES[80],
+           .dest = &TRACKA_NODES[8], .dist = 229, .index = 161}}},
+    {.name = "MR1", .type = NODE_MERGE, .num = 1, .index = 81, .zone = 26,
+     .reverse = &TRACKA_NODES[80],
+     .edge =
+         {{.reverse = &TRACKA_NODES[82].edge[0], .src = &TRACKA_NODES[81],
+           .dest = &TRACKA_NODES[83], .dist = 188, .index = 162},
+          {.index = 163}}},
+    {.name = "BR2", .type = NODE_BRANCH, .num = 2, .index = 82, .zone = 26,
+     .reverse = &TRACKA_NODES[83],
+     .edge =
+         {{.reverse = &TRACKA_NODES[81].edge[0], .src = &TRACKA_NODES[82],
+           .dest = &TRACKA_NODES[80], .dist = 188, .index = 164},
+          {.reverse = &TRACKA_NODES[7].edge[0], .src = &TRACKA_NODES[82],
+           .dest = &TRACKA_NODES[6], .dist = 229, .index = 165}}},
+    {.name = "MR2", .type = NODE_MERGE, .num = 2, .index = 83, .zone = 26,
+     .reverse = &TRACKA_NODES[82],
+     .edge =
+         {{.reverse = &TRACKA_NODES[84].edge[1], .src = &TRACKA_NODES[83],
+           .dest = &TRACKA_NODES[85], .dist = 185, .index = 166},
+          {.index = 167}}},
+    {.name = "BR3", .type = NODE_BRANCH, .num = 3, .index = 84, .zone = 26,
+     .reverse = &TRACKA_NODES[85],
+     .edge =
+         {{.reverse = &TRACKA_NODES[4].edge[0], .src = &TRACKA_NODES[84],
+           .dest = &TRACKA_NODES[5], .dist = 231, .index = 168},
+          {.reverse = &TRACKA_NODES[83].edge[0], .src = &TRACKA_NODES[84],
+           .dest = &TRACKA_NODES[82], .dist = 185, .index = 169}}},
+    {.name = "MR3", .type = NODE_MERGE, .num = 3, .index = 85, .zone = 26,
+     .reverse = &TRACKA_NODES[84],
+     .edge =
+         {{.reverse = &TRACKA_NODES[39].edge[0], .src = &TRACKA_NODES[85],
+           .dest = &TRACKA_NODES[38], .dist = 128, .index = 170},
+          {.index = 171}}},
+    {.name = "BR4", .type = NODE_BRANCH, .num = 4, .index = 86, .zone = 4,
+     .reverse = &TRACKA_NODES[87],
+     .edge =
+         {{.reverse = &TRACKA_NODES[15].edge[0], .src = &TRACKA_NODES[86],
+           .dest = &TRACKA_NODES[14], .dist = 417, .index = 172},
+          {.reverse = &TRACKA_NODES[12].edge[0], .src = &TRACKA_NODES[86],
+           .dest = &TRACKA_NODES[13], .dist = 236, .index = 173}}},
+    {.name = "MR4", .type = NODE_MERGE, .num = 4, .index = 87, .zone = 4,
+     .reverse = &TRACKA_NODES[86],
+     .edge =
+         {{.reverse = &TRACKA_NODES[102].edge[1], .src = &TRACKA_NODES[87],
+           .dest = &TRACKA_NODES[103], .dist = 185, .index = 174},
+          {.index = 175}}},
+    {.name = "BR5", .type = NODE_BRANCH, .num = 5, .index = 88, .zone = 24,
+     .reverse = &TRACKA_NODES[89],
+     .edge =
+         {{.reverse = &TRACKA_NODES[35].edge[0], .src = &TRACKA_NODES[88],
+           .dest = &TRACKA_NODES[34], .dist = 239, .index = 176},
+          {.reverse = &TRACKA_NODES[92].edge[1], .src = &TRACKA_NODES[88],
+           .dest = &TRACKA_NODES[93], .dist = 371, .index = 177}}},
+    {.name = "MR5", .type = NODE_MERGE, .num = 5, .index = 89, .zone = 24,
+     .reverse = &TRACKA_NODES[88],
+     .edge =
+         {{.reverse = &TRACKA_NODES[115].edge[0], .src = &TRACKA_NODES[89],
+           .dest = &TRACKA_NODES[114], .dist = 155, .index = 178},
+          {.index = 179}}},
+    {.name = "BR6", .type = NODE_BRANCH, .num = 6, .index = 90, .zone = 24,
+     .reverse = &TRACKA_NODES[91],
+     .edge =
+         {{.reverse = &TRACKA_NODES[47].edge[0], .src = &TRACKA_NODES[90],
+           .dest = &TRACKA_NODES[46], .dist = 239, .index = 180},
+          {.reverse = &TRACKA_NODES[114].edge[1], .src = &TRACKA_NODES[90],
+           .dest = &TRACKA_NODES[115], .dist = 371, .index = 181}}},
+    {.name = "MR6", .type = NODE_MERGE, .num = 6, .index = 91, .zone = 24,
+     .reverse = &TRACKA_NODES[90],
+     .edge =
+         {{.reverse = &TRACKA_NODES[36].edge[0], .src = &TRACKA_NODES[91],
+           .dest = &TRACKA_NODES[37], .dist = 61, .index = 182},
+          {.index = 183}}},
+    {.name = "BR7", .type = NODE_BRANCH, .num = 7, .index = 92, .zone = 24,
+     .reverse = &TRACKA_NODES[93],
+     .edge =
+         {{.reverse = &TRACKA_NODES[59].edge[0], .src = &TRACKA_NODES[92],
+           .dest = &TRACKA_NODES[58], .dist = 231, .index = 184},
+          {.reverse = &TRACKA_NODES[88].edge[1], .src = &TRACKA_NODES[92],
+           .dest = &TRACKA_NODES[89], .dist = 371, .index = 185}}},
+    {.name = "MR7", .type = NODE_MERGE, .num = 7, .index = 93, .zone = 24,
+     .reverse = &TRACKA_NODES[92],
+     .edge =
+         {{.reverse = &TRACKA_NODES[75].edge[0], .src = &TRACKA_NODES[93],
+           .dest = &TRACKA_NODES[74], .dist = 50, .index = 186},
+          {.index = 187}}},
+    {.name = "BR8", .type = NODE_BRANCH, .num = 8, .index = 94, .zone = 15,
+     .reverse = &TRACKA_NODES[95],
+     .edge =
+         {{.reverse = &TRACKA_NODES[57].edge[0], .src = &TRACKA_NODES[94],
+           .dest = &TRACKA_NODES[56], .dist = 316, .index = 188},
+          {.reverse = &TRACKA_NODES[72].edge[0], .src = &TRACKA_NODES[94],
+           .dest = &TRACKA_NODES[73], .dist = 239, .index = 189}}},
+    {.name = "MR8", .type = NODE_MERGE, .num = 8, .index = 95, .zone = 15,
+     .reverse = &TRACKA_NODES[94],
+     .edge =
+         {{.reverse = &TRACKA_NODES[97].edge[0], .src = &TRACKA_NODES[95],
+           .dest = &TRACKA_NODES[96], .dist = 155, .index = 190},
+          {.index = 191}}},
+    {.name = "BR9", .type = NODE_BRANCH, .num = 9, .index = 96, .zone = 15,
+     .reverse = &TRACKA_NODES[97],
+     .edge =
+         {{.reverse = &TRACKA_NODES[54].edge[0], .src = &TRACKA_NODES[96],
+           .dest = &TRACKA_NODES[55], .dist = 309, .index = 192},
+          {.reverse = &TRACKA_NODES[53].edge[0], .src = &TRACKA_NODES[96],
+           .dest = &TRACKA_NODES[52], .dist = 239, .index = 193}}},
+    {.name = "MR9", .type = NODE_MERGE, .num = 9, .index = 97, .zone = 15,
+     .reverse = &TRACKA_NODES[96],
+     .edge =
+         {{.reverse = &TRACKA_NODES[95].edge[0], .src = &TRACKA_NODES[97],
+           .dest = &TRACKA_NODES[94], .dist = 155, .index = 194},
+          {.index = 195}}},
+    {.name = "BR10", .type = NODE_BRANCH, .num = 10, .index = 98, .zone = 13,
+     .reverse = &TRACKA_NODES[99],
+     .edge =
+         {{.reverse = &TRACKA_NODES[50].edge[0], .src = &TRACKA_NODES[98],
+           .dest = &TRACKA_NODES[51], .dist = 239, .index = 196},
+          {.reverse = &TRACKA_NODES[67].edge[0], .src = &TRACKA_NODES[98],
+           .dest = &TRACKA_NODES[66], .dist = 239, .index = 197}}},
+    {.name = "MR10", .type = NODE_MERGE, .num = 10, .index = 99, .zone = 13,
+     .reverse = &TRACKA_NODES[98],
+     .edge =
+         {{.reverse = &TRACKA_NODES[69].edge[0], .src = &TRACKA_NODES[99],
+           .dest = &TRACKA_NODES[68], .dist = 50, .index = 198},
+          {.index = 199}}},
+    {.name = "BR11", .type = NODE_BRANCH, .num = 11, .index = 100, .zone = 4,
+     .reverse = &TRACKA_NODES[101],
+     .edge =
+         {{.reverse = &TRACKA_NODES[103].edge[0], .src = &TRACKA_NODES[100],
+           .dest = &TRACKA_NODES[102], .dist = 188, .index = 200},
+          {.reverse = &TRACKA_NODES[106].edge[0], .src = &TRACKA_NODES[100],
+           .dest = &TRACKA_NODES[107], .dist = 495, .index = 201}}},
+    {.name = "MR11", .type = NODE_MERGE, .num = 11, .index = 101, .zone = 4,
+     .reverse = &TRACKA_NODES[100],
+     .edge =
+         {{.reverse = &TRACKA_NODES[45].edge[0], .src = &TRACKA_NODES[101],
+           .dest = &TRACKA_NODES[44], .dist = 43, .index = 202},
+          {.index = 203}}},
+    {.name = "BR12", .type = NODE_BRANCH, .num = 12, .index = 102, .zone = 4,
+     .reverse = &TRACKA_NODES[103],
+     .edge =
+         {{.reverse = &TRACKA_NODES[0].edge[0], .src = &TRACKA_NODES[102],
+           .dest = &TRACKA_NODES[1], .dist = 231, .index = 204},
+          {.reverse = &TRACKA_NODES[87].edge[0], .src = &TRACKA_NODES[102],
+           .dest = &TRACKA_NODES[86], .dist = 185, .index = 205}}},
+    {.name = "MR12", .type = NODE_MERGE, .num = 12, .index = 103, .zone = 4,
+     .reverse = &TRACKA_NODES[102],
+     .edge =
+         {{.reverse = &TRACKA_NODES[100].edge[0], .src = &TRACKA_NODES[103],
+           .dest = &TRACKA_NODES[101], .dist = 188, .index = 206},
+          {.index = 207}}},
+    {.name = "BR13", .type = NODE_BRANCH, .num = 13, .index = 104, .zone = 6,
+     .reverse = &TRACKA_NODES[105],
+     .edge =
+         {{.reverse = &TRACKA_NODES[21].edge[0], .src = &TRACKA_NODES[104],
+           .dest = &TRACKA_NODES[20], .dist = 231, .index = 208},
+          {.reverse = &TRACKA_NODES[78].edge[0], .src = &TRACKA_NODES[104],
+           .dest = &TRACKA_NODES[79], .dist = 246, .index = 209}}},
+    {.name = "MR13", .type = NODE_MERGE, .num = 13, .index = 105, .zone = 6,
+     .reverse = &TRACKA_NODES[104],
+     .edge =
+         {{.reverse = &TRACKA_NODES[42].edge[0], .src = &TRACKA_NODES[105],
+           .dest = &TRACKA_NODES[43], .dist = 120, .index = 210},
+          {.index = 211}}},
+    {.name = "BR14", .type = NODE_BRANCH, .num = 14, .index = 106, .zone = 4,
+     .reverse = &TRACKA_NODES[107],
+     .edge =
+         {{.reverse = &TRACKA_NODES[100].edge[1], .src = &TRACKA_NODES[106],
+           .dest = &TRACKA_NODES[101], .dist = 495, .index = 212},
+          {.reverse = &TRACKA_NODES[43].edge[0], .src = &TRACKA_NODES[106],
+           .dest = &TRACKA_NODES[42], .dist = 333, .index = 213}}},
+    {.name = "MR14", .type = NODE_MERGE, .num = 14, .index = 107, .zone = 4,
+     .reverse = &TRACKA_NODES[106],
+     .edge =
+         {{.reverse = &TRACKA_NODES[2].edge[0], .src = &TRACKA_NODES[107],
+           .dest = &TRACKA_NODES[3], .dist = 43, .index = 214},
+          {.index = 215}}},
+    {.name = "BR15", .type = NODE_BRANCH, .num = 15, .index = 108, .zone = 21,
+     .reverse = &TRACKA_NODES[109],
+     .edge =
+         {{.reverse = &TRACKA_NODES[37].edge[0], .src = &TRACKA_NODES[108],
+           .dest = &TRACKA_NODES[36], .dist = 433, .index = 216},
+          {.reverse = &TRACKA_NODES[40].edge[0], .src = &TRACKA_NODES[108],
+           .dest = &TRACKA_NODES[41], .dist = 326, .index = 217}}},
+    {.name = "MR15", .type = NODE_MERGE, .num = 15, .index = 109, .zone = 21,
+     .reverse = &TRACKA_NODES[108],
+     .edge =
+         {{.reverse = &TRACKA_NODES[31].edge[0], .src = &TRACKA_NODES[109],
+           .dest = &TRACKA_NODES[30], .dist = 50, .index = 218},
+          {.index = 219}}},
+    {.name = "BR16", .type = NODE_BRANCH, .num = 16, .index = 110, .zone = 22,
+     .reverse = &TRACKA_NODES[111],
+     .edge =
+         {{.reverse = &TRACKA_NODES[17].edge[0], .src = &TRACKA_NODES[110],
+           .dest = &TRACKA_NODES[16], .dist = 231, .index = 220},
+          {.reverse = &TRACKA_NODES[19].edge[0], .src = &TRACKA_NODES[110],
+           .dest = &TRACKA_NODES[18], .dist = 239, .index = 221}}},
+    {.name = "MR16", .type = NODE_MERGE, .num = 16, .index = 111, .zone = 22,
+     .reverse = &TRACKA_NODES[110],
+     .edge =
+         {{.reverse = &TRACKA_NODES[41].edge[0], .src = &TRACKA_NODES[111],
+           .dest = &TRACKA_NODES[40], .dist = 128, .index = 222},
+          {.index = 223}}},
+    {.name = "BR17", .type = NODE_BRANCH, .num = 17, .index = 112, .zone = 18,
+     .reverse = &TRACKA_NODES[113],
+     .edge =
+         {{.reverse = &TRACKA_NODES[61].edge[0], .src = &TRACKA_NODES[112],
+           .dest = &TRACKA_NODES[60], .dist = 239, .index = 224},
+          {.reverse = &TRACKA_NODES[63].edge[0], .src = &TRACKA_NODES[112],
+           .dest = &TRACKA_NODES[62], .dist = 246, .index = 225}}},
+    {.name = "MR17", .type = NODE_MERGE, .num = 17, .index = 113, .zone = 18,
+     .reverse = &TRACKA_NODES[112],
+     .edge =
+         {{.reverse = &TRACKA_NODES[76].edge[0], .src = &TRACKA_NODES[113],
+           .dest = &TRACKA_NODES[77], .dist = 43, .index = 226},
+          {.index = 227}}},
+    {.name = "BR18", .type = NODE_BRANCH, .num = 18, .index = 114, .zone = 24,
+     .reverse = &TRACKA_NODES[115],
+     .edge =
+         {{.reverse = &TRACKA_NODES[38].edge[0], .src = &TRACKA_NODES[114],
+           .dest = &TRACKA_NODES[39], .dist = 231, .index = 228},
+          {.reverse = &TRACKA_NODES[90].edge[1], .src = &TRACKA_NODES[114],
+           .dest = &TRACKA_NODES[91], .dist = 371, .index = 229}}},
+    {.name = "MR18", .type = NODE_MERGE, .num = 18, .index = 115, .zone = 24,
+     .reverse = &TRACKA_NODES[114],
+     .edge =
+         {{.reverse = &TRACKA_NODES[89].edge[0], .src = &TRACKA_NODES[115],
+           .dest = &TRACKA_NODES[88], .dist = 155, .index = 230},
+          {.index = 231}}},
+    {.name = "BR153", .type = NODE_BRANCH, .num = 153, .index = 116, .zone = 11,
+     .reverse = &TRACKA_NODES[117],
+     .edge =
+         {{.reverse = &TRACKA_NODES[124].edge[0], .src = &TRACKA_NODES[116],
+           .dest = &TRACKA_NODES[125], .dist = 253, .index = 232},
+          {.reverse = &TRACKA_NODES[33].edge[0], .src = &TRACKA_NODES[116],
+           .dest = &TRACKA_NODES[32], .dist = 246, .index = 233}}},
+    {.name = "MR153", .type = NODE_MERGE, .num = 153, .index = 117, .zone = 11,
+     .reverse = &TRACKA_NODES[116],
+     .edge =
+         {{.reverse = &TRACKA_NODES[118].edge[0], .src = &TRACKA_NODES[117],
+           .dest = &TRACKA_NODES[119], .dist = 0, .index = 234},
+          {.index = 235}}},
+    {.name = "BR154", .type = NODE_BRANCH, .num = 154, .index = 118, .zone = 11,
+     .reverse = &TRACKA_NODES[119],
+     .edge =
+         {{.reverse = &TRACKA_NODES[117].edge[0], .src = &TRACKA_NODES[118],
+           .dest = &TRACKA_NODES[116], .dist = 0, .index = 236},
+          {.reverse = &TRACKA_NODES[28].edge[0], .src = &TRACKA_NODES[118],
+           .dest = &TRACKA_NODES[29], .dist = 239, .index = 237}}},
+    {.name = "MR154", .type = NODE_MERGE, .num = 154, .index = 119, .zone = 11,
+     .reverse = &TRACKA_NODES[118],
+     .edge =
+         {{.reverse = &TRACKA_NODES[123].edge[0], .src = &TRACKA_NODES[119],
+           .dest = &TRACKA_NODES[122], .dist = 0, .index = 238},
+          {.index = 239}}},
+    {.name = "BR155", .type = NODE_BRANCH, .num = 155, .index = 120, .zone = 11,
+     .reverse = &TRACKA_NODES[121],
+     .edge =
+         {{.reverse = &TRACKA_NODES[126].edge[0], .src = &TRACKA_NODES[120],
+           .dest = &TRACKA_NODES[127], .dist = 282, .index = 240},
+          {.reverse = &TRACKA_NODES[48].edge[0], .src = &TRACKA_NODES[120],
+           .dest = &TRACKA_NODES[49], .dist = 246, .index = 241}}},
+    {.name = "MR155", .type = NODE_MERGE, .num = 155, .index = 121, .zone = 11,
+     .reverse = &TRACKA_NODES[120],
+     .edge =
+         {{.reverse = &TRACKA_NODES[122].edge[0], .src = &TRACKA_NODES[121],
+           .dest = &TRACKA_NODES[123], .dist = 0, .index = 242},
+          {.index = 243}}},
+    {.name = "BR156", .type = NODE_BRANCH, .num = 156, .index = 122, .zone = 11,
+     .reverse = &TRACKA_NODES[123],
+     .edge =
+         {{.reverse = &TRACKA_NODES[121].edge[0], .src = &TRACKA_NODES[122],
+           .dest = &TRACKA_NODES[120], .dist = 0, .index = 244},
+          {.reverse = &TRACKA_NODES[64].edge[0], .src = &TRACKA_NODES[122],
+           .dest = &TRACKA_NODES[65], .dist = 239, .index = 245}}},
+    {.name = "MR156", .type = NODE_MERGE, .num = 156, .index = 123, .zone = 11,
+     .reverse = &TRACKA_NODES[122],
+     .edge =
+         {{.reverse = &TRACKA_NODES[119].edge[0], .src = &TRACKA_NODES[123],
+           .dest = &TRACKA_NODES[118], .dist = 0, .index = 246},
+          {.index = 247}}},
+    {.name = "EN1", .type = NODE_ENTER, .num = 0, .index = 124, .zone = 0,
+     .reverse = &TRACKA_NODES[125],
+     .edge =
+         {{.reverse = &TRACKA_NODES[116].edge[0], .src = &TRACKA_NODES[124],
+           .dest = &TRACKA_NODES[117], .dist = 253, .index = 248},
+          {.index = 249}}},
+    {.name = "EX1", .type = NODE_EXIT, .num = 0, .index = 125, .zone = 0,
+     .reverse = &TRACKA_NODES[124],
+     .edge =
+         {{.index = 250},
+          {.index = 251}}},
+    {.name = "EN2", .type = NODE_ENTER, .num = 0, .index = 126, .zone = 0,
+     .reverse = &TRACKA_NODES[127],
+     .edge =
+         {{.reverse = &TRACKA_NODES[120].edge[0], .src = &TRACKA_NODES[126],
+           .dest = &TRACKA_NODES[121], .dist = 282, .index = 252},
+          {.index = 253}}},
+    {.name = "EX2", .type = NODE_EXIT, .num = 0, .index = 127, .zone = 0,
+     .reverse = &TRACKA_NODES[126],
+     .edge =
+         {{.index = 254},
+          {.index = 255}}},
+    {.name = "EN3", .type = NODE_ENTER, .num = 0, .index = 128, .zone = 0,
+     .reverse = &TRACKA_NODES[129],
+     .edge =
+         {{.reverse = &TRACKA_NODES[34].edge[0], .src = &TRACKA_NODES[128],
+           .dest = &TRACKA_NODES[35], .dist = 514, .index = 256},
+          {.index = 257}}},
+    {.name = "EX3", .type = NODE_EXIT, .num = 0, .index = 129, .zone = 0,
+     .reverse = &TRACKA_NODES[128],
+     .edge =
+         {{.index = 258},
+          {.index = 259}}},
+    {.name = "EN4", .type = NODE_ENTER, .num = 0, .index = 130, .zone = 0,
+     .reverse = &TRACKA_NODES[131],
+     .edge =
+         {{.reverse = &TRACKA_NODES[13].edge[0], .src = &TRACKA_NODES[130],
+           .dest = &TRACKA_NODES[12], .dist = 325, .index = 260},
+          {.index = 261}}},
+    {.name = "EX4", .type = NODE_EXIT, .num = 0, .index = 131, .zone = 0,
+     .reverse = &TRACKA_NODES[130],
+     .edge =
+         {{.index = 262},
+          {.index = 263}}},
+    {.name = "EN5", .type = NODE_ENTER, .num = 0, .index = 132, .zone = 0,
+     .reverse = &TRACKA_NODES[133],
+     .edge =
+         {{.reverse = &TRACKA_NODES[1].edge[0], .src = &TRACKA_NODES[132],
+           .dest = &TRACKA_NODES[0], .dist = 504, .index = 264},
+          {.index = 265}}},
+    {.name = "EX5", .type = NODE_EXIT, .num = 0, .index = 133, .zone = 0,
+     .reverse = &TRACKA_NODES[132],
+     .edge =
+         {{.index = 266},
+          {.index = 267}}},
+    {.name = "EN6", .type = NODE_ENTER, .num = 0, .index = 134, .zone = 0,
+     .reverse = &TRACKA_NODES[135],
+     .edge =
+         {{.reverse = &TRACKA_NODES[14].edge[0], .src = &TRACKA_NODES[134],
+           .dest = &TRACKA_NODES[15], .dist = 144, .index = 268},
+          {.index = 269}}},
+    {.name = "EX6", .type = NODE_EXIT, .num = 0, .index = 135, .zone = 0,
+     .reverse = &TRACKA_NODES[134],
+     .edge =
+         {{.index = 270},
+          {.index = 271}}},
+    {.name = "EN7", .type = NODE_ENTER, .num = 0, .index = 136, .zone = 0,
+     .reverse = &TRACKA_NODES[137],
+     .edge =
+         {{.reverse = &TRACKA_NODES[23].edge[0], .src = &TRACKA_NODES[136],
+           .dest = &TRACKA_NODES[22], .dist = 43, .index = 272},
+          {.index = 273}}},
+    {.name = "EX7", .type = NODE_EXIT, .num = 0, .index = 137, .zone = 0,
+     .reverse = &TRACKA_NODES[136],
+     .edge =
+         {{.index = 274},
+          {.index = 275}}},
+    {.name = "EN8", .type = NODE_ENTER, .num = 0, .index = 138, .zone = 0,
+     .reverse = &TRACKA_NODES[139],
+     .edge =
+         {{.reverse = &TRACKA_NODES[11].edge[0], .src = &TRACKA_NODES[138],
+           .dest = &TRACKA_NODES[10], .dist = 43, .index = 276},
+          {.index = 277}}},
+    {.name = "EX8", .type = NODE_EXIT, .num = 0, .index = 139, .zone = 0,
+     .reverse = &TRACKA_NODES[138],
+     .edge =
+         {{.index = 278},
+          {.index = 279}}},
+    {.name = "EN9", .type = NODE_ENTER, .num = 0, .index = 140, .zone = 0,
+     .reverse = &TRACKA_NODES[141],
+     .edge =
+         {{.reverse = &TRACKA_NODES[25].edge[0], .src = &TRACKA_NODES[140],
+           .dest = &TRACKA_NODES[24], .dist = 50, .index = 280},
+          {.index = 281}}},
+    {.name = "EX9", .type = NODE_EXIT, .num = 0, .index = 141, .zone = 0,
+     .reverse = &TRACKA_NODES[140],
+     .edge =
+         {{.index = 282},
+          {.index = 283}}},
+    {.name = "EN10", .type = NODE_ENTER, .num = 0, .index = 142, .zone = 0,
+     .reverse = &TRACKA_NODES[143],
+     .edge =
+         {{.reverse = &TRACKA_NODES[27].edge[0], .src = &TRACKA_NODES[142],
+           .dest = &TRACKA_NODES[26], .dist = 50, .index = 284},
+          {.index = 285}}},
+    {.name = "EX10", .type = NODE_EXIT, .num = 0, .index = 143, .zone = 0,
+     .reverse = &TRACKA_NODES[142],
+     .edge =
+         {{.index = 286},
+          {.index = 287}}},
+};
+
+const struct TrackNode TRACKB_NODES[TRACK_MAX] = {
+    {.name = "A1", .type = NODE_SENSOR, .num = 0, .index = 0, .zone = 4,
+     .reverse = &TRACKB_NODES[1],
+     .edge =
+         {{.reverse = &TRACKB_NODES[102].edge[0], .src = &TRACKB_NODES[0],
+           .dest = &TRACKB_NODES[103], .dist = 231, .index = 0},
+          {.index = 1}}},
+    {.name = "A2", .type = NODE_SENSOR, .num = 1, .index = 1, .zone = 1,
+     .reverse = &TRACKB_NODES[0],
+     .edge =
+         {{.reverse = &TRACKB_NODES[132].edge[0], .src = &TRACKB_NODES[1],
+           .dest = &TRACKB_NODES[133], .dist = 504, .index = 2},
+          {.index = 3}}},
+    {.name = "A3", .type = NODE_SENSOR, .num = 2, .index = 2, .zone = 4,
+     .reverse = &TRACKB_NODES[3],
+     .edge =
+         {{.reverse = &TRACKB_NODES[107].edge[0], .src = &TRACKB_NODES[2],
+           .dest = &TRACKB_NODES[106], .dist = 43, .index = 4},
+          {.index = 5}}},
+    {.name = "A4", .type = NODE_SENSOR, .num = 3, .index = 3, .zone = 7,
+     .reverse = &TRACKB_NODES[2],
+     .edge =
+         {{.reverse = &TRACKB_NODES[30].edge[0], .src = &TRACKB_NODES[3],
+           .dest = &TRACKB_NODES[31], .dist = 437, .index = 6},
+          {.index = 7}}},
+    {.name = "A5", .type = NODE_SENSOR, .num = 4, .index = 4, .zone = 26,
+     .reverse = &TRACKB_NODES[5],
+     .edge =
+         {{.reverse = &TRACKB_NODES[84].edge[0], .src = &TRACKB_NODES[4],
+           .dest = &TRACKB_NODES[85], .dist = 231, .index = 8},
+          {.index = 9}}},
+    {.name = "A6", .type = NODE_SENSOR, .num = 5, .index = 5, .zone = 29,
+     .reverse = &TRACKB_NODES[4],
+     .edge =
+         {{.reverse = &TRACKB_NODES[24].edge[0], .src = &TRACKB_NODES[5],
+           .dest = &TRACKB_NODES[25], .dist = 642, .index = 10},
+          {.index = 11}}},
+    {.name = "A7", .type = NODE_SENSOR, .num = 6, .index = 6, .zone = 28,
+     .reverse = &TRACKB_NODES[7],
+     .edge =
+         {{.reverse = &TRACKB_NODES[26].edge[0], .src = &TRACKB_NODES[6],
+           .dest = &TRACKB_NODES[27], .dist = 470, .index = 12},
+          {.index = 13}}},
+    {.name = "A8", .type = NODE_SENSOR, .num = 7, .index = 7, .zone = 26,
+     .reverse = &TRACKB_NODES[6],
+     .edge =
+         {{.reverse = &TRACKB_NODES[82].edge[1], .src = &TRACKB_NODES[7],
+           .dest = &TRACKB_NODES[83], .dist = 229, .index = 14},
+          {.index = 15}}},
+    {.name = "A9", .type = NODE_SENSOR, .num = 8, .index = 8, .zone = 27,
+     .reverse = &TRACKB_NODES[9],
+     .edge =
+         {{.reverse = &TRACKB_NODES[22].edge[0], .src = &TRACKB_NODES[8],
+           .dest = &TRACKB_NODES[23], .dist = 289, .index = 16},
+          {.index = 17}}},
+    {.name = "A10", .type = NODE_SENSOR, .num = 9, .index = 9, .zone = 26,
+     .reverse = &TRACKB_NODES[8],
+     .edge =
+         {{.reverse = &TRACKB_NODES[80].edge[1], .src = &TRACKB_NODES[9],
+           .dest = &TRACKB_NODES[81], .dist = 229, .index = 18},
+          {.index = 19}}},
+    {.name = "A11", .type = NODE_SENSOR, .num = 10, .index = 10, .zone = 26,
+     .reverse = &TRACKB_NODES[11],
+     .edge =
+         {{.reverse = &TRACKB_NODES[80].edge[0], .src = &TRACKB_NODES[10],
+           .dest = &TRACKB_NODES[81], .dist = 282, .index = 20},
+          {.index = 21}}},
+    {.name = "A12", .type = NODE_SENSOR, .num = 11, .index = 11, .zone = 3,
+     .reverse = &TRACKB_NODES[10],
+     .edge =
+         {{.reverse = &TRACKB_NODES[14].edge[0], .src = &TRACKB_NODES[11],
+           .dest = &TRACKB_NODES[15], .dist = 814, .index = 22},
+          {.index = 23}}},
+    {.name = "A13", .type = NODE_SENSOR, .num = 12, .index = 12, .zone = 4,
+     .reverse = &TRACKB_NODES[13],
+     .edge =
+         {{.reverse = &TRACKB_NODES[86].edge[1], .src = &TRACKB_NODES[12],
+           .dest = &TRACKB_NODES[87], .dist = 236, .index = 24},
+          {.index = 25}}},
+    {.name = "A14", .type = NODE_SENSOR, .num = 13, .index = 13, .zone = 2,
+     .reverse = &TRACKB_NODES[12],
+     .edge =
+         {{.reverse = &TRACKB_NODES[130].edge[0], .src = &TRACKB_NODES[13],
+           .dest = &TRACKB_NODES[131], .dist = 325, .index = 26},
+          {.index = 27}}},
+    {.name = "A15", .type = NODE_SENSOR, .num = 14, .index = 14, .zone = 3,
+     .reverse = &TRACKB_NODES[15],
+     .edge =
+         {{.reverse = &TRACKB_NODES[11].edge[0], .src = &TRACKB_NODES[14],
+           .dest = &TRACKB_NODES[10], .dist = 814, .index = 28},
+          {.index = 29}}},
+    {.name = "A16", .type = NODE_SENSOR, .num = 15, .index = 15, .zone = 4,
+     .reverse = &TRACKB_NODES[14],
+     .edge =
+         {{.reverse = &TRACKB_NODES[86].edge[0], .src = &TRACKB_NODES[15],
+           .dest = &TRACKB_NODES[87], .dist = 275, .index = 30},
+          {.index = 31}}},
+    {.name = "B1", .type = NODE_SENSOR, .num = 16, .index = 16, .zone = 23,
+     .reverse = &TRACKB_NODES[17],
+     .edge =
+         {{.reverse = &TRACKB_NODES[60].edge[0], .src = &TRACKB_NODES[16],
+           .dest = &TRACKB_NODES[61], .dist = 404, .index = 32},
+          {.index = 33}}},
+    {.name = "B2", .type = NODE_SENSOR, .num = 17, .index = 17, .zone = 22,
+     .reverse = &TRACKB_NODES[16],
+     .edge =
+         {{.reverse = &TRACKB_NODES[110].edge[0], .src = &TRACKB_NODES[17],
+           .dest = &TRACKB_NODES[111], .dist = 231, .index = 34},
+          {.index = 35}}},
+    {.name = "B3", .type = NODE_SENSOR, .num = 18, .index = 18, .zone = 20,
+     .reverse = &TRACKB_NODES[19],
+     .edge =
+         {{.reverse = &TRACKB_NODES[32].edge[0], .src = &TRACKB_NODES[18],
+           .dest = &TRACKB_NODES[33], .dist = 201, .index = 36},
+          {.index = 37}}},
+    {.name = "B4", .type = NODE_SENSOR, .num = 19, .index = 19, .zone = 22,
+     .reverse = &TRACKB_NODES[18],
+     .edge =
+         {{.reverse = &TRACKB_NODES[110].edge[1], .src = &TRACKB_NODES[19],
+           .dest = &TRACKB_NODES[111], .dist = 239, .index = 38},
+          {.index = 39}}},
+    {.name = "B5", .type = NODE_SENSOR, .num = 20, .index = 20, .zone = 9,
+     .reverse = &TRACKB_NODES[21],
+     .edge =
+         {{.reverse = &TRACKB_NODES[51].edge[0], .src = &TRACKB_NODES[20],
+           .dest = &TRACKB_NODES[50], .dist = 404, .index = 40},
+          {.index = 41}}},
+    {.name = "B6", .type = NODE_SENSOR, .num = 21, .index = 21, .zone = 6,
+     .reverse = &TRACKB_NODES[20],
+     .edge =
+         {{.reverse = &TRACKB_NODES[104].edge[0], .src = &TRACKB_NODES[21],
+           .dest = &TRACKB_NODES[105], .dist = 231, .index = 42},
+          {.index = 43}}},
+    {.name = "B7", .type = NODE_SENSOR, .num = 22, .index = 22, .zone = 27,
+     .reverse = &TRACKB_NODES[23],
+     .edge =
+         {{.reverse = &TRACKB_NODES[8].edge[0], .src = &TRACKB_NODES[22],
+           .dest = &TRACKB_NODES[9], .dist = 289, .index = 44},
+          {.index = 45}}},
+    {.name = "B8", .type = NODE_SENSOR, .num = 23, .index = 23, .zone = 31,
+     .reverse = &TRACKB_NODES[22],
+     .edge =
+         {{.reverse = &TRACKB_NODES[134].edge[0], .src = &TRACKB_NODES[23],
+           .dest = &TRACKB_NODES[135], .dist = 43, .index = 46},
+          {.index = 47}}},
+    {.name = "B9", .type = NODE_SENSOR, .num = 24, .index = 24, .zone = 29,
+     .reverse = &TRACKB_NODES[25],
+     .edge =
+         {{.reverse = &TRACKB_NODES[5].edge[0], .src = &TRACKB_NODES[24],
+           .dest = &TRACKB_NODES[4], .dist = 642, .index = 48},
+          {.index = 49}}},
+    {.name = "B10", .type = NODE_SENSOR, .num = 25, .index = 25, .zone = 32,
+     .reverse = &TRACKB_NODES[24],
+     .edge =
+         {{.reverse = &TRACKB_NODES[136].edge[0], .src = &TRACKB_NODES[25],
+           .dest = &TRACKB_NODES[137], .dist = 50, .index = 50},
+          {.index = 51}}},
+    {.name = "B11", .type = NODE_SENSOR, .num = 26, .index = 26, .zone = 28,
+     .reverse = &TRACKB_NODES[27],
+     .edge =
+         {{.reverse = &TRACKB_NODES[6].edge[0], .src = &TRACKB_NODES[26],
+           .dest = &TRACKB_NODES[7], .dist = 470, .index = 52},
+          {.index = 53}}},
+    {.name = "B12", .type = NODE_SENSOR, .num = 27, .index = 27, .zone = 33,
+     .reverse = &TRACKB_NODES[26],
+     .edge =
+         {{.reverse = &TRACKB_NODES[138].edge[0], .src = &TRACKB_NODES[27],
+           .dest = &TRACKB_NODES[139], .dist = 50, .index = 54},
+          {.index = 55}}},
+    {.name = "B13", .type = NODE_SENSOR, .num = 28, .index = 28, .zone = 11,
+     .reverse = &TRACKB_NODES[29],
+     .edge =
+         {{.reverse = &TRACKB_NODES[118].edge[1], .src = &TRACKB_NODES[28],
+           .dest = &TRACKB_NODES[119], .dist = 239, .index = 56},
+          {.index = 57}}},
+    {.name = "B14", .type = NODE_SENSOR, .num = 29, .index = 29, .zone = 19,
+     .reverse = &TRACKB_NODES[28],
+     .edge =
+         {{.reverse = &TRACKB_NODES[62].edge[0], .src = &TRACKB_NODES[29],
+           .dest = &TRACKB_NODES[63], .dist = 201, .index = 58},
+          {.index = 59}}},
+    {.name = "B15", .type = NODE_SENSOR, .num = 30, .index = 30, .zone = 7,
+     .reverse = &TRACKB_NODES[31],
+     .edge =
+         {{.reverse = &TRACKB_NODES[3].edge[0], .src = &TRACKB_NODES[30],
+           .dest = &TRACKB_NODES[2], .dist = 437, .index = 60},
+          {.index = 61}}},
+    {.name = "B16", .type = NODE_SENSOR, .num = 31, .index = 31, .zone = 21,
+     .reverse = &TRACKB_NODES[30],
+     .edge =
+         {{.reverse = &TRACKB_NODES[109].edge[0], .src = &TRACKB_NODES[31],
+           .dest = &TRACKB_NODES[108], .dist = 50, .index = 62},
+          {.index = 63}}},
+    {.name = "C1", .type = NODE_SENSOR, .num = 32, .index = 32, .zone = 20,
+     .reverse = &TRACKB_NODES[33],
+     .edge =
+         {{.reverse = &TRACKB_NODES[18].edge[0], .src = &TRACKB_NODES[32],
+           .dest = &TRACKB_NODES[19], .dist = 201, .index = 64},
+          {.index = 65}}},
+    {.name = "C2", .type = NODE_SENSOR, .num = 33, .index = 33, .zone = 11,
+     .reverse = &TRACKB_NODES[32],
+     .edge =
+         {{.reverse = &TRACKB_NODES[116].edge[1], .src = &TRACKB_NODES[33],
+           .dest = &TRACKB_NODES[117], .dist = 246, .index = 66},
+          {.index = 67}}},
+    {.name = "C3", .type = NODE_SENSOR, .num = 34, .index = 34, .zone = 30,
+     .reverse = &TRACKB_NODES[35],
+     .edge =
+         {{.reverse = &TRACKB_NODES[128].edge[0], .src = &TRACKB_NODES[34],
+           .dest = &TRACKB_NODES[129], .dist = 514, .index = 68},
+          {.index = 69}}},
+    {.name = "C4", .type = NODE_SENSOR, .num = 35, .index = 35, .zone = 24,
+     .reverse = &TRACKB_NODES[34],
+     .edge =
+         {{.reverse = &TRACKB_NODES[88].edge[0], .src = &TRACKB_NODES[35],
+           .dest = &TRACKB_NODES[89], .dist = 239, .index = 70},
+          {.index = 71}}},
+    {.name = "C5", .type = NODE_SENSOR, .num = 36, .index = 36, .zone = 24,
+     .reverse = &TRACKB_NODES[37],
+     .edge =
+         {{.reverse = &TRACKB_NODES[91].edge[0], .src = &TRACKB_NODES[36],
+           .dest = &TRACKB_NODES[90], .dist = 61, .index = 72},
+          {.index = 73}}},
+    {.name = "C6", .type = NODE_SENSOR, .num = 37, .index = 37, .zone = 21,
+     .reverse = &TRACKB_NODES[36],
+     .edge =
+         {{.reverse = &TRACKB_NODES[108].edge[0], .src = &TRACKB_NODES[37],
+           .dest = &TRACKB_NODES[109], .dist = 433, .index = 74},
+          {.index = 75}}},
+    {.name = "C7", .type = NODE_SENSOR, .num = 38, .index = 38, .zone = 24,
+     .reverse = &TRACKB_NODES[39],
+     .edge =
+         {{.reverse = &TRACKB_NODES[114].edge[0], .src = &TRACKB_NODES[38],
+           .dest = &TRACKB_NODES[115], .dist = 231, .index = 76},
+          {.index = 77}}},
+    {.name = "C8", .type = NODE_SENSOR, .num = 39, .index = 39, .zone = 26,
+     .reverse = &TRACKB_NODES[38],
+     .edge =
+         {{.reverse = &TRACKB_NODES[85].edge[0], .src = &TRACKB_NODES[39],
+           .dest = &TRACKB_NODES[84], .dist = 128, .index = 78},
+          {.index = 79}}},
+    {.name = "C9", .type = NODE_SENSOR, .num = 40, .index = 40, .zone = 21,
+     .reverse = &TRACKB_NODES[41],
+     .edge =
+         {{.reverse = &TRACKB_NODES[108].edge[1], .src = &TRACKB_NODES[40],
+           .dest = &TRACKB_NODES[109], .dist = 326, .index = 80},
+          {.index = 81}}},
+    {.name = "C10", .type = NODE_SENSOR, .num = 41, .index = 41, .zone = 22,
+     .reverse = &TRACKB_NODES[40],
+     .edge =
+         {{.reverse = &TRACKB_NODES[111].edge[0], .src = &TRACKB_NODES[41],
+           .dest = &TRACKB_NODES[110], .dist = 128, .index = 82},
+          {.index = 83}}},
+    {.name = "C11", .type = NODE_SENSOR, .num = 42, .index = 42, .zone = 6,
+     .reverse = &TRACKB_NODES[43],
+     .edge =
+         {{.reverse = &TRACKB_NODES[105].edge[0], .src = &TRACKB_NODES[42],
+           .dest = &TRACKB_NODES[104], .dist = 120, .index = 84},
+          {.index = 85}}},
+    {.name = "C12", .type = NODE_SENSOR, .num = 43, .index = 43, .zone = 4,
+     .reverse = &TRACKB_NODES[42],
+     .edge =
+         {{.reverse = &TRACKB_NODES[106].edge[1], .src = &TRACKB_NODES[43],
+           .dest = &TRACKB_NODES[107], .dist = 333, .index = 86},
+          {.index = 87}}},
+    {.name = "C13", .type = NODE_SENSOR, .num = 44, .index = 44, .zone = 5,
+     .reverse = &TRACKB_NODES[45],
+     .edge =
+         {{.reverse = &TRACKB_NODES[71].edge[0], .src = &TRACKB_NODES[44],
+           .dest = &TRACKB_NODES[70], .dist = 780, .index = 88},
+          {.index = 89}}},
+    {.name = "C14", .type = NODE_SENSOR, .num = 45, .index = 45, .zone = 4,
+     .reverse = &TRACKB_NODES[44],
+     .edge =
+         {{.reverse = &TRACKB_NODES[101].edge[0], .src = &TRACKB_NODES[45],
+           .dest = &TRACKB_NODES[100], .dist = 50, .index = 90},
+          {.index = 91}}},
+    {.name = "C15", .type = NODE_SENSOR, .num = 46, .index = 46, .zone = 25,
+     .reverse = &TRACKB_NODES[47],
+     .edge =
+         {{.reverse = &TRACKB_NODES[58].edge[0], .src = &TRACKB_NODES[46],
+           .dest = &TRACKB_NODES[59], .dist = 404, .index = 92},
+          {.index = 93}}},
+    {.name = "C16", .type = NODE_SENSOR, .num = 47, .index = 47, .zone = 24,
+     .reverse = &TRACKB_NODES[46],
+     .edge =
+         {{.reverse = &TRACKB_NODES[90].edge[0], .src = &TRACKB_NODES[47],
+           .dest = &TRACKB_NODES[91], .dist = 239, .index = 94},
+          {.index = 95}}},
+    {.name = "D1", .type = NODE_SENSOR, .num = 48, .index = 48, .zone = 11,
+     .reverse = &TRACKB_NODES[49],
+     .edge =
+         {{.reverse = &TRACKB_NODES[120].edge[1], .src = &TRACKB_NODES[48],
+           .dest = &TRACKB_NODES[121], .dist = 246, .index = 96},
+          {.index = 97}}},
+    {.name = "D2", .type = NODE_SENSOR, .num = 49, .index = 49, .zone = 12,
+     .reverse = &TRACKB_NODES[48],
+     .edge =
+         {{.reverse = &TRACKB_NODES[66].edge[0], .src = &TRACKB_NODES[49],
+           .dest = &TRACKB_NODES[67], .dist = 201, .index = 98},
+          {.index = 99}}},
+    {.name = "D3", .type = NODE_SENSOR, .num = 50, .index = 50, .zone = 13,
+     .reverse = &TRACKB_NODES[51],
+     .edge =
+         {{.reverse = &TRACKB_NODES[98].edge[0], .src = &TRACKB_NODES[50],
+           .dest = &TRACKB_NODES[99], .dist = 239, .index = 100},
+          {.index = 101}}},
+    {.name = "D4", .type = NODE_SENSOR, .num = 51, .index = 51, .zone = 9,
+     .reverse = &TRACKB_NODES[50],
+     .edge =
+         {{.reverse = &TRACKB_NODES[20].edge[0], .src = &TRACKB_NODES[51],
+           .dest = &TRACKB_NODES[21], .dist = 404, .index = 102},
+          {.index = 103}}},
+    {.name = "D5", .type = NODE_SENSOR, .num = 52, .index = 52, .zone = 14,
+     .reverse = &TRACKB_NODES[53],
+     .edge =
+         {{.reverse = &TRACKB_NODES[68].edge[0], .src = &TRACKB_NODES[52],
+           .dest = &TRACKB_NODES[69], .dist = 282, .index = 104},
+          {.index = 105}}},
+    {.name = "D6", .type = NODE_SENSOR, .num = 53, .index = 53, .zone = 15,
+     .reverse = &TRACKB_NODES[52],
+     .edge =
+         {{.reverse = &TRACKB_NODES[96].edge[1], .src = &TRACKB_NODES[53],
+           .dest = &TRACKB_NODES[97], .dist = 229, .index = 106},
+          {.index = 107}}},
+    {.name = "D7", .type = NODE_SENSOR, .num = 54, .index = 54, .zone = 15,
+     .reverse = &TRACKB_NODES[55],
+     .edge =
+         {{.reverse = &TRACKB_NODES[96].edge[0], .src = &TRACKB_NODES[54],
+           .dest = &TRACKB_NODES[97], .dist = 309, .index = 108},
+          {.index = 109}}},
+    {.name = "D8", .type = NODE_SENSOR, .num = 55, .index = 55, .zone = 8,
+     .reverse = &TRACKB_NODES[54],
+     .edge =
+         {{.reverse = &TRACKB_NODES[70].edge[0], .src = &TRACKB_NODES[55],
+           .dest = &TRACKB_NODES[71], .dist = 376, .index = 110},
+          {.index = 111}}},
+    {.name = "D9", .type = NODE_SENSOR, .num = 56, .index = 56, .zone = 16,
+     .reverse = &TRACKB_NODES[57],
+     .edge =
+         {{.reverse = &TRACKB_NODES[74].edge[0], .src = &TRACKB_NODES[56],
+           .dest = &TRACKB_NODES[75], .dist = 282, .index = 112},
+          {.index = 113}}},
+    {.name = "D10", .type = NODE_SENSOR, .num = 57, .index = 57, .zone = 15,
+     .reverse = &TRACKB_NODES[56],
+     .edge =
+         {{.reverse = &TRACKB_NODES[94].edge[0], .src = &TRACKB_NODES[57],
+           .dest = &TRACKB_NODES[95], .dist = 316, .index = 114},
+          {.index = 115}}},
+    {.name = "D11", .type = NODE_SENSOR, .num = 58, .index = 58, .zone = 25,
+     .reverse = &TRACKB_NODES[59],
+     .edge =
+         {{.reverse = &TRACKB_NODES[46].edge[0], .src = &TRACKB_NODES[58],
+           .dest = &TRACKB_NODES[47], .dist = 404, .index = 116},
+          {.index = 117}}},
+    {.name = "D12", .type = NODE_SENSOR, .num = 59, .index = 59, .zone = 24,
+     .reverse = &TRACKB_NODES[58],
+     .edge =
+         {{.reverse = &TRACKB_NODES[92].edge[0], .src = &TRACKB_NODES[59],
+           .dest = &TRACKB_NODES[93], .dist = 231, .index = 118},
+          {.index = 119}}},
+    {.name = "D13", .type = NODE_SENSOR, .num = 60, .index = 60, .zone = 23,
+     .reverse = &TRACKB_NODES[61],
+     .edge =
+         {{.reverse = &TRACKB_NODES[16].edge[0], .src = &TRACKB_NODES[60],
+           .dest = &TRACKB_NODES[17], .dist = 404, .index = 120},
+          {.index = 121}}},
+    {.name = "D14", .type = NODE_SENSOR, .num = 61, .index = 61, .zone = 18,
+     .reverse = &TRACKB_NODES[60],
+     .edge =
+         {{.reverse = &TRACKB_NODES[112].edge[0], .src = &TRACKB_NODES[61],
+           .dest = &TRACKB_NODES[113], .dist = 239, .index = 122},
+          {.index = 123}}},
+    {.name = "D15", .type = NODE_SENSOR, .num = 62, .index = 62, .zone = 19,
+     .reverse = &TRACKB_NODES[63],
+     .edge =
+         {{.reverse = &TRACKB_NODES[29].edge[0], .src = &TRACKB_NODES[62],
+           .dest = &TRACKB_NODES[28], .dist = 201, .index = 124},
+          {.index = 125}}},
+    {.name = "D16", .type = NODE_SENSOR, .num = 63, .index = 63, .zone = 18,
+     .reverse = &TRACKB_NODES[62],
+     .edge =
+         {{.reverse = &TRACKB_NODES[112].edge[1], .src = &TRACKB_NODES[63],
+           .dest = &TRACKB_NODES[113], .dist = 246, .index = 126},
+          {.index = 127}}},
+    {.name = "E1", .type = NODE_SENSOR, .num = 64, .index = 64, .zone = 11,
+     .reverse = &TRACKB_NODES[65],
+     .edge =
+         {{.reverse = &TRACKB_NODES[122].edge[1], .src = &TRACKB_NODES[64],
+           .dest = &TRACKB_NODES[123], .dist = 239, .index = 128},
+          {.index = 129}}},
+    {.name = "E2", .type = NODE_SENSOR, .num = 65, .index = 65, .zone = 10,
+     .reverse = &TRACKB_NODES[64],
+     .edge =
+         {{.reverse = &TRACKB_NODES[79].edge[0], .src = &TRACKB_NODES[65],
+           .dest = &TRACKB_NODES[78], .dist = 201, .index = 130},
+          {.index = 131}}},
+    {.name = "E3", .type = NODE_SENSOR, .num = 66, .index = 66, .zone = 12,
+     .reverse = &TRACKB_NODES[67],
+     .edge =
+         {{.reverse = &TRACKB_NODES[49].edge[0], .src = &TRACKB_NODES[66],
+           .dest = &TRACKB_NODES[48], .dist = 201, .index = 132},
+          {.index = 133}}},
+    {.name = "E4", .type = NODE_SENSOR, .num = 67, .index = 67, .zone = 13,
+     .reverse = &TRACKB_NODES[66],
+     .edge =
+         {{.reverse = &TRACKB_NODES[98].edge[1], .src = &TRACKB_NODES[67],
+           .dest = &TRACKB_NODES[99], .dist = 239, .index = 134},
+          {.index = 135}}},
+    {.name = "E5", .type = NODE_SENSOR, .num = 68, .index = 68, .zone = 14,
+     .reverse = &TRACKB_NODES[69],
+     .edge =
+         {{.reverse = &TRACKB_NODES[52].edge[0], .src = &TRACKB_NODES[68],
+           .dest = &TRACKB_NODES[53], .dist = 282, .index = 136},
+          {.index = 137}}},
+    {.name = "E6", .type = NODE_SENSOR, .num = 69, .index = 69, .zone = 13,
+     .reverse = &TRACKB_NODES[68],
+     .edge =
+         {{.reverse = &TRACKB_NODES[99].edge[0], .src = &TRACKB_NODES[69],
+           .dest = &TRACKB_NODES[98], .dist = 50, .index = 138},
+          {.index = 139}}},
+    {.name = "E7", .type = NODE_SENSOR, .num = 70, .index = 70, .zone = 8,
+     .reverse = &TRACKB_NODES[71],
+     .edge =
+         {{.reverse = &TRACKB_NODES[55].edge[0], .src = &TRACKB_NODES[70],
+           .dest = &TRACKB_NODES[54], .dist = 376, .index = 140},
+          {.index = 141}}},
+    {.name = "E8", .type = NODE_SENSOR, .num = 71, .index = 71, .zone = 5,
+     .reverse = &TRACKB_NODES[70],
+     .edge =
+         {{.reverse = &TRACKB_NODES[44].edge[0], .src = &TRACKB_NODES[71],
+           .dest = &TRACKB_NODES[45], .dist = 780, .index = 142},
+          {.index = 143}}},
+    {.name = "E9", .type = NODE_SENSOR, .num = 72, .index = 72, .zone = 15,
+     .reverse = &TRACKB_NODES[73],
+     .edge =
+         {{.reverse = &TRACKB_NODES[94].edge[1], .src = &TRACKB_NODES[72],
+           .dest = &TRACKB_NODES[95], .dist = 239, .index = 144},
+          {.index = 145}}},
+    {.name = "E10", .type = NODE_SENSOR, .num = 73, .index = 73, .zone = 17,
+     .reverse = &TRACKB_NODES[72],
+     .edge =
+         {{.reverse = &TRACKB_NODES[77].edge[0], .src = &TRACKB_NODES[73],
+           .dest = &TRACKB_NODES[76], .dist = 282, .index = 146},
+          {.index = 147}}},
+    {.name = "E11", .type = NODE_SENSOR, .num = 74, .index = 74, .zone = 16,
+     .reverse = &TRACKB_NODES[75],
+     .edge =
+         {{.reverse = &TRACKB_NODES[56].edge[0], .src = &TRACKB_NODES[74],
+           .dest = &TRACKB_NODES[57], .dist = 282, .index = 148},
+          {.index = 149}}},
+    {.name = "E12", .type = NODE_SENSOR, .num = 75, .index = 75, .zone = 24,
+     .reverse = &TRACKB_NODES[74],
+     .edge =
+         {{.reverse = &TRACKB_NODES[93].edge[0], .src = &TRACKB_NODES[75],
+           .dest = &TRACKB_NODES[92], .dist = 43, .index = 150},
+          {.index = 151}}},
+    {.name = "E13", .type = NODE_SENSOR, .num = 76, .index = 76, .zone = 18,
+     .reverse = &TRACKB_NODES[77],
+     .edge =
+         {{.reverse = &TRACKB_NODES[113].edge[0], .src = &TRACKB_NODES[76],
+           .dest = &TRACKB_NODES[112], .dist = 43, .index = 152},
+          {.index = 153}}},
+    {.name = "E14", .type = NODE_SENSOR, .num = 77, .index = 77, .zone = 17,
+     .reverse = &TRACKB_NODES[76],
+     .edge =
+         {{.reverse = &TRACKB_NODES[73].edge[0], .src = &TRACKB_NODES[77],
+           .dest = &TRACKB_NODES[72], .dist = 282, .index = 154},
+          {.index = 155}}},
+    {.name = "E15", .type = NODE_SENSOR, .num = 78, .index = 78, .zone = 6,
+     .reverse = &TRACKB_NODES[79],
+     .edge =
+         {{.reverse = &TRACKB_NODES[104].edge[1], .src = &TRACKB_NODES[78],
+           .dest = &TRACKB_NODES[105], .dist = 246, .index = 156},
+          {.index = 157}}},
+    {.name = "E16", .type = NODE_SENSOR, .num = 79, .index = 79, .zone = 10,
+     .reverse = &TRACKB_NODES[78],
+     .edge =
+         {{.reverse = &TRACKB_NODES[65].edge[0], .src = &TRACKB_NODES[79],
+           .dest = &TRACKB_NODES[64], .dist = 201, .index = 158},
+          {.index = 159}}},
+    {.name = "BR1", .type = NODE_BRANCH, .num = 1, .index = 80, .zone = 26,
+     .reverse = &TRACKB_NODES[81],
+     .edge =
+         {{.reverse = &TRACKB_NODES[10].edge[0], .src = &TRACKB_NODES[80],
+           .dest = &TRACKB_NODES[11], .dist = 282, .index = 160},
+          {.reverse = &TRACKB_NODES[9].edge[0], .src = &TRACKB_NODES[80],
+           .dest = &TRACKB_NODES[8], .dist = 229, .index = 161}}},
+    {.name = "MR1", .type = NODE_MERGE, .num = 1, .index = 81, .zone = 26,
+     .reverse = &TRACKB_NODES[80],
+     .edge =
+         {{.reverse = &TRACKB_NODES[82].edge[0], .src = &TRACKB_NODES[81],
+           .dest = &TRACKB_NODES[83], .dist = 188, .index = 162},
+          {.index = 163}}},
+    {.name = "BR2", .type = NODE_BRANCH, .num = 2, .index = 82, .zone = 26,
+     .reverse = &TRACKB_NODES[83],
+     .edge =
+         {{.reverse = &TRACKB_NODES[81].edge[0], .src = &TRACKB_NODES[82],
+           .dest = &TRACKB_NODES[80], .dist = 188, .index = 164},
+          {.reverse = &TRACKB_NODES[7].edge[0], .src = &TRACKB_NODES[82],
+           .dest = &TRACKB_NODES[6], .dist = 229, .index = 165}}},
+    {.name = "MR2", .type = NODE_MERGE, .num = 2, .index = 83, .zone = 26,
+     .reverse = &TRACKB_NODES[82],
+     .edge =
+         {{.reverse = &TRACKB_NODES[84].edge[1], .src = &TRACKB_NODES[83],
+           .dest = &TRACKB_NODES[85], .dist = 185, .index = 166},
+          {.index = 167}}},
+    {.name = "BR3", .type = NODE_BRANCH, .num = 3, .index = 84, .zone = 26,
+     .reverse = &TRACKB_NODES[85],
+     .edge =
+         {{.reverse = &TRACKB_NODES[4].edge[0], .src = &TRACKB_NODES[84],
+           .dest = &TRACKB_NODES[5], .dist = 231, .index = 168},
+          {.reverse = &TRACKB_NODES[83].edge[0], .src = &TRACKB_NODES[84],
+           .dest = &TRACKB_NODES[82], .dist = 185, .index = 169}}},
+    {.name = "MR3", .type = NODE_MERGE, .num = 3, .index = 85, .zone = 26,
+     .reverse = &TRACKB_NODES[84],
+     .edge =
+         {{.reverse = &TRACKB_NODES[39].edge[0], .src = &TRACKB_NODES[85],
+           .dest = &TRACKB_NODES[38], .dist = 128, .index = 170},
+          {.index = 171}}},
+    {.name = "BR4", .type = NODE_BRANCH, .num = 4, .index = 86, .zone = 4,
+     .reverse = &TRACKB_NODES[87],
+     .edge =
+         {{.reverse = &TRACKB_NODES[15].edge[0], .src = &TRACKB_NODES[86],
+           .dest = &TRACKB_NODES[14], .dist = 275, .index = 172},
+          {.reverse = &TRACKB_NODES[12].edge[0], .src = &TRACKB_NODES[86],
+           .dest = &TRACKB_NODES[13], .dist = 236, .index = 173}}},
+    {.name = "MR4", .type = NODE_MERGE, .num = 4, .index = 87, .zone = 4,
+     .reverse = &TRACKB_NODES[86],
+     .edge =
+         {{.reverse = &TRACKB_NODES[102].edge[1], .src = &TRACKB_NODES[87],
+           .dest = &TRACKB_NODES[103], .dist = 185, .index = 174},
+          {.index = 175}}},
+    {.name = "BR5", .type = NODE_BRANCH, .num = 5, .index = 88, .zone = 24,
+     .reverse = &TRACKB_NODES[89],
+     .edge =
+         {{.reverse = &TRACKB_NODES[35].edge[0], .src = &TRACKB_NODES[88],
+           .dest = &TRACKB_NODES[34], .dist = 239, .index = 176},
+          {.reverse = &TRACKB_NODES[92].edge[1], .src = &TRACKB_NODES[88],
+           .dest = &TRACKB_NODES[93], .dist = 371, .index = 177}}},
+    {.name = "MR5", .type = NODE_MERGE, .num = 5, .index = 89, .zone = 24,
+     .reverse = &TRACKB_NODES[88],
+     .edge =
+         {{.reverse = &TRACKB_NODES[115].edge[0], .src = &TRACKB_NODES[89],
+           .dest = &TRACKB_NODES[114], .dist = 155, .index = 178},
+          {.index = 179}}},
+    {.name = "BR6", .type = NODE_BRANCH, .num = 6, .index = 90, .zone = 24,
+     .reverse = &TRACKB_NODES[91],
+     .edge =
+         {{.reverse = &TRACKB_NODES[47].edge[0], .src = &TRACKB_NODES[90],
+           .dest = &TRACKB_NODES[46], .dist = 239, .index = 180},
+          {.reverse = &TRACKB_NODES[114].edge[1], .src = &TRACKB_NODES[90],
+           .dest = &TRACKB_NODES[115], .dist = 371, .index = 181}}},
+    {.name = "MR6", .type = NODE_MERGE, .num = 6, .index = 91, .zone = 24,
+     .reverse = &TRACKB_NODES[90],
+     .edge =
+         {{.reverse = &TRACKB_NODES[36].edge[0], .src = &TRACKB_NODES[91],
+           .dest = &TRACKB_NODES[37], .dist = 61, .index = 182},
+          {.index = 183}}},
+    {.name = "BR7", .type = NODE_BRANCH, .num = 7, .index = 92, .zone = 24,
+     .reverse = &TRACKB_NODES[93],
+     .edge =
+         {{.reverse = &TRACKB_NODES[59].edge[0], .src = &TRACKB_NODES[92],
+           .dest = &TRACKB_NODES[58], .dist = 231, .index = 184},
+          {.reverse = &TRACKB_NODES[88].edge[1], .src = &TRACKB_NODES[92],
+           .dest = &TRACKB_NODES[89], .dist = 371, .index = 185}}},
+    {.name = "MR7", .type = NODE_MERGE, .num = 7, .index = 93, .zone = 24,
+     .reverse = &TRACKB_NODES[92],
+     .edge =
+         {{.reverse = &TRACKB_NODES[75].edge[0], .src = &TRACKB_NODES[93],
+           .dest = &TRACKB_NODES[74], .dist = 43, .index = 186},
+          {.index = 187}}},
+    {.name = "BR8", .type = NODE_BRANCH, .num = 8, .index = 94, .zone = 15,
+     .reverse = &TRACKB_NODES[95],
+     .edge =
+         {{.reverse = &TRACKB_NODES[57].edge[0], .src = &TRACKB_NODES[94],
+           .dest = &TRACKB_NODES[56], .dist = 316, .index = 188},
+          {.reverse = &TRACKB_NODES[72].edge[0], .src = &TRACKB_NODES[94],
+           .dest = &TRACKB_NODES[73], .dist = 239, .index = 189}}},
+    {.name = "MR8", .type = NODE_MERGE, .num = 8, .index = 95, .zone = 15,
+     .reverse = &TRACKB_NODES[94],
+     .edge =
+         {{.reverse = &TRACKB_NODES[97].edge[0], .src = &TRACKB_NODES[95],
+           .dest = &TRACKB_NODES[96], .dist = 155, .index = 190},
+          {.index = 191}}},
+    {.name = "BR9", .type = NODE_BRANCH, .num = 9, .index = 96, .zone = 15,
+     .reverse = &TRACKB_NODES[97],
+     .edge =
+         {{.reverse = &TRACKB_NODES[54].edge[0], .src = &TRACKB_NODES[96],
+           .dest = &TRACKB_NODES[55], .dist = 309, .index = 192},
+          {.reverse = &TRACKB_NODES[53].edge[0], .src = &TRACKB_NODES[96],
+           .dest = &TRACKB_NODES[52], .dist = 229, .index = 193}}},
+    {.name = "MR9", .type = NODE_MERGE, .num = 9, .index = 97, .zone = 15,
+     .reverse = &TRACKB_NODES[96],
+     .edge =
+         {{.reverse = &TRACKB_NODES[95].edge[0], .src = &TRACKB_NODES[97],
+           .dest = &TRACKB_NODES[94], .dist = 155, .index = 194},
+          {.index = 195}}},
+    {.name = "BR10", .type = NODE_BRANCH, .num = 10, .index = 98, .zone = 13,
+     .reverse = &TRACKB_NODES[99],
+     .edge =
+         {{.reverse = &TRACKB_NODES[50].edge[0], .src = &TRACKB_NODES[98],
+           .dest = &TRACKB_NODES[51], .dist = 239, .index = 196},
+          {.reverse = &TRACKB_NODES[67].edge[0], .src = &TRACKB_NODES[98],
+           .dest = &TRACKB_NODES[66], .dist = 239, .index = 197}}},
+    {.name = "MR10", .type = NODE_MERGE, .num = 10, .index = 99, .zone = 13,
+     .reverse = &TRACKB_NODES[98],
+     .edge =
+         {{.reverse = &TRACKB_NODES[69].edge[0], .src = &TRACKB_NODES[99],
+           .dest = &TRACKB_NODES[68], .dist = 50, .index = 198},
+          {.index = 199}}},
+    {.name = "BR11", .type = NODE_BRANCH, .num = 11, .index = 100, .zone = 4,
+     .reverse = &TRACKB_NODES[101],
+     .edge =
+         {{.reverse = &TRACKB_NODES[103].edge[0], .src = &TRACKB_NODES[100],
+           .dest = &TRACKB_NODES[102], .dist = 188, .index = 200},
+          {.reverse = &TRACKB_NODES[106].edge[0], .src = &TRACKB_NODES[100],
+           .dest = &TRACKB_NODES[107], .dist = 495, .index = 201}}},
+    {.name = "MR11", .type = NODE_MERGE, .num = 11, .index = 101, .zone = 4,
+     .reverse = &TRACKB_NODES[100],
+     .edge =
+         {{.reverse = &TRACKB_NODES[45].edge[0], .src = &TRACKB_NODES[101],
+           .dest = &TRACKB_NODES[44], .dist = 50, .index = 202},
+          {.index = 203}}},
+    {.name = "BR12", .type = NODE_BRANCH, .num = 12, .index = 102, .zone = 4,
+     .reverse = &TRACKB_NODES[103],
+     .edge =
+         {{.reverse = &TRACKB_NODES[0].edge[0], .src = &TRACKB_NODES[102],
+           .dest = &TRACKB_NODES[1], .dist = 231, .index = 204},
+          {.reverse = &TRACKB_NODES[87].edge[0], .src = &TRACKB_NODES[102],
+           .dest = &TRACKB_NODES[86], .dist = 185, .index = 205}}},
+    {.name = "MR12", .type = NODE_MERGE, .num = 12, .index = 103, .zone = 4,
+     .reverse = &TRACKB_NODES[102],
+     .edge =
+         {{.reverse = &TRACKB_NODES[100].edge[0], .src = &TRACKB_NODES[103],
+           .dest = &TRACKB_NODES[101], .dist = 188, .index = 206},
+          {.index = 207}}},
+    {.name = "BR13", .type = NODE_BRANCH, .num = 13, .index = 104, .zone = 6,
+     .reverse = &TRACKB_NODES[105],
+     .edge =
+         {{.reverse = &TRACKB_NODES[21].edge[0], .src = &TRACKB_NODES[104],
+           .dest = &TRACKB_NODES[20], .dist = 231, .index = 208},
+          {.reverse = &TRACKB_NODES[78].edge[0], .src = &TRACKB_NODES[104],
+           .dest = &TRACKB_NODES[79], .dist = 246, .index = 209}}},
+    {.name = "MR13", .type = NODE_MERGE, .num = 13, .index = 105, .zone = 6,
+     .reverse = &TRACKB_NODES[104],
+     .edge =
+         {{.reverse = &TRACKB_NODES[42].edge[0], .src = &TRACKB_NODES[105],
+           .dest = &TRACKB_NODES[43], .dist = 120, .index = 210},
+          {.index = 211}}},
+    {.name = "BR14", .type = NODE_BRANCH, .num = 14, .index = 106, .zone = 4,
+     .reverse = &TRACKB_NODES[107],
+     .edge =
+         {{.reverse = &TRACKB_NODES[100].edge[1], .src = &TRACKB_NODES[106],
+           .dest = &TRACKB_NODES[101], .dist = 495, .index = 212},
+          {.reverse = &TRACKB_NODES[43].edge[0], .src = &TRACKB_NODES[106],
+           .dest = &TRACKB_NODES[42], .dist = 333, .index = 213}}},
+    {.name = "MR14", .type = NODE_MERGE, .num = 14, .index = 107, .zone = 4,
+     .reverse = &TRACKB_NODES[106],
+     .edge =
+         {{.reverse = &TRACKB_NODES[2].edge[0], .src = &TRACKB_NODES[107],
+           .dest = &TRACKB_NODES[3], .dist = 43, .index = 214},
+          {.index = 215}}},
+    {.name = "BR15", .type = NODE_BRANCH, .num = 15, .index = 108, .zone = 21,
+     .reverse = &TRACKB_NODES[109],
+     .edge =
+         {{.reverse = &TRACKB_NODES[37].edge[0], .src = &TRACKB_NODES[108],
+           .dest = &TRACKB_NODES[36], .dist = 433, .index = 216},
+          {.reverse = &TRACKB_NODES[40].edge[0], .src = &TRACKB_NODES[108],
+           .dest = &TRACKB_NODES[41], .dist = 326, .index = 217}}},
+    {.name = "MR15", .type = NODE_MERGE, .num = 15, .index = 109, .zone = 21,
+     .reverse = &TRACKB_NODES[108],
+     .edge =
+         {{.reverse = &TRACKB_NODES[31].edge[0], .src = &TRACKB_NODES[109],
+           .dest = &TRACKB_NODES[30], .dist = 50, .index = 218},
+          {.index = 219}}},
+    {.name = "BR16", .type = NODE_BRANCH, .num = 16, .index = 110, .zone = 22,
+     .reverse = &TRACKB_NODES[111],
+     .edge =
+         {{.reverse = &TRACKB_NODES[17].edge[0], .src = &TRACKB_NODES[110],
+           .dest = &TRACKB_NODES[16], .dist = 231, .index = 220},
+          {.reverse = &TRACKB_NODES[19].edge[0], .src = &TRACKB_NODES[110],
+           .dest = &TRACKB_NODES[18], .dist = 239, .index = 221}}},
+    {.name = "MR16", .type = NODE_MERGE, .num = 16, .index = 111, .zone = 22,
+     .reverse = &TRACKB_NODES[110],
+     .edge =
+         {{.reverse = &TRACKB_NODES[41].edge[0], .src = &TRACKB_NODES[111],
+           .dest = &TRACKB_NODES[40], .dist = 128, .index = 222},
+          {.index = 223}}},
+    {.name = "BR17", .type = NODE_BRANCH, .num = 17, .index = 112, .zone = 18,
+     .reverse = &TRACKB_NODES[113],
+     .edge =
+         {{.reverse = &TRACKB_NODES[61].edge[0], .src = &TRACKB_NODES[112],
+           .dest = &TRACKB_NODES[60], .dist = 239, .index = 224},
+          {.reverse = &TRACKB_NODES[63].edge[0], .src = &TRACKB_NODES[112],
+           .dest = &TRACKB_NODES[62], .dist = 246, .index = 225}}},
+    {.name = "MR17", .type = NODE_MERGE, .num = 17, .index = 113, .zone = 18,
+     .reverse = &TRACKB_NODES[112],
+     .edge =
+         {{.reverse = &TRACKB_NODES[76].edge[0], .src = &TRACKB_NODES[113],
+           .dest = &TRACKB_NODES[77], .dist = 43, .index = 226},
+          {.index = 227}}},
+    {.name = "BR18", .type = NODE_BRANCH, .num = 18, .index = 114, .zone = 24,
+     .reverse = &TRACKB_NODES[115],
+     .edge =
+         {{.reverse = &TRACKB_NODES[38].edge[0], .src = &TRACKB_NODES[114],
+           .dest = &TRACKB_NODES[39], .dist = 231, .index = 228},
+          {.reverse = &TRACKB_NODES[90].edge[1], .src = &TRACKB_NODES[114],
+           .dest = &TRACKB_NODES[91], .dist = 371, .index = 229}}},
+    {.name = "MR18", .type = NODE_MERGE, .num = 18, .index = 115, .zone = 24,
+     .reverse = &TRACKB_NODES[114],
+     .edge =
+         {{.reverse = &TRACKB_NODES[89].edge[0], .src = &TRACKB_NODES[115],
+           .dest = &TRACKB_NODES[88], .dist = 155, .index = 230},
+          {.index = 231}}},
+    {.name = "BR153", .type = NODE_BRANCH, .num = 153, .index = 116, .zone = 11,
+     .reverse = &TRACKB_NODES[117],
+     .edge =
+         {{.reverse = &TRACKB_NODES[124].edge[0], .src = &TRACKB_NODES[116],
+           .dest = &TRACKB_NODES[125], .dist = 253, .index = 232},
+          {.reverse = &TRACKB_NODES[33].edge[0], .src = &TRACKB_NODES[116],
+           .dest = &TRACKB_NODES[32], .dist = 246, .index = 233}}},
+    {.name = "MR153", .type = NODE_MERGE, .num = 153, .index = 117, .zone = 11,
+     .reverse = &TRACKB_NODES[116],
+     .edge =
+         {{.reverse = &TRACKB_NODES[118].edge[0], .src = &TRACKB_NODES[117],
+           .dest = &TRACKB_NODES[119], .dist = 0, .index = 234},
+          {.index = 235}}},
+    {.name = "BR154", .type = NODE_BRANCH, .num = 154, .index = 118, .zone = 11,
+     .reverse = &TRACKB_NODES[119],
+     .edge =
+         {{.reverse = &TRACKB_NODES[117].edge[0], .src = &TRACKB_NODES[118],
+           .dest = &TRACKB_NODES[116], .dist = 0, .index = 236},
+          {.reverse = &TRACKB_NODES[28].edge[0], .src = &TRACKB_NODES[118],
+           .dest = &TRACKB_NODES[29], .dist = 239, .index = 237}}},
+    {.name = "MR154", .type = NODE_MERGE, .num = 154, .index = 119, .zone = 11,
+     .reverse = &TRACKB_NODES[118],
+     .edge =
+         {{.reverse = &TRACKB_NODES[123].edge[0], .src = &TRACKB_NODES[119],
+           .dest = &TRACKB_NODES[122], .dist = 0, .index = 238},
+          {.index = 239}}},
+    {.name = "BR155", .type = NODE_BRANCH, .num = 155, .index = 120, .zone = 11,
+     .reverse = &TRACKB_NODES[121],
+     .edge =
+         {{.reverse = &TRACKB_NODES[126].edge[0], .src = &TRACKB_NODES[120],
+           .dest = &TRACKB_NODES[127], .dist = 282, .index = 240},
+          {.reverse = &TRACKB_NODES[48].edge[0], .src = &TRACKB_NODES[120],
+           .dest = &TRACKB_NODES[49], .dist = 246, .index = 241}}},
+    {.name = "MR155", .type = NODE_MERGE, .num = 155, .index = 121, .zone = 11,
+     .reverse = &TRACKB_NODES[120],
+     .edge =
+         {{.reverse = &TRACKB_NODES[122].edge[0], .src = &TRACKB_NODES[121],
+           .dest = &TRACKB_NODES[123], .dist = 0, .index = 242},
+          {.index = 243}}},
+    {.name = "BR156", .type = NODE_BRANCH, .num = 156, .index = 122, .zone = 11,
+     .reverse = &TRACKB_NODES[123],
+     .edge =
+         {{.reverse = &TRACKB_NODES[121].edge[0], .src = &TRACKB_NODES[122],
+           .dest = &TRACKB_NODES[120], .dist = 0, .index = 244},
+          {.reverse = &TRACKB_NODES[64].edge[0], .src = &TRACKB_NODES[122],
+           .dest = &TRACKB_NODES[65], .dist = 239, .index = 245}}},
+    {.name = "MR156", .type = NODE_MERGE, .num = 156, .index = 123, .zone = 11,
+     .reverse = &TRACKB_NODES[122],
+     .edge =
+         {{.reverse = &TRACKB_NODES[119].edge[0], .src = &TRACKB_NODES[123],
+           .dest = &TRACKB_NODES[118], .dist = 0, .index = 246},
+          {.index = 247}}},
+    {.name = "EN1", .type = NODE_ENTER, .num = 0, .index = 124, .zone = 0,
+     .reverse = &TRACKB_NODES[125],
+     .edge =
+         {{.reverse = &TRACKB_NODES[116].edge[0], .src = &TRACKB_NODES[124],
+           .dest = &TRACKB_NODES[117], .dist = 253, .index = 248},
+          {.index = 249}}},
+    {.name = "EX1", .type = NODE_EXIT, .num = 0, .index = 125, .zone = 0,
+     .reverse = &TRACKB_NODES[124],
+     .edge =
+         {{.index = 250},
+          {.index = 251}}},
+    {.name = "EN2", .type = NODE_ENTER, .num = 0, .index = 126, .zone = 0,
+     .reverse = &TRACKB_NODES[127],
+     .edge =
+         {{.reverse = &TRACKB_NODES[120].edge[0], .src = &TRACKB_NODES[126],
+           .dest = &TRACKB_NODES[121], .dist = 282, .index = 252},
+          {.index = 253}}},
+    {.name = "EX2", .type = NODE_EXIT, .num = 0, .index = 127, .zone = 0,
+     .reverse = &TRACKB_NODES[126],
+     .edge =
+         {{.index = 254},
+          {.index = 255}}},
+    {.name = "EN3", .type = NODE_ENTER, .num = 0, .index = 128, .zone = 0,
+     .reverse = &TRACKB_NODES[129],
+     .edge =
+         {{.reverse = &TRACKB_NODES[34].edge[0], .src = &TRACKB_NODES[128],
+           .dest = &TRACKB_NODES[35], .dist = 514, .index = 256},
+          {.index = 257}}},
+    {.name = "EX3", .type = NODE_EXIT, .num = 0, .index = 129, .zone = 0,
+     .reverse = &TRACKB_NODES[128],
+     .edge =
+         {{.index = 258},
+          {.index = 259}}},
+    {.name = "EN4", .type = NODE_ENTER, .num = 0, .index = 130, .zone = 0,
+     .reverse = &TRACKB_NODES[131],
+     .edge =
+         {{.reverse = &TRACKB_NODES[13].edge[0], .src = &TRACKB_NODES[130],
+           .dest = &TRACKB_NODES[12], .dist = 325, .index = 260},
+          {.index = 261}}},
+    {.name = "EX4", .type = NODE_EXIT, .num = 0, .index = 131, .zone = 0,
+     .reverse = &TRACKB_NODES[130],
+     .edge =
+         {{.index = 262},
+          {.index = 263}}},
+    {.name = "EN5", .type = NODE_ENTER, .num = 0, .index = 132, .zone = 0,
+     .reverse = &TRACKB_NODES[133],
+     .edge =
+         {{.reverse = &TRACKB_NODES[1].edge[0], .src = &TRACKB_NODES[132],
+           .dest = &TRACKB_NODES[0], .dist = 504, .index = 264},
+          {.index = 265}}},
+    {.name = "EX5", .type = NODE_EXIT, .num = 0, .index = 133, .zone = 0,
+     .reverse = &TRACKB_NODES[132],
+     .edge =
+         {{.index = 266},
+          {.index = 267}}},
+    {.name = "EN7", .type = NODE_ENTER, .num = 0, .index = 134, .zone = 0,
+     .reverse = &TRACKB_NODES[135],
+     .edge =
+         {{.reverse = &TRACKB_NODES[23].edge[0], .src = &TRACKB_NODES[134],
+           .dest = &TRACKB_NODES[22], .dist = 43, .index = 268},
+          {.index = 269}}},
+    {.name = "EX7", .type = NODE_EXIT, .num = 0, .index = 135, .zone = 0,
+     .reverse = &TRACKB_NODES[134],
+     .edge =
+         {{.index = 270},
+          {.index = 271}}},
+    {.name = "EN9", .type = NODE_ENTER, .num = 0, .index = 136, .zone = 0,
+     .reverse = &TRACKB_NODES[137],
+     .edge =
+         {{.reverse = &TRACKB_NODES[25].edge[0], .src = &TRACKB_NODES[136],
+           .dest = &TRACKB_NODES[24], .dist = 50, .index = 272},
+          {.index = 273}}},
+    {.name = "EX9", .type = NODE_EXIT, .num = 0, .index = 137, .zone = 0,
+     .reverse = &TRACKB_NODES[136],
+     .edge =
+         {{.index = 274},
+          {.index = 275}}},
+    {.name = "EN10", .type = NODE_ENTER, .num = 0, .index = 138, .zone = 0,
+     .reverse = &TRACKB_NODES[139],
+     .edge =
+         {{.reverse = &TRACKB_NODES[27].edge[0], .src = &TRACKB_NODES[138],
+           .dest = &TRACKB_NODES[26], .dist = 50, .index = 276},
+          {.index = 277}}},
+    {.name = "EX10", .type = NODE_EXIT, .num = 0, .index = 139, .zone = 0,
+     .reverse = &TRACKB_NODES[138],
+     .edge =
+         {{.index = 278},
+          {.index = 279}}},
+    {.type = NODE_NONE, .num = 0, .index = 140, .zone = 0,
+     .edge =
+         {{.index = 280},
+          {.index = 281}}},
+    {.type = NODE_NONE, .num = 0, .index = 141, .zone = 0,
+     .edge =
+         {{.index = 282},
+          {.index = 283}}},
+    {.type = NODE_NONE, .num = 0, .index = 142, .zone = 0,
+     .edge =
+         {{.index = 284},
+          {.index = 285}}},
+    {.type = NODE_NONE, .num = 0, .index = 143, .zone = 0,
+     .edge =
+         {{.index = 286},
+          {.index = 287}}},
+};
@@ -20,6 +20,23 @@ static int right_child(int i) {
   return (2 * i + 2);
 }
 
+static void swap(struct TrackNodePriorityQueue *queue, unsigned int i, unsigned int j) {
+  struct TrackNodePriorityQueueNode *temp = queue->arr[i];
+
+  queue->arr[i] = queue->arr[j];
+  queue->arr[j] = temp;
+
+  queue->positions[queue->arr[i]->val->index] = i;
+  queue->positions[queue->arr[j]->val->index] = j;
+}
+
+static void sift_up(struct TrackNodePriorityQueue *queue, unsigned int index) {
+  while (index > 0 && queue->arr[parent(index)]->priority > queue->arr[index]->priority) {
+    swap(queue, index, parent(index));
+    index = parent(index);
+  }
+}
+
 static void heapify(struct TrackNodePriorityQueue *queue, unsigned int index) {
   if (queue->size <= 1) {
     return;
@@ -39,17 +56,14 @@ static void heapify(struct TrackNodePriorityQueue *queue, unsigned int index) {
   }
 
   if (smallest != index) {
-    struct TrackNodePriorityQueueNode *temp = queue->arr[index];
-
-    queue->arr[index] = queue->arr[smallest];
-    queue->arr[smallest] = temp;
+    swap(queue, index, smallest);
     heapify(queue, smallest);
   }
 }
 
 void track_node_priority_queue_init(
     struct TrackNodePriorityQueue *queue,
-    struct TrackNode *track_nodes
+    const struct TrackNode *track_nodes
 ) {
   queue->size = 0;
 
@@ -60,59 +74,84 @@ void track_node_priority_queue_init(
     node->priority = 0;
 
     queue->arr[i] = NULL;
+    queue->positions[i] = -1;
   }
 }
 
 void track_node_priority_queue_decrease_priority(
     struct TrackNodePriorityQueue *queue,
-    struct TrackNode *node,
+    const struct TrackNode *node,
     int priority
 ) {
-  int index = 0;
+  int index = queue->positions[node->index];
 
-  for (unsigned int i = 0; i < queue->size; ++i) {
-    if (queue->arr[i]->val == node) {
-      index = i;
-      break;
-    }
+  if (index < 0) {
+    track_node_priority_queue_add(queue, node, priority);
+    return;
   }
 
   queue->arr[index]->priority = priority;
-
-  // sift up
-  int parent_index = parent(index);
-  while (index > 0 && queue->arr[parent_index]->priority > queue->arr[index]->priority) {
-    struct TrackNodePriorityQueueNode *temp = queue->arr[index];
-
-    queue->arr[index] = queue->arr[parent_index];
-    queue->arr[parent_index] = temp;
-
-    index = parent_index;
-    parent_index = parent(index);
-  }
+  sift_up(queue, index);
 }
 
 void track_node_priority_queue_add(
     struct TrackNodePriorityQueue *queue,
-    struct TrackNode *track,
+    const struct TrackNode *track,
     int priority
 ) {
-  unsigned int curr = queue->size;
+  unsigned int curr = queue->size++;
 
   queue->arr[curr] = &queue->nodes[track->index];
   queue->arr[curr]->priority = priority;
+  queue->positions[track->index] = curr;
+
+  sift_up(queue, curr);
+}
+
+void track_node_priority_queue_update(
+    struct TrackNodePriorityQueue *queue,
+    const struct TrackNode *node,
+    int priority
+) {
+  int index = queue->positions[node->index];
+
+  if (index < 0) {
+    track_node_priority_queue_add(queue, node, priority);
+    return;
+  }
+
+  int old_priority = queue->arr[index]->priority;
+  queue->arr[index]->priority = priority;
 
-  while (curr > 0 && queue->arr[parent(curr)]->priority > queue->arr[curr]->priority) {
-    // swap
-    struct TrackNodePriorityQueueNode *temp = queue->arr[parent(curr)];
+  if (priority < old_priority) {
+    sift_up(queue, index);
+  } else {
+    heapify(queue, index);
+  }
+}
+
+void track_node_priority_queue_remove(
+    struct TrackNodePriorityQueue *queue,
+    const struct TrackNode *node
+) {
+  int index = queue->positions[node->index];
 
-    queue->arr[parent(curr)] = queue->arr[curr];
-    queue->arr[curr] = temp;
+  if (index < 0) {
+    return;
+  }
 
-    curr = parent(curr);
+  // the last node takes its place, and goes up or down from there
+  unsigned int last = --queue->size;
+  if ((unsigned int) index != last) {
+    swap(queue, index, last);
   }
+  queue->positions[node->index] = -1;
 
-  ++queue->size;
+  if ((unsigned int) index < queue->size) {
+    const struct TrackNode *moved = queue->arr[index]->val;
+    sift_up(queue, index);
+    heapify(queue, queue->positions[moved->index]);
+  }
 }
 
 struct TrackNodePriorityQueueNode *track_node_priority_queue_poll(struct TrackNodePriorityQueue *queue) {
@@ -121,6 +160,8 @@ struct TrackNodePriorityQueueNode *track_node_priority_queue_poll(struct TrackNo
 
   // set head to last element
   queue->arr[0] = queue->arr[size];
+  queue->positions[queue->arr[0]->val->index] = 0;
+  queue->positions[ret->val->index] = -1;
 
   heapify(queue, 0);
   return ret;
@@ -4,32 +4,48 @@
 
 struct TrackNodePriorityQueueNode {
   int priority;
-  struct TrackNode *val;
+  const struct TrackNode *val;
 };
 
 struct TrackNodePriorityQueue {
   struct TrackNodePriorityQueueNode nodes[TRACK_MAX];
   struct TrackNodePriorityQueueNode *arr[TRACK_MAX];
+  // where each node is in arr, by TrackNode index. -1 if it is not queued.
+  int positions[TRACK_MAX];
   unsigned int size;
 };
 
 void track_node_priority_queue_init(
     struct TrackNodePriorityQueue *queue,
-    struct TrackNode *track_nodes
+    const struct TrackNode *track_nodes
 );
 
 void track_node_priority_queue_add(
     struct TrackNodePriorityQueue *queue,
-    struct TrackNode *track,
+    const struct TrackNode *track,
     int priority
 );
 
+// adds node if it is not queued, so searches only have to add the nodes they reach.
 void track_node_priority_queue_decrease_priority(
     struct TrackNodePriorityQueue *queue,
-    struct TrackNode *node,
+    const struct TrackNode *node,
     int priority
 );
 
+// adds node if it is not queued, or moves it up or down to its new priority.
+void track_node_priority_queue_update(
+    struct TrackNodePriorityQueue *queue,
+    const struct TrackNode *node,
+    int priority
+);
+
+// does nothing if node is not queued.
+void track_node_priority_queue_remove(
+    struct TrackNodePriorityQueue *queue,
+    const struct TrackNode *node
+);
+
 struct TrackNodePriorityQueueNode *track_node_priority_queue_poll(struct TrackNodePriorityQueue *queue);
 struct TrackNodePriorityQueueNode *track_node_priority_queue_head(struct TrackNodePriorityQueue *queue);
 
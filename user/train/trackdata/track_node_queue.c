@@ -2,7 +2,7 @@
 
 #include <stddef.h>
 
-void track_node_queue_init(struct TrackNodeQueue *queue, struct TrackNode *track_nodes) {
+void track_node_queue_init(struct TrackNodeQueue *queue, const struct TrackNode *track_nodes) {
   queue->head = NULL;
   queue->tail = NULL;
   queue->size = 0;
@@ -16,7 +16,7 @@ void track_node_queue_init(struct TrackNodeQueue *queue, struct TrackNode *track
   }
 }
 
-void track_node_queue_add(struct TrackNodeQueue *queue, struct TrackNode *track) {
+void track_node_queue_add(struct TrackNodeQueue *queue, const struct TrackNode *track) {
   struct TrackNodeQueueNode *node = &queue->nodes[track->index];
   node->next = NULL;
 
@@ -32,7 +32,7 @@ void track_node_queue_add(struct TrackNodeQueue *queue, struct TrackNode *track)
   ++queue->size;
 }
 
-struct TrackNode *track_node_queue_pop(struct TrackNodeQueue *queue) {
+const struct TrackNode *track_node_queue_pop(struct TrackNodeQueue *queue) {
   struct TrackNodeQueueNode *popped = queue->tail;
   queue->tail = popped->prev;
   --queue->size;
@@ -44,11 +44,11 @@ struct TrackNode *track_node_queue_pop(struct TrackNodeQueue *queue) {
   return popped->val;
 }
 
-struct TrackNode *track_node_queue_peek_tail(struct TrackNodeQueue *queue) {
+const struct TrackNode *track_node_queue_peek_tail(struct TrackNodeQueue *queue) {
   return queue->tail->val;
 }
 
-struct TrackNode *track_node_queue_poll(struct TrackNodeQueue *queue) {
+const struct TrackNode *track_node_queue_poll(struct TrackNodeQueue *queue) {
   struct TrackNodeQueueNode *popped = queue->head;
 
   queue->head = popped->next;
@@ -61,7 +61,7 @@ struct TrackNode *track_node_queue_poll(struct TrackNodeQueue *queue) {
   return popped->val;
 }
 
-struct TrackNode *track_node_queue_head(struct TrackNodeQueue *queue) {
+const struct TrackNode *track_node_queue_head(struct TrackNodeQueue *queue) {
   return queue->head->val;
 }
 
@@ -3,7 +3,7 @@
 #include "track_data.h"
 
 struct TrackNodeQueueNode {
-  struct TrackNode *val;
+  const struct TrackNode *val;
   struct TrackNodeQueueNode *next;
   struct TrackNodeQueueNode *prev;
 };
@@ -15,13 +15,13 @@ struct TrackNodeQueue {
   unsigned int size;
 };
 
-void track_node_queue_init(struct TrackNodeQueue *queue, struct TrackNode *track_nodes);
+void track_node_queue_init(struct TrackNodeQueue *queue, const struct TrackNode *track_nodes);
 
-void track_node_queue_add(struct TrackNodeQueue *queue, struct TrackNode *track);
+void track_node_queue_add(struct TrackNodeQueue *queue, const struct TrackNode *track);
 
-struct TrackNode *track_node_queue_poll(struct TrackNodeQueue *queue);
-struct TrackNode *track_node_queue_pop(struct TrackNodeQueue *queue);
-struct TrackNode *track_node_queue_head(struct TrackNodeQueue *queue);
-struct TrackNode *track_node_queue_peek_tail(struct TrackNodeQueue *queue);
+const struct TrackNode *track_node_queue_poll(struct TrackNodeQueue *queue);
+const struct TrackNode *track_node_queue_pop(struct TrackNodeQueue *queue);
+const struct TrackNode *track_node_queue_head(struct TrackNodeQueue *queue);
+const struct TrackNode *track_node_queue_peek_tail(struct TrackNodeQueue *queue);
 
 bool track_node_queue_empty(struct TrackNodeQueue *queue);
@@ -54,8 +54,9 @@ struct TrainCalibrationBeginShortMoveRequest {
   int delay;
 };
 
-struct TrainCalibrationUpdateSensorRequest {
-  bool *sensors;
+struct TrainCalibrationSensorEventsRequest {
+  struct SensorEvent *events;
+  int len;
 };
 
 struct TrainCalibrationRequest {
@@ -63,7 +64,7 @@ struct TrainCalibrationRequest {
 
   union {
     struct TrainCalibrationBeginCalibrationRequest begin_req;
-    struct TrainCalibrationUpdateSensorRequest update_sensor_req;
+    struct TrainCalibrationSensorEventsRequest sensor_events_req;
     struct TrainCalibrationBeginShortMoveRequest short_move_req;
     struct TrainCalibrationBeginAccelerationDistanceRequest accd_req;
   };
@@ -73,6 +74,7 @@ static const int CALIBRATION_LOOPS = 10;
 
 void train_calibrator_task() {
   RegisterAs("train_calib");
+  SensorSubscribe(WhoIs("sensor_pub"), TrainCalibratorSensorEvents, MyTid());
 
   int train_tid = WhoIs("train");
   int terminal_tid = WhoIs("terminal");
@@ -131,7 +133,7 @@ void train_calibrator_task() {
           TrainSetSwitchDir(train_tid, loop_switches[i], loop_switch_dirs[i]);
         }
 
-        info = track_distance(track, track[2], track[2]);
+        info = track_distance(2, 2);
         TerminalUpdateDistance(terminal_tid, info.begin, info.end, info.distance);
 
         TrainSetSpeed(train_tid, train, speed);
@@ -152,13 +154,21 @@ void train_calibrator_task() {
         break;
 
       case CALIBRATOR_SENSOR_UPDATE:
-        bool *sensors = req.update_sensor_req.sensors;
+        // poll time of the measured sensor closing, -1 if it did not
+        int trigger_time = -1;
+        for (int i = 0; i < req.sensor_events_req.len; ++i) {
+          struct SensorEvent *event = &req.sensor_events_req.events[i];
+
+          if (event->triggered && event->sensor == sensor) {
+            trigger_time = event->time;
+          }
+        }
 
         // only respond to sensor triggers
         if (calibrating) {
-          if (sensors[sensor]) {
+          if (trigger_time >= 0) {
             if (began_measurement) {
-              t2 = Time(clock_server);
+              t2 = trigger_time;
               int tdelta = t2 - t1;
 
               // first loop ignore
@@ -176,7 +186,7 @@ void train_calibrator_task() {
               // begin measuring next loop
               t1 = t2;
             } else {
-              t1 = Time(clock_server);
+              t1 = trigger_time;
               began_measurement = true;
             }
 
@@ -282,9 +292,9 @@ void TrainCalibratorBeginAccelerationDistance(int tid, int train, int speed) {
   Send(tid, (const char *) &req, sizeof(req), NULL, 0);
 }
 
-void TrainCalibratorUpdateSensors(int tid, bool *sensors) {
+void TrainCalibratorSensorEvents(int tid, struct SensorEvent *events, int len) {
   struct TrainCalibrationRequest req = {
-      .type = CALIBRATOR_SENSOR_UPDATE, .update_sensor_req = {.sensors = sensors}
+      .type = CALIBRATOR_SENSOR_UPDATE, .sensor_events_req = {.events = events, .len = len}
   };
   Send(tid, (const char *) &req, sizeof(req), NULL, 0);
 }
\ No newline at end of file
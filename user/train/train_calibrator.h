@@ -1,4 +1,6 @@
 #include <stdbool.h>
 
+#include "sensor_publisher.h"
+
 void train_calibrator_task();
-void TrainCalibratorUpdateSensors(int tid, bool *sensors);
+void TrainCalibratorSensorEvents(int tid, struct SensorEvent *events, int len);
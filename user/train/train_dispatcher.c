@@ -2,50 +2,281 @@
 
 #include <stdbool.h>
 
-#include "circular_buffer.h"
 #include "irq.h"
 #include "syscall.h"
-#include "uart.h"
+#include "timer.h"
+#include "trainset.h"
+#include "user/server/clock_server.h"
 #include "user/server/io_server.h"
 #include "user/server/name_server.h"
 
-static const int DISPATCHER_PRIORITY = 19;
+const int DISPATCHER_PRIORITY = 19;
 
-struct TrainCommand {
-  const unsigned char *data;
-  int len;
-};
+#define DISPATCH_LANE_MAX 32
+
+// offset to add to speed to turn on function on train (headlights)
+static const int SPEED_OFFSET_FUNCTION = 16;
+static const unsigned char CMD_OFF_LAST_SOLENOID = 0x20;
+static const unsigned char CMD_READ_ALL_SENSORS = 0x80 + 5;
+static const unsigned char CMD_READ_SENSOR_MODULE = 0xC0;
+static const unsigned char CMD_SENSOR_RESET_MODE = 0xC0;
 
-enum MarklinState { MARKLIN_READY, MARKLIN_BUSY };
+enum TrainDispatchRequestType {
+  DISPATCH_COMMAND,
+  DISPATCH_GET_STATS,
+  // courier is done with the last command and waiting for the next one
+  DISPATCH_COURIER_READY,
+  // timer courier is waiting for the next solenoid deadline
+  DISPATCH_SOLENOID_TIMER
+};
 
-enum TrainDispatchRequestType { CTS_ON_NOTIFY, TRAIN_DISPATCH };
+struct MarklinCommand {
+  enum MarklinCommandType type;
+  uint8_t target;
+  uint8_t value;
+};
 
 struct TrainDispatchRequest {
   enum TrainDispatchRequestType type;
-  struct TrainCommand cmd;
+
+  union {
+    struct MarklinCommand cmd;
+    struct DispatchStats *stats;
+  };
+};
+
+struct TrainDispatchCourierResponse {
+  unsigned char data[2];
+  int len;
+};
+
+struct DispatchEntry {
+  struct MarklinCommand cmd;
+  // in microseconds
+  uint64_t queued_at;
 };
 
-void train_dispatcher_cts_on_notifier() {
+struct DispatchQueue {
+  struct DispatchEntry entries[DISPATCH_LANE_MAX];
+  int len;
+};
+
+struct Dispatcher {
+  struct DispatchQueue lanes[DISPATCH_LANES];
+  struct DispatchStats stats;
+
+  // a switch has been thrown and the solenoid has not been switched off yet
+  bool solenoid_on;
+  // in ticks
+  int solenoid_deadline;
+};
+
+void train_dispatcher_courier() {
+  int dispatcher = MyParentTid();
+  int marklin_tx = WhoIs("marklin_io_tx");
+
+  struct TrainDispatchRequest req = {.type = DISPATCH_COURIER_READY};
+  struct TrainDispatchCourierResponse res;
+  while (true) {
+    Send(dispatcher, (const char *) &req, sizeof(req), (char *) &res, sizeof(res));
+    // only one command is in flight so a stop never waits behind more than one other command
+    PutlSync(marklin_tx, res.data, res.len);
+  }
+}
+
+void train_dispatcher_solenoid_courier() {
   int dispatcher = MyParentTid();
+  int clock_server = WhoIs("clock_server");
 
-  struct TrainDispatchRequest req = {.type = CTS_ON_NOTIFY};
+  struct TrainDispatchRequest req = {.type = DISPATCH_SOLENOID_TIMER};
+  int deadline;
   while (true) {
-    AwaitEvent(EVENT_UART_MARKLIN_CTS);
-    Send(dispatcher, (const char *) &req, sizeof(req), NULL, 0);
+    Send(dispatcher, (const char *) &req, sizeof(req), (char *) &deadline, sizeof(deadline));
+    DelayUntil(clock_server, deadline);
+  }
+}
+
+static enum DispatchLaneType dispatch_lane(struct MarklinCommand *cmd) {
+  switch (cmd->type) {
+    case MARKLIN_CMD_SPEED:
+      return cmd->value == 0 ? DISPATCH_LANE_STOP : DISPATCH_LANE_SPEED;
+    case MARKLIN_CMD_REVERSE:
+      return DISPATCH_LANE_SPEED;
+    case MARKLIN_CMD_SENSOR_READ:
+    case MARKLIN_CMD_SENSOR_READ_MODULE:
+    case MARKLIN_CMD_SENSOR_RESET:
+      return DISPATCH_LANE_SENSOR;
+    default:
+      return DISPATCH_LANE_SWITCH;
   }
 }
 
+// returns the index of the last queued command for the target, -1 if there is none
+static int dispatch_queue_find(
+    struct DispatchQueue *queue,
+    enum MarklinCommandType type,
+    int target
+) {
+  for (int i = queue->len - 1; i >= 0; --i) {
+    struct MarklinCommand *cmd = &queue->entries[i].cmd;
+
+    if (cmd->type == type && (target < 0 || cmd->target == target)) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+static void dispatch_queue_remove(struct DispatchQueue *queue, int index) {
+  for (int i = index + 1; i < queue->len; ++i) {
+    queue->entries[i - 1] = queue->entries[i];
+  }
+
+  --queue->len;
+}
+
+static int dispatch_enqueue(struct Dispatcher *dispatcher, struct MarklinCommand *cmd) {
+  enum DispatchLaneType lane = dispatch_lane(cmd);
+  struct DispatchQueue *queue = &dispatcher->lanes[lane];
+  int index = -1;
+
+  switch (cmd->type) {
+    case MARKLIN_CMD_SPEED:
+      if (lane == DISPATCH_LANE_STOP) {
+        // speed changes queued before the stop would otherwise go out after it
+        struct DispatchQueue *speed_queue = &dispatcher->lanes[DISPATCH_LANE_SPEED];
+        int speed_index = dispatch_queue_find(speed_queue, MARKLIN_CMD_SPEED, cmd->target);
+        while (speed_index >= 0) {
+          dispatch_queue_remove(speed_queue, speed_index);
+          ++dispatcher->stats.coalesced[DISPATCH_LANE_SPEED];
+          speed_index = dispatch_queue_find(speed_queue, MARKLIN_CMD_SPEED, cmd->target);
+        }
+
+        index = dispatch_queue_find(queue, MARKLIN_CMD_SPEED, cmd->target);
+      } else {
+        // a reverse in between has to keep the speed changes on either side of it
+        index = dispatch_queue_find(queue, MARKLIN_CMD_SPEED, cmd->target);
+        int reverse_index = dispatch_queue_find(queue, MARKLIN_CMD_REVERSE, cmd->target);
+
+        if (reverse_index > index) {
+          index = -1;
+        }
+      }
+      break;
+    case MARKLIN_CMD_SWITCH:
+      index = dispatch_queue_find(queue, MARKLIN_CMD_SWITCH, cmd->target);
+      break;
+    case MARKLIN_CMD_SENSOR_READ:
+      // there is only ever one sensor dump worth reading
+      index = dispatch_queue_find(queue, MARKLIN_CMD_SENSOR_READ, -1);
+      break;
+    default:
+      break;
+  }
+
+  if (index >= 0) {
+    // superseded, the command keeps its place and its queue time
+    queue->entries[index].cmd.value = cmd->value;
+    ++dispatcher->stats.coalesced[lane];
+    return 0;
+  }
+
+  if (queue->len == DISPATCH_LANE_MAX) {
+    return -1;
+  }
+
+  struct DispatchEntry *entry = &queue->entries[queue->len++];
+  entry->cmd = *cmd;
+  entry->queued_at = timer_get_time();
+  return 0;
+}
+
+static int marklin_encode(struct MarklinCommand *cmd, unsigned char *data) {
+  switch (cmd->type) {
+    case MARKLIN_CMD_SPEED:
+      // add 16 to speed for auxiliary function
+      data[0] = cmd->value + SPEED_OFFSET_FUNCTION;
+      data[1] = cmd->target;
+      return 2;
+    case MARKLIN_CMD_REVERSE:
+      data[0] = SPEED_REVERSE_DIRECTION + SPEED_OFFSET_FUNCTION;
+      data[1] = cmd->target;
+      return 2;
+    case MARKLIN_CMD_SWITCH:
+      data[0] = cmd->value;
+      data[1] = cmd->target;
+      return 2;
+    case MARKLIN_CMD_SOLENOID_OFF:
+      data[0] = CMD_OFF_LAST_SOLENOID;
+      return 1;
+    case MARKLIN_CMD_SENSOR_READ:
+      data[0] = CMD_READ_ALL_SENSORS;
+      return 1;
+    case MARKLIN_CMD_SENSOR_READ_MODULE:
+      data[0] = CMD_READ_SENSOR_MODULE + cmd->target;
+      return 1;
+    case MARKLIN_CMD_SENSOR_RESET:
+      data[0] = CMD_SENSOR_RESET_MODE;
+      return 1;
+  }
+
+  return 0;
+}
+
+// picks the next command to send, returns the lane it came from or -1 if nothing can go out yet
+static int dispatch_next(
+    struct Dispatcher *dispatcher,
+    int clock_server,
+    struct DispatchEntry *out
+) {
+  if (dispatcher->lanes[DISPATCH_LANE_STOP].len > 0) {
+    *out = dispatcher->lanes[DISPATCH_LANE_STOP].entries[0];
+    dispatch_queue_remove(&dispatcher->lanes[DISPATCH_LANE_STOP], 0);
+    return DISPATCH_LANE_STOP;
+  }
+
+  // the solenoid is switched off once, after the last switch of a burst has had time to throw
+  if (dispatcher->solenoid_on && dispatcher->lanes[DISPATCH_LANE_SWITCH].len == 0 &&
+      Time(clock_server) >= dispatcher->solenoid_deadline) {
+    dispatcher->solenoid_on = false;
+    out->cmd.type = MARKLIN_CMD_SOLENOID_OFF;
+    out->queued_at = timer_get_time();
+    return DISPATCH_LANE_SWITCH;
+  }
+
+  for (int lane = DISPATCH_LANE_SPEED; lane < DISPATCH_LANES; ++lane) {
+    struct DispatchQueue *queue = &dispatcher->lanes[lane];
+
+    if (queue->len > 0) {
+      *out = queue->entries[0];
+      dispatch_queue_remove(queue, 0);
+      return lane;
+    }
+  }
+
+  return -1;
+}
+
 void train_dispatcher_task() {
   RegisterAs("train_dispatch");
 
-  int marklin_tx = WhoIs("marklin_io_tx");
+  int clock_server = WhoIs("clock_server");
 
-  Create(DISPATCHER_PRIORITY + 1, train_dispatcher_cts_on_notifier);
+  struct Dispatcher dispatcher = {0};
 
-  enum MarklinState marklin_state = MARKLIN_READY;
+  Create(NOTIFIER_PRIORITY, train_dispatcher_courier);
+  // courier waiting for a command, -1 while it is sending one
+  int courier_tid = -1;
+  // lane of the command the courier is sending and when it was queued
+  int in_flight_lane = -1;
+  uint64_t in_flight_queued_at = 0;
 
-  struct CircularBuffer cmd_buffer;
-  circular_buffer_init(&cmd_buffer);
+  Create(NOTIFIER_PRIORITY, train_dispatcher_solenoid_courier);
+  // timer courier waiting for a deadline, -1 if it is asleep
+  int timer_tid = -1;
+  // deadline the timer courier was last sent to sleep until
+  int timer_deadline = -1;
 
   int tid;
   struct TrainDispatchRequest req;
@@ -53,32 +284,86 @@ void train_dispatcher_task() {
     Receive(&tid, (char *) &req, sizeof(req));
 
     switch (req.type) {
-      case CTS_ON_NOTIFY:
-        Reply(tid, NULL, 0);
-        if (marklin_state == MARKLIN_BUSY) {
-          marklin_state = MARKLIN_READY;
+      case DISPATCH_COMMAND: {
+        int ret = 0;
+
+        if (req.cmd.type == MARKLIN_CMD_SOLENOID_OFF) {
+          // switched off as soon as the queued switches are out
+          dispatcher.solenoid_deadline = 0;
+        } else {
+          ret = dispatch_enqueue(&dispatcher, &req.cmd);
         }
 
+        Reply(tid, (const char *) &ret, sizeof(ret));
         break;
-      case TRAIN_DISPATCH:
-        circular_buffer_write_n(&cmd_buffer, (const unsigned char *) &req.cmd, sizeof(req.cmd));
+      }
+      case DISPATCH_GET_STATS:
+        *req.stats = dispatcher.stats;
         Reply(tid, NULL, 0);
+        break;
+      case DISPATCH_COURIER_READY:
+        courier_tid = tid;
+
+        if (in_flight_lane >= 0) {
+          unsigned int latency = timer_get_time() - in_flight_queued_at;
+          dispatcher.stats.latency_last[in_flight_lane] = latency;
+
+          if (latency > dispatcher.stats.latency_max[in_flight_lane]) {
+            dispatcher.stats.latency_max[in_flight_lane] = latency;
+          }
+
+          in_flight_lane = -1;
+        }
+        break;
+      case DISPATCH_SOLENOID_TIMER:
+        timer_tid = tid;
+        break;
+    }
+
+    struct DispatchEntry entry;
+    if (courier_tid >= 0) {
+      in_flight_lane = dispatch_next(&dispatcher, clock_server, &entry);
     }
 
-    // dispatch next command
-    if (marklin_state == MARKLIN_READY && !circular_buffer_empty(&cmd_buffer)) {
-      struct TrainCommand cmd;
-      circular_buffer_read_n(&cmd_buffer, (unsigned char *) &cmd, sizeof(cmd));
+    if (courier_tid >= 0 && in_flight_lane >= 0) {
+      struct TrainDispatchCourierResponse res;
+      res.len = marklin_encode(&entry.cmd, res.data);
+      in_flight_queued_at = entry.queued_at;
+
+      if (entry.cmd.type == MARKLIN_CMD_SWITCH) {
+        dispatcher.solenoid_on = true;
+        dispatcher.solenoid_deadline = Time(clock_server) + DELAY_OFF_LAST_SOLENOID;
+      }
+
+      Reply(courier_tid, (const char *) &res, sizeof(res));
+      courier_tid = -1;
+    }
 
-      Putl(marklin_tx, cmd.data, cmd.len);
-      marklin_state = MARKLIN_BUSY;
+    // wake up at the solenoid deadline in case nothing else comes in before then. a deadline
+    // that has already been slept through is left to the next courier ready.
+    if (timer_tid >= 0 && dispatcher.solenoid_on &&
+        dispatcher.solenoid_deadline != timer_deadline) {
+      timer_deadline = dispatcher.solenoid_deadline;
+      Reply(timer_tid, (const char *) &timer_deadline, sizeof(timer_deadline));
+      timer_tid = -1;
     }
   }
 }
 
-int DispatchTrainCommand(int tid, const unsigned char *cmd, unsigned int len) {
-  // struct TrainDispatchRequest req = {.type = TRAIN_DISPATCH, .cmd = {.data = cmd, .len = len}};
-  // return Send(tid, (const char *) &req, sizeof(req), NULL, 0);
+int DispatchTrainCommand(int tid, enum MarklinCommandType type, uint8_t target, uint8_t value) {
+  struct TrainDispatchRequest req = {
+      .type = DISPATCH_COMMAND, .cmd = {.type = type, .target = target, .value = value}
+  };
+
+  int ret;
+  if (Send(tid, (const char *) &req, sizeof(req), (char *) &ret, sizeof(ret)) < 0) {
+    return -2;
+  }
+
+  return ret;
+}
 
-  return Putl(tid, cmd, len);
+int DispatchGetStats(int tid, struct DispatchStats *stats) {
+  struct TrainDispatchRequest req = {.type = DISPATCH_GET_STATS, .stats = stats};
+  return Send(tid, (const char *) &req, sizeof(req), NULL, 0) < 0 ? -1 : 0;
 }
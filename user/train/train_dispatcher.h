@@ -1,4 +1,60 @@
 #pragma once
 
+#include <stdint.h>
+
+enum MarklinCommandType {
+  // target is the train, value the speed (0 to 14)
+  MARKLIN_CMD_SPEED,
+  MARKLIN_CMD_REVERSE,
+  // target is the switch number, value the direction
+  MARKLIN_CMD_SWITCH,
+  MARKLIN_CMD_SOLENOID_OFF,
+  MARKLIN_CMD_SENSOR_READ,
+  // target is the feedback module, 1 to 5
+  MARKLIN_CMD_SENSOR_READ_MODULE,
+  MARKLIN_CMD_SENSOR_RESET
+};
+
+// lanes are served in order, a command only goes out once the lanes above it are empty
+enum DispatchLaneType {
+  DISPATCH_LANE_STOP,
+  DISPATCH_LANE_SPEED,
+  DISPATCH_LANE_SENSOR,
+  DISPATCH_LANE_SWITCH,
+  DISPATCH_LANES
+};
+
+struct DispatchStats {
+  // commands merged into one that was still queued
+  unsigned int coalesced[DISPATCH_LANES];
+  // time from being queued to being handed to the uart in microseconds
+  unsigned int latency_last[DISPATCH_LANES];
+  unsigned int latency_max[DISPATCH_LANES];
+};
+
+extern const int DISPATCHER_PRIORITY;
+
 void train_dispatcher_task();
-int DispatchTrainCommand(int tid, const unsigned char *cmd, unsigned int len);
+
+/**
+ * tid is the train dispatcher. queues a command for the marklin. commands are sent one at a time
+ * in priority lanes: stops, then speed changes and reverses, then sensor commands, then switches.
+ * a speed or switch command replaces one for the same train or switch that has not been sent yet,
+ * and a stop drops the queued speed changes of its train. the solenoid is switched off once no
+ * switch has been thrown for DELAY_OFF_LAST_SOLENOID ticks.
+ *
+ * Return Value
+ * 0	success.
+ * -1	the lane is full, the command was dropped.
+ * -2	tid is not a valid train dispatcher.
+ */
+int DispatchTrainCommand(int tid, enum MarklinCommandType type, uint8_t target, uint8_t value);
+
+/**
+ * tid is the train dispatcher. copies the lane statistics into stats.
+ *
+ * Return Value
+ * 0	success.
+ * -1	tid is not a valid train dispatcher.
+ */
+int DispatchGetStats(int tid, struct DispatchStats *stats);
@@ -4,6 +4,7 @@
 
 #include "irq.h"
 #include "selected_track.h"
+#include "sensor_publisher.h"
 #include "syscall.h"
 #include "task.h"
 #include "track_position.h"
@@ -79,14 +80,18 @@ enum PathFindState {
 
 // ticks to wait after a short move.
 static int SHORT_MOVE_DELAY = 400;
+#if CONFIG_SCHEDULED_ROUTES
+// destinations a locked train tries when it plans again
+static const int REPLAN_ATTEMPTS = 4;
+#endif
 
 struct Train {
   bool active;
 
   enum PathFindState pf_state;
-  struct TrackNode *selected_dest;
+  const struct TrackNode *selected_dest;
 
-  struct TrackNode *initial_pos;
+  const struct TrackNode *initial_pos;
 
   int train;
   int train_index;
@@ -114,7 +119,7 @@ struct Train {
 
   int speed;
 
-  struct TrackNode *next_sensor;
+  const struct TrackNode *next_sensor;
   int next_sensor_eta;
   int sensor_eta_error;
 
@@ -125,6 +130,10 @@ struct Train {
   FixedPointInt acceleration;
   FixedPointInt velocity;
   int lock_begin_time;
+  // when the train started waiting for a reservation, -1 if it is not
+  int wait_begin_time;
+  // the current wait has been counted as a deadlock
+  bool wait_deadlocked;
   char train_color;
 };
 
@@ -157,7 +166,7 @@ static int get_distance_between_debug(
 
   // find distance from pos1 to pos2
   for (int i = pos1_index; i < path->nodes_len; ++i) {
-    struct TrackNode *node = path->nodes[i];
+    const struct TrackNode *node = path->nodes[i];
     int edge_dir = path->directions[i];
 
     if (node == dest->node || (!strict && node == dest->node->reverse)) {
@@ -209,7 +218,7 @@ static int get_distance_between(
 
   // find distance from pos1 to pos2
   for (int i = pos1_index; i < path->nodes_len; ++i) {
-    struct TrackNode *node = path->nodes[i];
+    const struct TrackNode *node = path->nodes[i];
     int edge_dir = path->directions[i];
 
     if (node == dest->node || (!strict && node == dest->node->reverse)) {
@@ -351,6 +360,8 @@ void train_init(struct Train *train, int train_num) {
   train->terminal_update_time = -100;
 
   train->lock_begin_time = 0;
+  train->wait_begin_time = -1;
+  train->wait_deadlocked = false;
 }
 
 static inline int get_constant_velocity_travel_time(struct Train *train, int dist) {
@@ -370,14 +381,17 @@ static int get_constant_velocity_travel_time_between(
 }
 
 enum TrainManagerRequestType {
-  TRAIN_MANAGER_UPDATE_SENSORS,
+  TRAIN_MANAGER_SENSOR_EVENTS,
   TRAIN_MANAGER_TICK,
   TRAIN_MANAGER_ROUTE_RETURN,
-  TRAIN_MANAGER_RAND_ROUTE
+  TRAIN_MANAGER_RAND_ROUTE,
+  TRAIN_MANAGER_GET_WATCHED_MODULES,
+  TRAIN_MANAGER_GET_STATS
 };
 
-struct TrainManagerUpdateSensorsRequest {
-  bool *sensors;
+struct TrainManagerSensorEventsRequest {
+  struct SensorEvent *events;
+  int len;
 };
 
 struct TrainManagerRouteReturnRequest {
@@ -396,7 +410,7 @@ struct TrainManagerRequest {
   enum TrainManagerRequestType type;
 
   union {
-    struct TrainManagerUpdateSensorsRequest update_sens_req;
+    struct TrainManagerSensorEventsRequest sensor_events_req;
     struct TrainManagerRouteReturnRequest route_return_req;
     struct TrainManagerRandRouteRequest rand_route_req;
   };
@@ -566,7 +580,7 @@ void update_train_pos(int time, struct Train *train) {
 
   struct SimplePath current_path = train->plan.paths[train->path_index];
   // destination node of simple path
-  struct TrackNode *current_path_dest = current_path.dest.node;
+  const struct TrackNode *current_path_dest = current_path.dest.node;
   int current_path_dest_dir = current_path.dest_dir;
   struct TrackPosition current_path_dest_pos = {
       .node = current_path.dest.node, .offset = current_path.dest.offset
@@ -723,7 +737,7 @@ void update_train_pos(int time, struct Train *train) {
 
 static int get_next_sensor_index(struct Train *train) {
   for (int i = train->last_sensor_index + 1; i < train->plan.path.nodes_len; ++i) {
-    struct TrackNode *node = train->plan.path.nodes[i];
+    const struct TrackNode *node = train->plan.path.nodes[i];
 
     if (node->type == NODE_SENSOR) {
       // if we're not on the last path..
@@ -750,7 +764,7 @@ static int get_next_sensor_index(struct Train *train) {
 
 static int get_next_switch_index(struct Train *train) {
   for (int i = train->last_switch_index + 1; i < train->plan.path.nodes_len; ++i) {
-    struct TrackNode *node = train->plan.path.nodes[i];
+    const struct TrackNode *node = train->plan.path.nodes[i];
 
     if (node->type == NODE_BRANCH) {
       return i;
@@ -763,6 +777,34 @@ static int get_next_switch_index(struct Train *train) {
   return -1;
 }
 
+// the nodes of the current simple path before the one the train is at are behind it. a train that
+// turned around short of where its path reverses never passed their sensors and switches, they
+// are skipped so it does not wait on them or reserve their zones.
+static void train_skip_passed_nodes(struct Train *train) {
+  struct SimplePath *current_path = &train->plan.paths[train->path_index];
+  int pos_index = -1;
+
+  for (int i = current_path->start_index; i <= current_path->end_index; ++i) {
+    if (train->plan.path.nodes[i] == train->est_pos.position.node) {
+      pos_index = i;
+      break;
+    }
+  }
+
+  for (int i = current_path->start_index; i < pos_index; ++i) {
+    switch (train->plan.path.nodes[i]->type) {
+      case NODE_SENSOR:
+        train->last_sensor_index = max(train->last_sensor_index, i);
+        break;
+      case NODE_BRANCH:
+        train->last_switch_index = max(train->last_switch_index, i);
+        break;
+      default:
+        break;
+    }
+  }
+}
+
 static void train_update_next_sensor(struct Train *train, int current_time) {
   int terminal = WhoIs("terminal");
 
@@ -814,53 +856,20 @@ static void train_update_next_sensor(struct Train *train, int current_time) {
   }
 }
 
-void reroute_train(int terminal, int train_planner, struct Train *train, int time) {
-  if (train->pf_state == RAND_ROUTE) {
-    struct TrackPosition rand_dest = track_position_random(terminal);
-    train->plan = CreatePlan(train_planner, &train->est_pos, &rand_dest);
-
-    while (!train->plan.path_found) {
-      TerminalLogPrint(
-          terminal,
-          "No path to %s from %s, trying to find another destination.",
-          rand_dest.node->name,
-          train->est_pos.position.node->name
-      );
-      rand_dest = track_position_random(terminal);
-      train->plan = CreatePlan(train_planner, &train->est_pos, &rand_dest);
-    }
-  } else if (train->pf_state == ROUTE_TO_SELECTED_DEST) {
-    struct TrackPosition dest = {.node = train->selected_dest, .offset = 0};
-    train->plan = CreatePlan(train_planner, &train->est_pos, &dest);
-
-    if (!train->plan.path_found) {
-      TerminalLogPrint(
-          terminal,
-          "Failed to find path to %s from %s!",
-          dest.node->name,
-          train->est_pos.position.node->name
-      );
-    }
-
-    // next path find, the train will return home.
-    train->pf_state = RETURN_HOME;
-  } else {
-    // pf_state == RETURN_HOME
-    struct TrackPosition dest = {.node = train->initial_pos, .offset = 0};
-    train->plan = CreatePlan(train_planner, &train->est_pos, &dest);
-
-    if (!train->plan.path_found) {
-      TerminalLogPrint(
-          terminal,
-          "Failed to find path to %s from %s!",
-          dest.node->name,
-          train->est_pos.position.node->name
-      );
-    }
-
-    train->pf_state = NONE;
-  }
+static struct RoutePlan
+train_create_plan(int train_planner, struct Train *train, struct TrackPosition *dest, int time) {
+#if CONFIG_SCHEDULED_ROUTES
+  return CreateScheduledPlan(
+      train_planner, train->train_index, train->speed, time, &train->est_pos, dest
+  );
+#else
+  (void) time;
+  return CreatePlan(train_planner, &train->est_pos, dest);
+#endif
+}
 
+// logs the train's new plan and sets it off from the start of it
+static void train_begin_plan(int terminal, struct Train *train, int time) {
   TerminalLogPrint(
       terminal,
       "\033[35mPath from %s to %s",
@@ -924,16 +933,262 @@ void reroute_train(int terminal, int train_planner, struct Train *train, int tim
   TerminalLogPrint(terminal, "Routing train %d to %s.", train->train, train->plan.dest.node->name);
 }
 
+// a random destination for the train, anywhere but where it is standing
+static struct TrackPosition train_random_dest(struct Train *train) {
+  const struct TrackNode *node = train->est_pos.position.node;
+  struct TrackPosition dest = track_position_random();
+
+  while (dest.node == node || dest.node == node->reverse) {
+    dest = track_position_random();
+  }
+
+  return dest;
+}
+
+void reroute_train(int terminal, int train_planner, struct Train *train, int time) {
+  if (train->pf_state == RAND_ROUTE) {
+    struct TrackPosition rand_dest = train_random_dest(train);
+    train->plan = train_create_plan(train_planner, train, &rand_dest, time);
+
+    while (!train->plan.path_found) {
+      TerminalLogPrint(
+          terminal,
+          "No path to %s from %s, trying to find another destination.",
+          rand_dest.node->name,
+          train->est_pos.position.node->name
+      );
+      rand_dest = train_random_dest(train);
+      train->plan = train_create_plan(train_planner, train, &rand_dest, time);
+    }
+  } else if (train->pf_state == ROUTE_TO_SELECTED_DEST) {
+    struct TrackPosition dest = {.node = train->selected_dest, .offset = 0};
+    train->plan = train_create_plan(train_planner, train, &dest, time);
+
+    if (!train->plan.path_found) {
+      TerminalLogPrint(
+          terminal,
+          "Failed to find path to %s from %s!",
+          dest.node->name,
+          train->est_pos.position.node->name
+      );
+    }
+
+    // next path find, the train will return home.
+    train->pf_state = RETURN_HOME;
+  } else {
+    // pf_state == RETURN_HOME
+    struct TrackPosition dest = {.node = train->initial_pos, .offset = 0};
+    train->plan = train_create_plan(train_planner, train, &dest, time);
+
+    if (!train->plan.path_found) {
+      TerminalLogPrint(
+          terminal,
+          "Failed to find path to %s from %s!",
+          dest.node->name,
+          train->est_pos.position.node->name
+      );
+    }
+
+    train->pf_state = NONE;
+  }
+
+  train_begin_plan(terminal, train, time);
+}
+
+#if CONFIG_SCHEDULED_ROUTES
+// plans again from where the train is stopped, to the same destination. randomly routed trains
+// can go anywhere, they try other destinations until one has room in the schedule. the old plan
+// is kept if there is no new one.
+static void replan_train(int terminal, int train_planner, struct Train *train, int time) {
+  struct TrackPosition dest = train->plan.dest;
+
+  for (int i = 0; i < REPLAN_ATTEMPTS; ++i) {
+    struct RoutePlan plan = train_create_plan(train_planner, train, &dest, time);
+
+    if (plan.path_found && (plan.depart_time != 0 || train->pf_state != RAND_ROUTE)) {
+      train->plan = plan;
+      train_begin_plan(terminal, train, time);
+      return;
+    }
+
+    if (train->pf_state != RAND_ROUTE) {
+      break;
+    }
+
+    dest = train_random_dest(train);
+  }
+
+  TerminalLogPrint(terminal, "No new path for train %d to %s", train->train, dest.node->name);
+}
+#endif
+
+// plans a way around the zones that kept the train waiting, to the same destination. false if
+// there is none.
+static bool reroute_locked_train(int terminal, int train_planner, struct Train *train, int time) {
+#if CONFIG_SCHEDULED_ROUTES
+  int speed = train->speed;
+#else
+  // nothing to book
+  int speed = 0;
+#endif
+  struct RoutePlan plan = CreateRepairedPlan(
+      train_planner, train->train_index, speed, time, &train->est_pos, &train->plan.dest
+  );
+
+  if (!plan.path_found) {
+    return false;
+  }
+
+  train->plan = plan;
+  train_begin_plan(terminal, train, time);
+  return true;
+}
+
 static const int FLIP_SWITCH_DIST = 300;
 static const int DEADLOCK_DURATION = 3000;
 static const int WAIT_DURATION = 300;
 
+static void train_lock(struct Train *train, int time, struct TrainManagerStats *stats) {
+  train->state = LOCKED;
+  train->lock_begin_time = time;
+
+  // retries that fail again are part of the same wait
+  if (train->wait_begin_time < 0) {
+    train->wait_begin_time = time;
+    train->wait_deadlocked = false;
+    ++stats->waits;
+  }
+}
+
+// counts a wait once when it has gone on for DEADLOCK_DURATION, however it is recovered from
+static void train_check_deadlock(struct Train *train, int time, struct TrainManagerStats *stats) {
+  if (train->wait_begin_time >= 0 && !train->wait_deadlocked &&
+      time - train->wait_begin_time >= DEADLOCK_DURATION) {
+    train->wait_deadlocked = true;
+    ++stats->deadlocks;
+  }
+}
+
+static void train_end_wait(struct Train *train, int time, struct TrainManagerStats *stats) {
+  if (train->wait_begin_time >= 0) {
+    stats->wait_ticks += time - train->wait_begin_time;
+    train->wait_begin_time = -1;
+  }
+}
+
+// distance from the start of path to pos, -1 if pos is not on it
+static int path_distance_to(struct Path *path, struct TrackPosition *pos) {
+  int dist = 0;
+
+  for (int i = 0; i < path->nodes_len; ++i) {
+    const struct TrackNode *node = path->nodes[i];
+    if (node == pos->node) {
+      return dist + pos->offset;
+    }
+
+    if (path->directions[i] != DIR_REVERSE) {
+      dist += node->edge[path->directions[i]].dist;
+    }
+  }
+
+  return -1;
+}
+
+static bool path_has_node(struct Path *path, const struct TrackNode *node) {
+  for (int i = 0; i < path->nodes_len; ++i) {
+    if (path->nodes[i] == node) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static void record_position_error(
+    struct TrainManagerStats *stats,
+    struct Path *path,
+    struct TrackPosition *estimate,
+    struct TrackPosition *actual
+) {
+  int estimate_dist = path_distance_to(path, estimate);
+  int actual_dist = path_distance_to(path, actual);
+
+  if (estimate_dist < 0 || actual_dist < 0) {
+    return;
+  }
+
+  int error = estimate_dist > actual_dist ? estimate_dist - actual_dist
+                                          : actual_dist - estimate_dist;
+  ++stats->position_errors;
+  stats->position_error_total += error;
+  stats->position_error_max = max(stats->position_error_max, error);
+}
+
+// enter and exit nodes are not in any zone, their zone is left at 0
+static bool node_has_zone(const struct TrackNode *node) {
+  return node->type == NODE_SENSOR || node->type == NODE_BRANCH || node->type == NODE_MERGE;
+}
+
+// releases the zones the train holds along its path
+static void train_release_path(int terminal, struct Train *train) {
+  for (int i = 0; i < train->plan.path.nodes_len; ++i) {
+    const struct TrackNode *node = train->plan.path.nodes[i];
+
+    if (!node_has_zone(node)) {
+      continue;
+    }
+
+    int zone = node->zone;
+
+    if (ZoneOccupied(zone) == train->train_index) {
+      ReleaseReservations(terminal, zone);
+    }
+  }
+}
+
+// the estimate left the plan, the train turned around somewhere other than where it was thought
+// to be. it stops and plans again from the estimate, to the same destination when there is a way.
+static void train_replan_off_path(
+    int terminal,
+    int train_tid,
+    int train_planner,
+    struct Train *train,
+    int time
+) {
+  TerminalLogPrint(
+      terminal,
+      "Train %d is off its path at %s, planning again",
+      train->train,
+      train->est_pos.position.node->name
+  );
+
+  TrainSetSpeed(train_tid, train->train, 0);
+  train->velocity = 0;
+  train->acceleration = 0;
+
+  train_release_path(terminal, train);
+  if (node_has_zone(train->est_pos.position.node)) {
+    ReserveTrack(terminal, train->est_pos.position.node->zone, train->train_index);
+  }
+
+  struct TrackPosition dest = train->plan.dest;
+  train->plan = train_create_plan(train_planner, train, &dest, time);
+
+  if (!train->plan.path_found && train->pf_state == RAND_ROUTE) {
+    reroute_train(terminal, train_planner, train, time);
+    return;
+  }
+
+  train_begin_plan(terminal, train, time);
+}
+
 static void handle_tick(
     int terminal,
     int train_tid,
     int train_planner,
     int clock_server,
-    struct Train *train_states
+    struct Train *train_states,
+    struct TrainManagerStats *stats
 ) {
   for (int i = 0; i < TRAINSET_NUM_TRAINS; ++i) {
     struct Train *train = &train_states[i];
@@ -950,6 +1205,11 @@ static void handle_tick(
 
     struct Path *path = &train->plan.path;
 
+    if (train->plan.path_found && !path_has_node(path, train->est_pos.position.node)) {
+      train_replan_off_path(terminal, train_tid, train_planner, train, time);
+      continue;
+    }
+
     // TODO:
     // - make sure we are within reservation range ^
 
@@ -960,7 +1220,7 @@ static void handle_tick(
     // // we check if next switch is equal to last switch in case we already activated
     // // the switch previously.
     if (next_switch_index != -1 && next_switch_index != train->last_switch_index) {
-      struct TrackNode *next_switch = path->nodes[next_switch_index];
+      const struct TrackNode *next_switch = path->nodes[next_switch_index];
       struct TrackPosition next_switch_pos = {.node = next_switch, .offset = 0};
 
       // TerminalLogPrint(
@@ -1006,7 +1266,7 @@ static void handle_tick(
 
     struct SimplePath current_path = train->plan.paths[train->path_index];
     // destination node of simple path
-    struct TrackNode *current_path_dest = current_path.dest.node;
+    const struct TrackNode *current_path_dest = current_path.dest.node;
     // TerminalLogPrint(terminal, "current path dest");
     int current_path_dest_dir = current_path.dest_dir;
     // TerminalLogPrint(terminal, "current path dest dir");
@@ -1085,6 +1345,11 @@ static void handle_tick(
         }
         break;
       case PATH_BEGIN:
+        // a scheduled plan can have the train wait for other trains to pass first
+        if (time < train->plan.depart_time) {
+          break;
+        }
+
         // check if move is a reverse
         if (current_path.reverse) {
           TrainReverseInstant(train_tid, train->train);
@@ -1094,7 +1359,7 @@ static void handle_tick(
           // TODO: when reversing our train pos, we always make the offset positive. as a result,
           // it's possible that the resulting node is not within our path. this makes all our
           // distance calculations return -1 since it cannot find the source node.
-          // train->est_pos = train_position_reverse_node(train->est_pos, train_tid);
+          // train->est_pos = train_position_reverse_node(train->est_pos);
           // train->est_pos = train_position_add(train->est_pos, &train->plan.path, TRAIN_LEN);
 
           TerminalLogPrint(
@@ -1120,6 +1385,8 @@ static void handle_tick(
           break;
         }
 
+        train_skip_passed_nodes(train);
+
         // short move (possibly add a buffer additionally?)
         if (dist_to_current_dest < TRAINSET_STOPPING_DISTANCES[train->train_index][train->speed] +
                                        TRAINSET_ACCEL_DISTANCES[train->train_index][train->speed]) {
@@ -1142,11 +1409,14 @@ static void handle_tick(
             TerminalLogPrint(terminal, "SHORT_MOVE reservation successful");
           } else {
             TerminalLogPrint(terminal, "SHORT_MOVE reservation unsucessful, train is LOCKED");
-            train->state = LOCKED;
-            train->lock_begin_time = time;
+            train_lock(train, time, stats);
             continue;
           }
 
+          train_end_wait(train, time, stats);
+          // the train has been standing since it last moved
+          train->est_pos_update_time = time;
+
           train->state = SHORT_MOVE;
           train->velocity = shortmove_get_velocity(train, dist_to_current_dest);
           train->acceleration = 0;
@@ -1169,7 +1439,7 @@ static void handle_tick(
           train->move_stop_time = train->move_start_time + train->move_duration;
           TerminalLogPrint(terminal, "state change to ACCELERATING from PATH_BEGIN");
 
-          struct TrackNode *dest = current_path_dest_pos.node;
+          const struct TrackNode *dest = current_path_dest_pos.node;
           // TerminalLogPrint(terminal, "last node name %s",
           // plan.path.nodes[last_node_index]->name); TerminalLogPrint(
           //     terminal, "last node index -1  %s", plan.path.nodes[last_node_index - 1]->name
@@ -1185,11 +1455,13 @@ static void handle_tick(
             TerminalLogPrint(terminal, "ACCELERATION reservation sucessful");
           } else {
             TerminalLogPrint(terminal, "ACCELERATION reservation unsucessful, train is LOCKED");
-            train->state = LOCKED;
-            train->lock_begin_time = time;
+            train_lock(train, time, stats);
             continue;
           }
 
+          train_end_wait(train, time, stats);
+          train->est_pos_update_time = time;
+
           train->state = ACCELERATING;
           train->acceleration = get_train_accel(train);
 
@@ -1220,23 +1492,10 @@ static void handle_tick(
         // 2. the train has reached the end of the simple path that it's currently on.
         if (train->path_index == train->plan.paths_len - 1) {
           // release all previous nodes in our path
-          for (int i = 0; i < train->plan.path.nodes_len; ++i) {
-            struct TrackNode *node = train->plan.path.nodes[i];
-
-            if (!(node->type == NODE_SENSOR || node->type == NODE_BRANCH || node->type == NODE_MERGE
-                )) {
-              continue;
-            }
-
-            int zone = node->zone;
-
-            if (ZoneOccupied(zone) == train->train_index) {
-              ReleaseReservations(terminal, zone);
-            }
-          }
+          train_release_path(terminal, train);
 
           if (train->last_sensor_index != -1) {
-            struct TrackNode *sensor = train->plan.path.nodes[train->last_sensor_index];
+            const struct TrackNode *sensor = train->plan.path.nodes[train->last_sensor_index];
             // rereserve the node that we're currently on
             ReserveTrack(terminal, sensor->zone, train->train_index);
           }
@@ -1249,6 +1508,10 @@ static void handle_tick(
             break;
           }
 
+          if (train->pf_state == RAND_ROUTE) {
+            ++stats->deliveries;
+          }
+
           reroute_train(terminal, train_planner, train, time);
           break;
         }
@@ -1258,6 +1521,17 @@ static void handle_tick(
         train->state = PATH_BEGIN;
         break;
       case LOCKED:
+        train_check_deadlock(train, time, stats);
+#if CONFIG_SCHEDULED_ROUTES
+        // the other trains are not where their schedules have them. the repaired search goes
+        // around the zones they hold, the schedule is searched again only if that is blocked too.
+        if (time - train->lock_begin_time >= WAIT_DURATION &&
+            !reroute_locked_train(terminal, train_planner, train, time)) {
+          train->state = PATH_BEGIN;
+          replan_train(terminal, train_planner, train, time);
+        }
+        break;
+#else
         if (time - train->lock_begin_time >= DEADLOCK_DURATION) {
           train->lock_begin_time = time;
 
@@ -1281,10 +1555,13 @@ static void handle_tick(
           }
         }
 
-        if (time - train->lock_begin_time >= WAIT_DURATION) {
+        // the old plan is tried again if there is no way around
+        if (time - train->lock_begin_time >= WAIT_DURATION &&
+            !reroute_locked_train(terminal, train_planner, train, time)) {
           train->state = PATH_BEGIN;
         }
         break;
+#endif
     }
   }
 }
@@ -1324,6 +1601,11 @@ struct Train *sensor_get_train(struct Train *trains, int sensor) {
       continue;
     }
 
+    // a train waiting to leave is standing still, the sensor was closed by another train
+    if (train->state == PATH_BEGIN || train->state == LOCKED) {
+      continue;
+    }
+
     if (train->next_sensor == &track[sensor]) {
       return train;
     }
@@ -1338,13 +1620,37 @@ struct Train *sensor_get_train(struct Train *trains, int sensor) {
   return NULL;
 }
 
+// adds the time of the waits that have not ended yet, so a train that never gets going shows up
+static void add_open_waits(struct Train *trains, int time, struct TrainManagerStats *stats) {
+  for (int i = 0; i < TRAINSET_NUM_TRAINS; ++i) {
+    if (trains[i].wait_begin_time >= 0) {
+      stats->wait_ticks += time - trains[i].wait_begin_time;
+    }
+  }
+}
+
+// feedback modules that hold the next sensor of an active train, as a bitmask
+static int get_watched_modules(struct Train *trains) {
+  int modules = 0;
+
+  for (int i = 0; i < TRAINSET_NUM_TRAINS; ++i) {
+    struct Train *train = &trains[i];
+
+    if (train->active && train->next_sensor != NULL) {
+      modules |= 1 << (train->next_sensor->num / TRAINSET_NUM_SENSORS_PER_MODULE);
+    }
+  }
+
+  return modules;
+}
+
 void set_train_active(struct Train *train, int speed, int time) {
   train->active = true;
   train->speed = speed;
 }
 
 static void
-train_update_pos_from_sensor(struct Train *train, struct TrackNode *sensor_node, int time) {
+train_update_pos_from_sensor(struct Train *train, const struct TrackNode *sensor_node, int time) {
   struct TrackPosition sensor_pos = {.node = sensor_node, .offset = 0};
   struct TrainPosition sensor_train_pos = {.position = sensor_pos, .last_dir = DIR_AHEAD};
   // add offset to get the front of the train from sensor contact point
@@ -1372,43 +1678,45 @@ void train_manager_tick_notifier() {
   }
 }
 
-static void handle_update_sensors_request(
+static void handle_sensor_events_request(
     int terminal,
     int train_tid,
     int train_planner,
-    int clock_server,
     struct Train *train_states,
-    struct TrainManagerUpdateSensorsRequest *req
+    struct TrainManagerSensorEventsRequest *req,
+    struct TrainManagerStats *stats
 ) {
-  int time = Time(clock_server);
-
-  for (int sensor = 0; sensor < TRAINSET_SENSORS_LEN; ++sensor) {
-    if (!req->sensors[sensor]) {
+  for (int i = 0; i < req->len; ++i) {
+    // only a contact closing says where a train is
+    if (!req->events[i].triggered) {
       continue;
     }
 
+    int sensor = req->events[i].sensor;
+    int time = req->events[i].time;
+
     struct Train *train = sensor_get_train(train_states, sensor);
     if (train == NULL) {
       continue;
     }
 
-    struct TrackNode *sensor_node = &track[sensor];
+    const struct TrackNode *sensor_node = &track[sensor];
     // do not update location again if we've already seen the sensor.
     if (train->active && train->last_sensor_index != -1 &&
         train->plan.path.nodes[train->last_sensor_index] == sensor_node) {
       continue;
     }
 
-    struct TrackNode *last_node = train->last_known_pos.position.node;
+    const struct TrackNode *last_node = train->last_known_pos.position.node;
     if (last_node != NULL) {
       int zone = last_node->zone;
       TerminalLogPrint(terminal, "last_known_pos node %s", last_node->name);
 
       // release all previous nodes in our path before the last sensor node
       for (int i = 0; i <= train->last_sensor_index; ++i) {
-        struct TrackNode *node = train->plan.path.nodes[i];
+        const struct TrackNode *node = train->plan.path.nodes[i];
 
-        if (!(node->type == NODE_SENSOR || node->type == NODE_BRANCH || node->type == NODE_MERGE)) {
+        if (!node_has_zone(node)) {
           continue;
         }
 
@@ -1424,8 +1732,13 @@ static void handle_update_sensors_request(
       }
     }
 
+    struct TrainPosition est_pos = train->est_pos;
     train_update_pos_from_sensor(train, sensor_node, time);
 
+    if (train->active && train->plan.path_found) {
+      record_position_error(stats, &train->plan.path, &est_pos.position, &train->est_pos.position);
+    }
+
     TerminalLogPrint(
         terminal, "\033[31mSensor hit %s attributed to Train %d.", sensor_node->name, train->train
     );
@@ -1455,7 +1768,7 @@ static void handle_update_sensors_request(
 
     if (train->state == CONSTANT_VELOCITY) {
       struct SimplePath *cur_path = &train->plan.paths[train->path_index];
-      struct TrackNode *current_path_dest = cur_path->dest.node;
+      const struct TrackNode *current_path_dest = cur_path->dest.node;
       int current_path_dest_dir = cur_path->dest_dir;
       struct TrackPosition current_path_dest_pos = {
           .node = cur_path->dest.node, .offset = cur_path->dest.offset
@@ -1485,8 +1798,8 @@ void route_return(
     int train_planner,
     int time,
     struct Train *train,
-    struct TrackNode *initial_pos,
-    struct TrackNode *dest
+    const struct TrackNode *initial_pos,
+    const struct TrackNode *dest
 ) {
   train->pf_state = ROUTE_TO_SELECTED_DEST;
   train->selected_dest = dest;
@@ -1511,18 +1824,20 @@ void handle_route_return_req(
   int time = Time(clock_server);
   enum Track selected_track = TrainGetSelectedTrack(train_tid);
 
-  struct TrackNode *dest1 = &track[trainset_get_sensor_index(req->dest1)];
+  const struct TrackNode *dest1 = &track[trainset_get_sensor_index(req->dest1)];
   struct Train *train1 = &trains[trainset_get_train_index(req->train1)];
-  struct TrackNode *sensor1 = selected_track == TRACK_A ? &track[trainset_get_sensor_index("A5")]
-                                                        : &track[trainset_get_sensor_index("A2")];
+  const struct TrackNode *sensor1 = selected_track == TRACK_A
+                                    ? &track[trainset_get_sensor_index("A5")]
+                                    : &track[trainset_get_sensor_index("A2")];
 
   route_return(terminal, train_planner, time, train1, sensor1, dest1);
 
   if (req->train2 != 0) {
-    struct TrackNode *dest2 = &track[trainset_get_sensor_index(req->dest2)];
+    const struct TrackNode *dest2 = &track[trainset_get_sensor_index(req->dest2)];
     struct Train *train2 = &trains[trainset_get_train_index(req->train2)];
-    struct TrackNode *sensor2 = selected_track == TRACK_A ? &track[trainset_get_sensor_index("C3")]
-                                                          : &track[trainset_get_sensor_index("A9")];
+    const struct TrackNode *sensor2 = selected_track == TRACK_A
+                                      ? &track[trainset_get_sensor_index("C3")]
+                                      : &track[trainset_get_sensor_index("A9")];
 
     route_return(terminal, train_planner, time, train2, sensor2, dest2);
   }
@@ -1540,8 +1855,9 @@ void handle_rand_route_req(
   enum Track selected_track = TrainGetSelectedTrack(train_tid);
 
   struct Train *train1 = &trains[trainset_get_train_index(req->train1)];
-  struct TrackNode *sensor1 = selected_track == TRACK_A ? &track[trainset_get_sensor_index("A5")]
-                                                        : &track[trainset_get_sensor_index("A2")];
+  const struct TrackNode *sensor1 = selected_track == TRACK_A
+                                    ? &track[trainset_get_sensor_index("A5")]
+                                    : &track[trainset_get_sensor_index("A2")];
 
   // destination is a sensor. we reverse it to fake entering our next zone.
   ReserveTrack(terminal, sensor1->reverse->zone, train1->train_index);
@@ -1553,8 +1869,9 @@ void handle_rand_route_req(
 
   if (req->train2 != 0) {
     struct Train *train2 = &trains[trainset_get_train_index(req->train2)];
-    struct TrackNode *sensor2 = selected_track == TRACK_A ? &track[trainset_get_sensor_index("C3")]
-                                                          : &track[trainset_get_sensor_index("A9")];
+    const struct TrackNode *sensor2 = selected_track == TRACK_A
+                                      ? &track[trainset_get_sensor_index("C3")]
+                                      : &track[trainset_get_sensor_index("A9")];
     // destination is a sensor. we reverse it to fake entering our next zone.
     ReserveTrack(terminal, sensor2->reverse->zone, train2->train_index);
     train_update_pos_from_sensor(train2, sensor2->reverse, time);
@@ -1574,6 +1891,7 @@ void train_manager_task() {
   int terminal = WhoIs("terminal");
 
   struct Train trains[TRAINSET_NUM_TRAINS] = {0};
+  struct TrainManagerStats stats = {0};
 
   for (int i = 0; i < TRAINSET_NUM_TRAINS; ++i) {
     int train_num = TRAINSET_TRAINS[i];
@@ -1758,7 +2076,7 @@ void train_manager_task() {
   // train_update_terminal(terminal, train, time);
 
   // TerminalLogPrint(terminal, "deceleration %d", get_train_decel(train));
-  // struct TrainPosition new_pos = train_position_reverse_node(train->est_pos, train_tid);
+  // struct TrainPosition new_pos = train_position_reverse_node(train->est_pos);
   // TerminalLogPrint(terminal, "new_pos: %s +%d", new_pos.position.node->name,
   // new_pos.position.offset);
 
@@ -1785,6 +2103,7 @@ void train_manager_task() {
   // handle_tick(terminal, train_tid, train_planner, clock_server, trains);
 
   Create(NOTIFIER_PRIORITY, train_manager_tick_notifier);
+  SensorSubscribe(WhoIs("sensor_pub"), TrainManagerSensorEvents, MyTid());
 
   while (true) {
     Receive(&tid, (char *) &req, sizeof(req));
@@ -1802,15 +2121,27 @@ void train_manager_task() {
         );
         Reply(tid, NULL, 0);
         break;
-      case TRAIN_MANAGER_UPDATE_SENSORS:
-        handle_update_sensors_request(
-            terminal, train_tid, train_planner, clock_server, trains, &req.update_sens_req
+      case TRAIN_MANAGER_SENSOR_EVENTS:
+        handle_sensor_events_request(
+            terminal, train_tid, train_planner, trains, &req.sensor_events_req, &stats
         );
         Reply(tid, NULL, 0);
         break;
       case TRAIN_MANAGER_TICK:
-        handle_tick(terminal, train_tid, train_planner, clock_server, trains);
+        handle_tick(terminal, train_tid, train_planner, clock_server, trains, &stats);
         Reply(tid, NULL, 0);
+        break;
+      case TRAIN_MANAGER_GET_WATCHED_MODULES: {
+        int modules = get_watched_modules(trains);
+        Reply(tid, (const char *) &modules, sizeof(modules));
+        break;
+      }
+      case TRAIN_MANAGER_GET_STATS: {
+        struct TrainManagerStats current = stats;
+        add_open_waits(trains, Time(clock_server), &current);
+        Reply(tid, (const char *) &current, sizeof(current));
+        break;
+      }
     }
   }
 }
@@ -1838,9 +2169,22 @@ void TrainManagerRandomlyRoute(int tid, int train1, int train2) {
   Send(tid, (const char *) &req, sizeof(req), NULL, 0);
 }
 
-void TrainManagerUpdateSensors(int tid, bool *sensors) {
+int TrainManagerGetWatchedModules(int tid) {
+  struct TrainManagerRequest req = {.type = TRAIN_MANAGER_GET_WATCHED_MODULES};
+
+  int modules = 0;
+  Send(tid, (const char *) &req, sizeof(req), (char *) &modules, sizeof(modules));
+  return modules;
+}
+
+void TrainManagerGetStats(int tid, struct TrainManagerStats *stats) {
+  struct TrainManagerRequest req = {.type = TRAIN_MANAGER_GET_STATS};
+  Send(tid, (const char *) &req, sizeof(req), (char *) stats, sizeof(*stats));
+}
+
+void TrainManagerSensorEvents(int tid, struct SensorEvent *events, int len) {
   struct TrainManagerRequest req = {
-      .type = TRAIN_MANAGER_UPDATE_SENSORS, .update_sens_req = {.sensors = sensors}
+      .type = TRAIN_MANAGER_SENSOR_EVENTS, .sensor_events_req = {.events = events, .len = len}
   };
   Send(tid, (const char *) &req, sizeof(req), NULL, 0);
 }
@@ -1,8 +1,29 @@
 #pragma once
 #include <stdbool.h>
 
+#include "sensor_publisher.h"
+
+// what the manager has done with the trains since it started, for measuring throughput
+struct TrainManagerStats {
+  // random routes a train finished before being given the next one
+  int deliveries;
+  // times a train had to wait for a reservation, and the ticks it waited in total, including waits
+  // that have not ended yet
+  int waits;
+  int wait_ticks;
+  // waits that went on for DEADLOCK_DURATION, counted once when they get there
+  int deadlocks;
+  // distance between where a train was estimated to be and the sensor it hit, in mm
+  int position_errors;
+  int position_error_total;
+  int position_error_max;
+};
+
 void train_manager_task();
-void TrainManagerUpdateSensors(int tid, bool *sensors);
+void TrainManagerSensorEvents(int tid, struct SensorEvent *events, int len);
 void TrainManagerRouteReturn(int tid, int train1, int train2, char *sensor, char *sensor2);
 void TrainManagerRouteOneReturn(int tid, int train, char *sensor);
 void TrainManagerRandomlyRoute(int tid, int train1, int train2);
+// bitmask of the feedback modules the next sensors of the active trains are on
+int TrainManagerGetWatchedModules(int tid);
+void TrainManagerGetStats(int tid, struct TrainManagerStats *stats);
@@ -3,16 +3,21 @@
 #include <limits.h>
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 #include "selected_track.h"
 #include "syscall.h"
 #include "track_position.h"
 #include "trackdata/track_data.h"
+#include "trackdata/track_graph.h"
 #include "trackdata/track_node_priority_queue.h"
 #include "trackdata/track_node_queue.h"
 #include "user/server/name_server.h"
 #include "user/terminal/terminal_task.h"
 #include "user/train/track_reservations.h"
+#include "user/train/trainset.h"
+#include "user/train/trainset_calib_data.h"
+#include "util.h"
 
 // cost of reversing in terms of distance.
 // ideally should be the distance that can be covered if we do not
@@ -21,85 +26,266 @@ const int REVERSE_COST = 400;
 
 const int REVERSE_OVERSHOOT_DIST = 350;
 
-// we set directions for paths so that all trains
-// travel in the same direction if a train already has a path that goes
-// through the track to prevent deadlocks. when all calculated paths have been
-// traversed, we remove the set direction for the track.
-// stores the number of calculated paths that have set its direction.
-static int reserved_track_directions[TRACK_EDGE_MAX];
-
-// if the direction for the this TrackEdge is set to the same direction
-// of the TrackEdge passed in.
-static bool is_track_available(struct TrackEdge *edge) {
-  // // printf("is track available");
-  // struct TrackEdge *reverse_edge = edge->reverse;
-
-  // // reverse TrackEdge direction reserved
-  // if (reserved_track_directions[reverse_edge->index] > 0) {
-  //   // printf("%d\r\n", edge);
-  //   // printf("track not available %d at %d", reserved_track_directions[reverse_edge->index],
-  //   // reverse_edge->index);
-  //   return false;
-  // }
-
-  // return true;
-  return true;
+static struct TrackNodePriorityQueue queue;
+
+#define ZONE_BOOKINGS_MAX 16
+// nodes within REVERSE_OVERSHOOT_DIST of a node
+#define OVERSHOOT_NODES_MAX 8
+
+// how long a train holds a zone after reaching one of its nodes, as distance travelled. a train
+// length and slack for the time estimate.
+static const int SCHEDULE_HOLD_DIST = 600;
+// how far apart the departures tried for a scheduled plan are, and how long a train can wait, in
+// ticks
+static const int SCHEDULE_DEPART_STEP = 100;
+static const int SCHEDULE_WAIT_MAX = 3000;
+// stops, reverses and speed changes put a train further behind or ahead of its schedule the
+// further along it is, its bookings widen by this fraction of the time since it set off.
+static const int SCHEDULE_SLACK_DIVISOR = 4;
+
+// scheduled plans book the zones they pass through for the time the train should be in them.
+// later scheduled plans go around those bookings in time, or wait for them to end.
+struct ZoneBooking {
+  int train_index;
+  int begin;
+  // INT_MAX where the train stops at the end of its plan
+  int end;
+};
+
+static struct {
+  struct ZoneBooking bookings[ZONE_BOOKINGS_MAX];
+  int len;
+} zone_schedules[ZONE_NUMBERS];
+
+// the train a scheduled plan is for
+struct Schedule {
+  int train_index;
+  // ticks, the earliest the train can leave and when it does
+  int time;
+  int depart_time;
+  // fixed point mm per tick
+  FixedPointInt velocity;
+  // ticks a train holds a zone for after reaching it
+  int hold;
+};
+
+// nodes that zones are reserved by, like ReservePath
+static bool node_has_zone(int node) {
+  enum NodeType type = track_graph_type(track_graph, node);
+  return type == NODE_SENSOR || type == NODE_BRANCH || type == NODE_MERGE;
 }
 
-static void reserve_track_direction(struct TrackEdge *edge) {
-  ++reserved_track_directions[edge->index];
+// when the train reaches a node cost away from where it sets off
+static int schedule_time(struct Schedule *schedule, int cost) {
+  return schedule->depart_time + (FixedPointInt) cost * FIXED_POINT_MULTIPLIER / schedule->velocity;
 }
 
-static struct TrackNodePriorityQueue queue;
+static bool zone_free(int zone, int train_index, int begin, int end) {
+  int holder = ZoneOccupied(zone);
+  // a zone reserved by another train is held until its last booking there ends. without one,
+  // nothing says when it is let go.
+  int held_until = holder == -1 || holder == train_index ? 0 : INT_MAX;
+  bool holder_booked = false;
 
-// Dijikstra's algorithm
-static struct Path get_shortest_path(struct TrainPosition *src, struct TrackNode *dest) {
-  struct TrackNode *src_node = src->position.node;
+  for (int i = 0; i < zone_schedules[zone].len; ++i) {
+    struct ZoneBooking *booking = &zone_schedules[zone].bookings[i];
 
-  // cost includes cost for reversing.
-  int cost[TRACK_MAX] = {0};
-  // initially filled with null
-  struct TrackNode *prev[TRACK_MAX] = {0};
-  int directions[TRACK_MAX] = {0};
+    if (booking->train_index == train_index) {
+      continue;
+    }
 
-  for (int i = 0; i < TRACK_MAX; ++i) {
-    struct TrackNode *node = &track[i];
-    if (node != src_node && node) {
-      cost[i] = INT_MAX;
-      prev[i] = NULL;
+    if (booking->begin < end && begin < booking->end) {
+      return false;
     }
 
-    track_node_priority_queue_add(&queue, node, cost[i]);
+    if (booking->train_index == holder) {
+      held_until = holder_booked ? max(held_until, booking->end) : booking->end;
+      holder_booked = true;
+    }
   }
 
-  directions[src_node->index] = src->last_dir;
-  // directions[src->reverse->index] = DIR_REVERSE;
+  return begin >= held_until;
+}
 
-  while (!track_node_priority_queue_empty(&queue)) {
-    struct TrackNodePriorityQueueNode *queue_node = track_node_priority_queue_poll(&queue);
+static void zone_book(int zone, int train_index, int begin, int end) {
+  for (int i = 0; i < zone_schedules[zone].len; ++i) {
+    struct ZoneBooking *booking = &zone_schedules[zone].bookings[i];
 
-    // has never been visited, do not go to neighbours or we will overflow.
-    if (queue_node->priority == INT_MAX) {
-      continue;
+    if (booking->train_index == train_index && booking->begin <= end && begin <= booking->end) {
+      booking->begin = min(booking->begin, begin);
+      booking->end = max(booking->end, end);
+      return;
+    }
+  }
+
+  // run time reservations still keep trains apart in zones we could not book
+  if (zone_schedules[zone].len < ZONE_BOOKINGS_MAX) {
+    struct ZoneBooking booking = {.train_index = train_index, .begin = begin, .end = end};
+    zone_schedules[zone].bookings[zone_schedules[zone].len++] = booking;
+  }
+}
+
+// drops the train's bookings, it is about to book its new plan, and every booking that is over
+static void zone_schedules_drop(int train_index, int time) {
+  for (int zone = 0; zone < ZONE_NUMBERS; ++zone) {
+    int len = 0;
+
+    for (int i = 0; i < zone_schedules[zone].len; ++i) {
+      struct ZoneBooking *booking = &zone_schedules[zone].bookings[i];
+
+      if (booking->train_index != train_index && booking->end >= time) {
+        zone_schedules[zone].bookings[len++] = *booking;
+      }
+    }
+
+    zone_schedules[zone].len = len;
+  }
+}
+
+// ReservePath takes every zone up to the next stop when the train sets off, and they are let go
+// as the train passes them. so a train holds a zone from when it sets off until it is past.
+static int schedule_release_time(struct Schedule *schedule, int cost) {
+  int time = schedule_time(schedule, cost);
+  return time + schedule->hold + (time - schedule->depart_time) / SCHEDULE_SLACK_DIVISOR;
+}
+
+// the nodes a train runs over past node before it reverses there, like route_plan_process
+static int get_overshoot_nodes(int node, int *nodes) {
+  int len = 0;
+  int dist_left = REVERSE_OVERSHOOT_DIST;
+
+  while (dist_left > 0 && len < OVERSHOOT_NODES_MAX) {
+    // the edge the train runs along to get to the next node
+    dist_left -= track_graph_dist(track_graph, node, DIR_AHEAD);
+    node = track_graph_dest(track_graph, node, DIR_AHEAD);
+    enum NodeType type = track_graph_type(track_graph, node);
+    if (type == NODE_ENTER || type == NODE_EXIT) {
+      break;
+    }
+
+    nodes[len++] = node;
+  }
+
+  return len;
+}
+
+// if the train is clear of other trains' bookings while it holds node's zone
+static bool is_node_available(struct Schedule *schedule, int node, int cost) {
+  if (schedule == NULL || !node_has_zone(node)) {
+    return true;
+  }
+
+  return zone_free(
+      track_graph_zone(track_graph, node),
+      schedule->train_index,
+      schedule->depart_time,
+      schedule_release_time(schedule, cost)
+  );
+}
+
+// the same for the zones the train overshoots into when it reverses at node
+static bool is_overshoot_available(struct Schedule *schedule, int node, int cost) {
+  int nodes[OVERSHOOT_NODES_MAX];
+  int len = schedule == NULL ? 0 : get_overshoot_nodes(node, nodes);
+
+  for (int i = 0; i < len; ++i) {
+    if (!is_node_available(schedule, nodes[i], cost)) {
+      return false;
     }
+  }
+
+  return true;
+}
+
+// not a node index, for next hops that do not exist
+#define ROUTE_NONE UINT8_MAX
+
+// shortest paths between every pair of nodes on the selected track, for a train that can leave
+// its node in any direction. built on the first plan after the track changes, plans without a
+// schedule only follow next hops.
+static struct {
+  bool built;
+  enum Track track;
+  // cost includes cost for reversing.
+  int costs[TRACK_MAX][TRACK_MAX];
+  // next[from][to] is the index of the node after from on the way to to.
+  uint8_t next[TRACK_MAX][TRACK_MAX];
+} routes;
+
+// edges out of and into a node: a branch's two and a reverse
+#define SUCCESSORS_MAX 3
+#define PREDECESSORS_MAX 3
+
+// the nodes with an edge to each node and the direction they leave in, built with the route
+// tables
+static struct {
+  int len;
+  uint8_t nodes[PREDECESSORS_MAX];
+  uint8_t dirs[PREDECESSORS_MAX];
+} predecessors[TRACK_MAX];
+
+// a search from where a train is stopped to every node, around the zones other trains hold. it is
+// kept between plans and only repaired where zones were taken or let go since, lifelong planning
+// A* without a heuristic, so a train that keeps finding its way blocked does not search from
+// scratch each time.
+struct RepairSearch {
+  bool valid;
+  enum Track track;
+  int src;
+  int src_dir;
+  // zones held by other trains, as of the last repair
+  bool blocked[ZONE_NUMBERS];
+  // g and rhs: the cost a node was expanded with, and the best through its predecessors
+  int cost[TRACK_MAX];
+  int lookahead[TRACK_MAX];
+  int prev[TRACK_MAX];
+  int directions[TRACK_MAX];
+  struct TrackNodePriorityQueue queue;
+};
+
+static struct RepairSearch repair_searches[TRAINSET_NUM_TRAINS];
+
+// Dijikstra's algorithm. a train at src leaves in src_dir or reverses, unless any_dir is set.
+// with a schedule, nodes are left out while other trains have their zones booked. prev is
+// TRACK_GRAPH_NONE for nodes that were not reached.
+static void find_shortest_paths(
+    int src,
+    int src_dir,
+    bool any_dir,
+    struct Schedule *schedule,
+    int *cost,
+    int *prev,
+    int *directions
+) {
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    cost[i] = i == src ? 0 : INT_MAX;
+    prev[i] = TRACK_GRAPH_NONE;
+    directions[i] = 0;
+  }
 
-    struct TrackNode *node = queue_node->val;
-    struct TrackNode *neighbour;
+  directions[src] = src_dir;
+  // other nodes are queued as they are reached
+  track_node_priority_queue_add(&queue, &track[src], 0);
+
+  while (!track_node_priority_queue_empty(&queue)) {
+    struct TrackNodePriorityQueueNode *queue_node = track_node_priority_queue_poll(&queue);
+    int node = queue_node->val->index;
+    enum NodeType type = track_graph_type(track_graph, node);
+    int neighbour;
     int alt_cost = 0;
+    bool leaving_src = node == src && !any_dir;
 
-    switch (node->type) {
+    switch (type) {
       case NODE_BRANCH:
-        // if a track direction is unavailable, we try to find an alternative path.
-        if (is_track_available(&node->edge[DIR_CURVED]) &&
-            ((node != src_node) || (node == src_node && src->last_dir == DIR_CURVED))) {
-          neighbour = node->edge[DIR_CURVED].dest;
-          alt_cost = cost[node->index] + node->edge[DIR_CURVED].dist;
-
-          if (alt_cost < cost[neighbour->index]) {
-            cost[neighbour->index] = alt_cost;
-            prev[neighbour->index] = node;
-            directions[neighbour->index] = DIR_CURVED;
-            track_node_priority_queue_decrease_priority(&queue, neighbour, alt_cost);
+        if (!leaving_src || src_dir == DIR_CURVED) {
+          neighbour = track_graph_dest(track_graph, node, DIR_CURVED);
+          alt_cost = cost[node] + track_graph_dist(track_graph, node, DIR_CURVED);
+
+          if (alt_cost < cost[neighbour] && is_node_available(schedule, neighbour, alt_cost)) {
+            cost[neighbour] = alt_cost;
+            prev[neighbour] = node;
+            directions[neighbour] = DIR_CURVED;
+            track_node_priority_queue_decrease_priority(&queue, &track[neighbour], alt_cost);
           }
         }
 
@@ -109,31 +295,32 @@ static struct Path get_shortest_path(struct TrainPosition *src, struct TrackNode
       case NODE_ENTER:
       case NODE_SENSOR:
         // reverse
-        neighbour = node->reverse;
+        neighbour = track_graph_reverse(track_graph, node);
         // cost of reversing
-        alt_cost = cost[node->index] + REVERSE_COST;
-
-        if (alt_cost < cost[neighbour->index] && node->type != NODE_ENTER && node->type != NODE_EXIT) {
-          cost[neighbour->index] = alt_cost;
-          prev[neighbour->index] = node;
-          directions[neighbour->index] = DIR_REVERSE;
-          track_node_priority_queue_decrease_priority(&queue, neighbour, alt_cost);
+        alt_cost = cost[node] + REVERSE_COST;
+
+        if (alt_cost < cost[neighbour] && type != NODE_ENTER && type != NODE_EXIT &&
+            is_node_available(schedule, neighbour, alt_cost) &&
+            (node == src || is_overshoot_available(schedule, node, alt_cost))) {
+          cost[neighbour] = alt_cost;
+          prev[neighbour] = node;
+          directions[neighbour] = DIR_REVERSE;
+          track_node_priority_queue_decrease_priority(&queue, &track[neighbour], alt_cost);
         }
 
         // forward
-        if (!is_track_available(&node->edge[DIR_AHEAD]) ||
-            (node == src_node && src->last_dir != DIR_AHEAD)) {
+        if (leaving_src && src_dir != DIR_AHEAD) {
           break;
         }
 
-        neighbour = node->edge[DIR_AHEAD].dest;
-        alt_cost = cost[node->index] + node->edge[DIR_AHEAD].dist;
+        neighbour = track_graph_dest(track_graph, node, DIR_AHEAD);
+        alt_cost = cost[node] + track_graph_dist(track_graph, node, DIR_AHEAD);
 
-        if (alt_cost < cost[neighbour->index]) {
-          cost[neighbour->index] = alt_cost;
-          prev[neighbour->index] = node;
-          directions[neighbour->index] = DIR_AHEAD;
-          track_node_priority_queue_decrease_priority(&queue, neighbour, alt_cost);
+        if (alt_cost < cost[neighbour] && is_node_available(schedule, neighbour, alt_cost)) {
+          cost[neighbour] = alt_cost;
+          prev[neighbour] = node;
+          directions[neighbour] = DIR_AHEAD;
+          track_node_priority_queue_decrease_priority(&queue, &track[neighbour], alt_cost);
         }
         break;
       case NODE_EXIT:
@@ -141,51 +328,496 @@ static struct Path get_shortest_path(struct TrainPosition *src, struct TrackNode
         break;
     }
   }
+}
 
+// rebuilds the path to dest, or to its reverse if that costs less, from prev and directions.
+static struct Path get_path(int src, int dest, int *cost, int *prev, int *directions) {
   struct Path path = {.directions = {0}, .nodes_len = 0, .path_found = false};
 
   bool dest_reversed = false;
   // if sensor in reverse direction is less costly, path to reverse direction.
-  if (cost[dest->reverse->index] < cost[dest->index]) {
-    dest = dest->reverse;
+  if (cost[track_graph_reverse(track_graph, dest)] < cost[dest]) {
+    dest = track_graph_reverse(track_graph, dest);
     dest_reversed = true;
   }
 
-  if (cost[dest->index] != INT_MAX) {
+  if (cost[dest] != INT_MAX) {
     path.path_found = true;
 
     // work backwards to get full path
-    struct TrackNode *path_node = dest;
-    struct TrackNode *prev_node = NULL;
+    int path_node = dest;
+    int prev_node = TRACK_GRAPH_NONE;
 
-    while (path_node && (path_node != src_node)) {
+    while (path_node != TRACK_GRAPH_NONE && path_node != src) {
       // remove extra reverse at the end.
-      if (dest_reversed && path_node == dest->reverse) {
-        path_node = prev[path_node->index];
+      if (dest_reversed && path_node == track_graph_reverse(track_graph, dest)) {
+        path_node = prev[path_node];
         continue;
       }
 
-      path.nodes[path.nodes_len] = path_node;
+      path.nodes[path.nodes_len] = &track[path_node];
       // increment direction by one to associate direction with the branch that follows this
       // track.
-      path.directions[++path.nodes_len] = directions[path_node->index];
+      path.directions[++path.nodes_len] = directions[path_node];
       prev_node = path_node;
-      path_node = prev[path_node->index];
+      path_node = prev[path_node];
     }
 
     // add starting node
-    if (prev_node && prev_node == path_node->reverse) {
+    if (prev_node != TRACK_GRAPH_NONE &&
+        prev_node == track_graph_reverse(track_graph, path_node)) {
       // set starting node direction to be reverse
-      directions[path_node->index] = DIR_REVERSE;
+      directions[path_node] = DIR_REVERSE;
     }
 
-    path.nodes[path.nodes_len] = path_node;
-    path.directions[path.nodes_len++] = directions[path_node->index];
+    path.nodes[path.nodes_len] = &track[path_node];
+    path.directions[path.nodes_len++] = directions[path_node];
   }
 
   return path;
 }
 
+// the directions find_shortest_paths leaves node in, DIR_REVERSE for turning around. returns how
+// many there are.
+static int get_successor_dirs(int node, int *dirs) {
+  int len = 0;
+
+  switch (track_graph_type(track_graph, node)) {
+    case NODE_BRANCH:
+      dirs[len++] = DIR_CURVED;
+      // fall through
+    case NODE_MERGE:
+    case NODE_SENSOR:
+      dirs[len++] = DIR_REVERSE;
+      // fall through
+    case NODE_ENTER:
+      dirs[len++] = DIR_AHEAD;
+      break;
+    case NODE_EXIT:
+    default:
+      break;
+  }
+
+  return len;
+}
+
+static int get_successor(int node, int dir) {
+  return dir == DIR_REVERSE ? track_graph_reverse(track_graph, node)
+                            : track_graph_dest(track_graph, node, dir);
+}
+
+static void build_predecessors() {
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    predecessors[i].len = 0;
+  }
+
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    int dirs[SUCCESSORS_MAX];
+    int len = get_successor_dirs(i, dirs);
+
+    for (int j = 0; j < len; ++j) {
+      int next = get_successor(i, dirs[j]);
+
+      if (predecessors[next].len < PREDECESSORS_MAX) {
+        predecessors[next].nodes[predecessors[next].len] = i;
+        predecessors[next].dirs[predecessors[next].len++] = dirs[j];
+      }
+    }
+  }
+}
+
+static void build_routes() {
+  int cost[TRACK_MAX];
+  int prev[TRACK_MAX];
+  int directions[TRACK_MAX];
+
+  build_predecessors();
+
+  for (int from = 0; from < TRACK_MAX; ++from) {
+    find_shortest_paths(from, DIR_AHEAD, true, NULL, cost, prev, directions);
+
+    for (int to = 0; to < TRACK_MAX; ++to) {
+      routes.costs[from][to] = cost[to];
+      routes.next[from][to] = ROUTE_NONE;
+
+      if (to == from || cost[to] == INT_MAX) {
+        continue;
+      }
+
+      // work backwards to the node right after from
+      int node = to;
+      while (prev[node] != from) {
+        node = prev[node];
+      }
+      routes.next[from][to] = node;
+    }
+  }
+
+  routes.track = trainset_get_track();
+  routes.built = true;
+}
+
+static int route_direction(int node, int next) {
+  if (track_graph_type(track_graph, node) == NODE_BRANCH &&
+      track_graph_dest(track_graph, node, DIR_CURVED) == next) {
+    return DIR_CURVED;
+  }
+
+  return track_graph_dest(track_graph, node, DIR_AHEAD) == next ? DIR_AHEAD : DIR_REVERSE;
+}
+
+// cost from a train at src to dest through the node it can move to first, which is set in first.
+static int get_route_cost(struct TrainPosition *src, int dest, int *first) {
+  int src_node = src->position.node->index;
+  enum NodeType src_type = track_graph_type(track_graph, src_node);
+  int best = INT_MAX;
+  *first = TRACK_GRAPH_NONE;
+
+  if (dest == src_node) {
+    return 0;
+  }
+
+  int ahead = TRACK_GRAPH_NONE;
+  int ahead_dist = 0;
+  if (src->last_dir == DIR_CURVED && src_type == NODE_BRANCH) {
+    ahead = track_graph_dest(track_graph, src_node, DIR_CURVED);
+    ahead_dist = track_graph_dist(track_graph, src_node, DIR_CURVED);
+  } else if (src->last_dir == DIR_AHEAD && src_type != NODE_EXIT && src_type != NODE_NONE) {
+    ahead = track_graph_dest(track_graph, src_node, DIR_AHEAD);
+    ahead_dist = track_graph_dist(track_graph, src_node, DIR_AHEAD);
+  }
+
+  if (ahead != TRACK_GRAPH_NONE && routes.costs[ahead][dest] != INT_MAX) {
+    best = ahead_dist + routes.costs[ahead][dest];
+    *first = ahead;
+  }
+
+  bool can_reverse =
+      src_type == NODE_BRANCH || src_type == NODE_MERGE || src_type == NODE_SENSOR;
+  int reverse = track_graph_reverse(track_graph, src_node);
+
+  if (can_reverse && routes.costs[reverse][dest] != INT_MAX &&
+      REVERSE_COST + routes.costs[reverse][dest] < best) {
+    best = REVERSE_COST + routes.costs[reverse][dest];
+    *first = reverse;
+  }
+
+  return best;
+}
+
+// fills in the same arrays as find_shortest_paths, but only for the nodes on the way to dest and
+// its reverse. false if the tables cannot be used for this train.
+static bool
+find_route(struct TrainPosition *src, int dest, int *cost, int *prev, int *directions) {
+  if (!routes.built || routes.track != trainset_get_track()) {
+    build_routes();
+  }
+
+  int src_node = src->position.node->index;
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    cost[i] = INT_MAX;
+    prev[i] = TRACK_GRAPH_NONE;
+  }
+
+  cost[src_node] = 0;
+  directions[src_node] = src->last_dir;
+
+  int first;
+  int reverse_first;
+  int reverse_dest = track_graph_reverse(track_graph, dest);
+  cost[dest] = get_route_cost(src, dest, &first);
+  int reverse_cost = get_route_cost(src, reverse_dest, &reverse_first);
+
+  // same tie breaking as get_path
+  if (reverse_cost < cost[dest]) {
+    cost[reverse_dest] = reverse_cost;
+    dest = reverse_dest;
+    first = reverse_first;
+  }
+
+  int node = src_node;
+  int next = first;
+  for (int hops = 0; next != TRACK_GRAPH_NONE; ++hops) {
+    // the shortest path from first comes back through the train, which has to leave in its
+    // direction
+    if (next == src_node || hops == TRACK_MAX) {
+      return false;
+    }
+
+    prev[next] = node;
+    directions[next] = route_direction(node, next);
+
+    node = next;
+    next = node == dest ? TRACK_GRAPH_NONE : routes.next[node][dest];
+  }
+
+  return true;
+}
+
+// cost of leaving node in dir for the search, INT_MAX if it cannot
+static int get_repair_edge_cost(struct RepairSearch *search, int node, int dir) {
+  int next = get_successor(node, dir);
+
+  if (node_has_zone(next) && search->blocked[track_graph_zone(track_graph, next)]) {
+    return INT_MAX;
+  }
+
+  if (dir == DIR_REVERSE) {
+    return REVERSE_COST;
+  }
+
+  if (node == search->src && dir != search->src_dir) {
+    return INT_MAX;
+  }
+
+  return track_graph_dist(track_graph, node, dir);
+}
+
+// works out node's lookahead from its predecessors and queues it if that differs from its cost
+static void repair_node(struct RepairSearch *search, int node) {
+  if (node != search->src) {
+    search->lookahead[node] = INT_MAX;
+    search->prev[node] = TRACK_GRAPH_NONE;
+
+    for (int j = 0; j < predecessors[node].len; ++j) {
+      int pred = predecessors[node].nodes[j];
+      int dir = predecessors[node].dirs[j];
+      if (search->cost[pred] == INT_MAX) {
+        continue;
+      }
+
+      int edge_cost = get_repair_edge_cost(search, pred, dir);
+      if (edge_cost != INT_MAX && search->cost[pred] + edge_cost < search->lookahead[node]) {
+        search->lookahead[node] = search->cost[pred] + edge_cost;
+        search->prev[node] = pred;
+        search->directions[node] = dir;
+      }
+    }
+  }
+
+  if (search->cost[node] != search->lookahead[node]) {
+    track_node_priority_queue_update(
+        &search->queue, &track[node], min(search->cost[node], search->lookahead[node])
+    );
+  } else {
+    track_node_priority_queue_remove(&search->queue, &track[node]);
+  }
+}
+
+static void repair_successors(struct RepairSearch *search, int node) {
+  int dirs[SUCCESSORS_MAX];
+  int len = get_successor_dirs(node, dirs);
+
+  for (int i = 0; i < len; ++i) {
+    repair_node(search, get_successor(node, dirs[i]));
+  }
+}
+
+// expands queued nodes until every node's cost is its lookahead
+static void run_repair_search(struct RepairSearch *search) {
+  while (!track_node_priority_queue_empty(&search->queue)) {
+    int node = track_node_priority_queue_poll(&search->queue)->val->index;
+
+    if (search->cost[node] > search->lookahead[node]) {
+      search->cost[node] = search->lookahead[node];
+    } else {
+      // the node got more expensive, everything reached through it has to be looked at again
+      search->cost[node] = INT_MAX;
+      repair_node(search, node);
+    }
+
+    repair_successors(search, node);
+  }
+}
+
+static bool is_zone_blocked(int zone, int train_index) {
+  int holder = ZoneOccupied(zone);
+  return holder != -1 && holder != train_index;
+}
+
+static void
+init_repair_search(struct RepairSearch *search, struct TrainPosition *src, int train_index) {
+  search->valid = true;
+  search->track = trainset_get_track();
+  search->src = src->position.node->index;
+  search->src_dir = src->last_dir;
+
+  for (int i = 0; i < ZONE_NUMBERS; ++i) {
+    search->blocked[i] = is_zone_blocked(i, train_index);
+  }
+
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    search->cost[i] = INT_MAX;
+    search->lookahead[i] = INT_MAX;
+    search->prev[i] = TRACK_GRAPH_NONE;
+    search->directions[i] = 0;
+  }
+
+  search->lookahead[search->src] = 0;
+  search->directions[search->src] = search->src_dir;
+
+  track_node_priority_queue_init(&search->queue, track);
+  track_node_priority_queue_add(&search->queue, &track[search->src], 0);
+}
+
+// nodes in zones that were taken or let go since the last repair get new lookaheads
+static void repair_zones(struct RepairSearch *search, int train_index) {
+  for (int zone = 0; zone < ZONE_NUMBERS; ++zone) {
+    bool blocked = is_zone_blocked(zone, train_index);
+    if (blocked == search->blocked[zone]) {
+      continue;
+    }
+
+    search->blocked[zone] = blocked;
+
+    for (int i = 0; i < TRACK_MAX; ++i) {
+      if (node_has_zone(i) && track_graph_zone(track_graph, i) == zone) {
+        repair_node(search, i);
+      }
+    }
+  }
+}
+
+// the path a train takes around the zones other trains hold now. the train's search is repaired
+// while it is still where the search started, and started again once it has moved.
+static struct Path
+get_repaired_path(int train_index, struct TrainPosition *src, int dest) {
+  if (!routes.built || routes.track != trainset_get_track()) {
+    build_routes();
+  }
+
+  struct RepairSearch *search = &repair_searches[train_index];
+
+  if (!search->valid || search->track != trainset_get_track() ||
+      search->src != src->position.node->index || search->src_dir != src->last_dir) {
+    init_repair_search(search, src, train_index);
+  } else {
+    repair_zones(search, train_index);
+  }
+
+  run_repair_search(search);
+
+  // get_path marks a reverse at the start in directions
+  int directions[TRACK_MAX];
+  for (int i = 0; i < TRACK_MAX; ++i) {
+    directions[i] = search->directions[i];
+  }
+
+  return get_path(search->src, dest, search->cost, search->prev, directions);
+}
+
+// tries departures from the schedule's time on, until one reaches dest or its reverse and can stay
+// there. the departure is left in the schedule.
+static bool find_scheduled_paths(
+    struct TrainPosition *src,
+    int dest,
+    struct Schedule *schedule,
+    int *cost,
+    int *prev,
+    int *directions
+) {
+  int src_node = src->position.node->index;
+
+  for (int depart = schedule->time; depart <= schedule->time + SCHEDULE_WAIT_MAX;
+       depart += SCHEDULE_DEPART_STEP) {
+    schedule->depart_time = depart;
+    find_shortest_paths(src_node, src->last_dir, false, schedule, cost, prev, directions);
+
+    bool found = false;
+    int ends[] = {dest, track_graph_reverse(track_graph, dest)};
+
+    for (int i = 0; i < 2; ++i) {
+      int end = ends[i];
+      if (cost[end] == INT_MAX) {
+        continue;
+      }
+
+      // the train stays in the zone it stops in until its next plan
+      if (node_has_zone(end) && !zone_free(
+                                    track_graph_zone(track_graph, end),
+                                    schedule->train_index,
+                                    schedule->depart_time,
+                                    INT_MAX
+                                )) {
+        cost[end] = INT_MAX;
+        continue;
+      }
+
+      found = true;
+    }
+
+    if (found) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+// books the zones along path, which runs from the destination back to the train.
+static void book_path(struct Schedule *schedule, struct Path *path, int *cost) {
+  for (int i = 0; i < path->nodes_len; ++i) {
+    int node = path->nodes[i]->index;
+    if (!node_has_zone(node)) {
+      continue;
+    }
+
+    // the train is waiting in its first zone from now
+    int begin = i == path->nodes_len - 1 ? schedule->time : schedule->depart_time;
+    int end = i == 0 ? INT_MAX : schedule_release_time(schedule, cost[node]);
+    zone_book(track_graph_zone(track_graph, node), schedule->train_index, begin, end);
+
+    // reversing anywhere but where the train is
+    if (path->directions[i] == DIR_REVERSE && i + 1 < path->nodes_len - 1) {
+      int overshoot[OVERSHOOT_NODES_MAX];
+      int overshoot_len = get_overshoot_nodes(path->nodes[i + 1]->index, overshoot);
+
+      for (int j = 0; j < overshoot_len; ++j) {
+        if (node_has_zone(overshoot[j])) {
+          zone_book(
+              track_graph_zone(track_graph, overshoot[j]),
+              schedule->train_index,
+              schedule->depart_time,
+              end
+          );
+        }
+      }
+    }
+  }
+}
+
+static struct Path
+get_shortest_path(struct TrainPosition *src, int dest, struct Schedule *schedule) {
+  int src_node = src->position.node->index;
+
+  int cost[TRACK_MAX];
+  int prev[TRACK_MAX];
+  int directions[TRACK_MAX];
+
+  if (schedule && find_scheduled_paths(src, dest, schedule, cost, prev, directions)) {
+    struct Path path = get_path(src_node, dest, cost, prev, directions);
+    book_path(schedule, &path, cost);
+    return path;
+  }
+
+  if (!find_route(src, dest, cost, prev, directions)) {
+    find_shortest_paths(src_node, src->last_dir, false, NULL, cost, prev, directions);
+  }
+
+  // no schedule clears every booking. the train tries to set off now on run time reservations,
+  // and stays where it is as far as later plans know, until it plans again.
+  if (schedule) {
+    schedule->depart_time = 0;
+    if (node_has_zone(src_node)) {
+      zone_book(
+          track_graph_zone(track_graph, src_node), schedule->train_index, schedule->time, INT_MAX
+      );
+    }
+  }
+
+  return get_path(src_node, dest, cost, prev, directions);
+}
+
 static struct TrackNodeQueue path_taken_stack;
 
 // transform RoutePlan to include nodes that we traverse when overshooting a branch
@@ -232,11 +864,11 @@ void route_plan_process(struct RoutePlan *plan) {
 
     // previous path was extended, we need to build a path from extended path to current path.
     if (!track_node_queue_empty(&path_taken_stack)) {
-      struct TrackNode *node = track_node_queue_pop(&path_taken_stack);
+      const struct TrackNode *node = track_node_queue_pop(&path_taken_stack);
 
       TerminalLogPrint(terminal, "prefix extension %s", node->name);
       while (!track_node_queue_empty(&path_taken_stack)) {
-        struct TrackNode *next_node = track_node_queue_pop(&path_taken_stack);
+        const struct TrackNode *next_node = track_node_queue_pop(&path_taken_stack);
 
         TerminalLogPrint(terminal, "next node %s", next_node->name);
 
@@ -252,10 +884,10 @@ void route_plan_process(struct RoutePlan *plan) {
         node = next_node;
       }
 
-      // TerminalLogPrint(terminal, "add node %d", path_index);
-      // include last node
-      // placeholder direction
-      path.directions[path_index] = DIR_AHEAD;
+      // include last node, it leads onto the current path. a branch can be curved towards it.
+      const struct TrackNode *next_node = plan->path.nodes[simple_path->start_index];
+      path.directions[path_index] =
+          node->edge[DIR_AHEAD].dest == next_node ? DIR_AHEAD : DIR_CURVED;
       path.nodes[path_index++] = node;
 
       node = NULL;
@@ -279,7 +911,7 @@ void route_plan_process(struct RoutePlan *plan) {
     }
 
     int last_dir = plan->path.directions[simple_path->end_index];
-    struct TrackNode *node = plan->path.nodes[simple_path->end_index]->edge[last_dir].dest;
+    const struct TrackNode *node = plan->path.nodes[simple_path->end_index]->edge[last_dir].dest;
 
     // extend path by overshoot distance
     int dist_left = REVERSE_OVERSHOOT_DIST;
@@ -288,7 +920,8 @@ void route_plan_process(struct RoutePlan *plan) {
       // we will crash if we allow this because we can't go any further.
       // so just skip all paths that overshoot on exits and enters.
       if (node->type == NODE_ENTER || node->type == NODE_EXIT) {
-        path.path_found = false;
+        // the plan is only half processed, callers have to look for another one
+        plan->path_found = false;
         return;
       }
 
@@ -364,15 +997,20 @@ route_plan_init(struct Path *path, struct TrackPosition *src, struct TrackPositi
   return plan;
 }
 
-enum TrainPlannerRequestType { CREATE_PLAN, TRACK_CROSSED };
+enum TrainPlannerRequestType { CREATE_PLAN };
 
 struct TrainPlannerCreatePlanRequest {
   struct TrainPosition *src;
   struct TrackPosition *dest;
-};
 
-struct TrainPlannerTrackCrossedRequest {
-  struct TrackEdge *edge;
+  // for scheduled plans
+  bool scheduled;
+  // for plans around the zones other trains hold
+  bool repaired;
+  // for both
+  int train_index;
+  int speed;
+  int time;
 };
 
 struct TrainPlannerRequest {
@@ -380,57 +1018,75 @@ struct TrainPlannerRequest {
 
   union {
     struct TrainPlannerCreatePlanRequest create_plan_req;
-    struct TrainPlannerTrackCrossedRequest track_crossed_req;
   };
 };
 
 static struct RoutePlan handle_create_plan(struct TrainPlannerCreatePlanRequest *req) {
   int terminal = WhoIs("terminal");
-  struct Path path = get_shortest_path(req->src, req->dest->node);
-
-  if (path.path_found && path.nodes[0] == req->dest->node->reverse) {
-    if (req->dest->offset == 0) {
-      struct TrackPosition route_dest = {.node = path.nodes[0], .offset = 0};
-      struct RoutePlan plan = route_plan_init(&path, &req->src->position, &route_dest);
-      return plan;
-    }
 
-    // TODO: account for reverse destination node offset
-    // need to remove last node if we're going reverse and subtract offset from previous node
-    // offsets
-    int dest_dir = path.directions[0];
-    int reverse_offset = req->dest->node->edge[dest_dir].dist - req->dest->offset;
-    // change destination to match path if it goes to the reverse node
-    struct TrackPosition route_dest = {.node = path.nodes[0], .offset = reverse_offset};
-    struct RoutePlan plan = route_plan_init(&path, &req->src->position, &route_dest);
-
-    TerminalLogPrint(terminal, "reverse node offset %d", reverse_offset);
+  struct Schedule schedule = {
+      .train_index = req->train_index,
+      .time = req->time,
+      .depart_time = req->time,
+      .velocity = TRAINSET_MEASURED_SPEEDS[req->train_index][req->speed]
+  };
 
-    return plan;
+  // a train that is not moving cannot be placed in time
+  bool scheduled = req->scheduled && schedule.velocity > 0;
+  if (scheduled) {
+    schedule.hold = (FixedPointInt) SCHEDULE_HOLD_DIST * FIXED_POINT_MULTIPLIER / schedule.velocity;
+    zone_schedules_drop(req->train_index, req->time);
   }
 
-  TerminalLogPrint(terminal, "returning normal destination with offset %d", req->dest->offset);
+  struct Path path;
+  if (req->repaired) {
+    path = get_repaired_path(req->train_index, req->src, req->dest->node->index);
 
-  struct RoutePlan plan = route_plan_init(&path, &req->src->position, req->dest);
-  return plan;
-}
+    // the train sets off now, its plan is booked so that scheduled plans keep clear of it
+    if (scheduled && path.path_found) {
+      book_path(&schedule, &path, repair_searches[req->train_index].cost);
+    }
+  } else {
+    path = get_shortest_path(req->src, req->dest->node->index, scheduled ? &schedule : NULL);
+  }
 
-static void handle_track_crossed(struct TrainPlannerTrackCrossedRequest *req) {
-  struct TrackEdge *edge = req->edge;
+  struct RoutePlan plan;
 
-  if (reserved_track_directions[edge->index] == 0) {
-    return;
+  if (path.path_found && path.nodes[0] == req->dest->node->reverse) {
+    if (req->dest->offset == 0) {
+      struct TrackPosition route_dest = {.node = path.nodes[0], .offset = 0};
+      plan = route_plan_init(&path, &req->src->position, &route_dest);
+    } else {
+      // TODO: account for reverse destination node offset
+      // need to remove last node if we're going reverse and subtract offset from previous node
+      // offsets
+      int dest_dir = path.directions[0];
+      int reverse_offset = req->dest->node->edge[dest_dir].dist - req->dest->offset;
+      // change destination to match path if it goes to the reverse node
+      struct TrackPosition route_dest = {.node = path.nodes[0], .offset = reverse_offset};
+      plan = route_plan_init(&path, &req->src->position, &route_dest);
+
+      TerminalLogPrint(terminal, "reverse node offset %d", reverse_offset);
+    }
+  } else {
+    TerminalLogPrint(terminal, "returning normal destination with offset %d", req->dest->offset);
+    plan = route_plan_init(&path, &req->src->position, req->dest);
   }
 
-  --reserved_track_directions[edge->index];
+  plan.depart_time = scheduled ? schedule.depart_time : 0;
+  return plan;
 }
 
 void train_planner_task() {
   RegisterAs("train_planner");
 
   track_node_priority_queue_init(&queue, track);
-  for (int i = 0; i < TRACK_EDGE_MAX; ++i) {
-    reserved_track_directions[i] = 0;
+  for (int i = 0; i < ZONE_NUMBERS; ++i) {
+    zone_schedules[i].len = 0;
+  }
+
+  for (int i = 0; i < TRAINSET_NUM_TRAINS; ++i) {
+    repair_searches[i].valid = false;
   }
 
   int tid;
@@ -444,17 +1100,39 @@ void train_planner_task() {
         Reply(tid, (const char *) &plan, sizeof(plan));
         break;
       }
-      case TRACK_CROSSED:
-        handle_track_crossed(&req.track_crossed_req);
-        Reply(tid, NULL, 0);
-        break;
     }
   }
 }
 
 struct RoutePlan CreatePlan(int tid, struct TrainPosition *src, struct TrackPosition *dest) {
   struct TrainPlannerRequest req = {
-      .type = CREATE_PLAN, .create_plan_req = {.src = src, .dest = dest}
+      .type = CREATE_PLAN,
+      .create_plan_req = {.src = src, .dest = dest, .scheduled = false, .repaired = false}
+  };
+
+  struct RoutePlan plan;
+  Send(tid, (const char *) &req, sizeof(req), (char *) &plan, sizeof(plan));
+  return plan;
+}
+
+struct RoutePlan CreateScheduledPlan(
+    int tid,
+    int train_index,
+    int speed,
+    int time,
+    struct TrainPosition *src,
+    struct TrackPosition *dest
+) {
+  struct TrainPlannerRequest req = {
+      .type = CREATE_PLAN,
+      .create_plan_req =
+          {.src = src,
+           .dest = dest,
+           .scheduled = true,
+           .repaired = false,
+           .train_index = train_index,
+           .speed = speed,
+           .time = time}
   };
 
   struct RoutePlan plan;
@@ -462,9 +1140,27 @@ struct RoutePlan CreatePlan(int tid, struct TrainPosition *src, struct TrackPosi
   return plan;
 }
 
-// used to signal to the planner that a train has crossed over a track
-// whose direction was reserved for a plan.
-void TrackCrossed(int tid, struct TrackEdge *edge) {
-  struct TrainPlannerRequest req = {.type = TRACK_CROSSED, .track_crossed_req = {.edge = edge}};
-  Send(tid, (const char *) &req, sizeof(req), NULL, 0);
+struct RoutePlan CreateRepairedPlan(
+    int tid,
+    int train_index,
+    int speed,
+    int time,
+    struct TrainPosition *src,
+    struct TrackPosition *dest
+) {
+  struct TrainPlannerRequest req = {
+      .type = CREATE_PLAN,
+      .create_plan_req =
+          {.src = src,
+           .dest = dest,
+           .scheduled = true,
+           .repaired = true,
+           .train_index = train_index,
+           .speed = speed,
+           .time = time}
+  };
+
+  struct RoutePlan plan;
+  Send(tid, (const char *) &req, sizeof(req), (char *) &plan, sizeof(plan));
+  return plan;
 }
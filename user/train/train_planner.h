@@ -14,6 +14,9 @@ struct RoutePlan {
   struct TrackPosition src;
   struct TrackPosition dest;
   unsigned int paths_len;
+  // when a scheduled plan has the train set off. 0 for other plans, and scheduled plans that found
+  // no schedule.
+  int depart_time;
   bool path_found;
 };
 
@@ -22,4 +25,25 @@ void train_planner_task();
 void route_plan_process(struct RoutePlan *plan);
 
 struct RoutePlan CreatePlan(int tid, struct TrainPosition *src, struct TrackPosition *dest);
-void TrackCrossed(int tid, struct TrackEdge *edge);
+// plans around the zones other trains' scheduled plans pass through while this train, running at
+// speed, would pass through them. the train sets off at time or waits for a booking to end, and
+// its earlier bookings are replaced by the zones along the new plan.
+struct RoutePlan CreateScheduledPlan(
+    int tid,
+    int train_index,
+    int speed,
+    int time,
+    struct TrainPosition *src,
+    struct TrackPosition *dest
+);
+// plans around the zones other trains hold. the train's search is kept between these plans and
+// repaired where zones changed hands, as long as the train is still where it started. at a speed
+// other than 0 the plan replaces the train's bookings, setting off at time, like a scheduled plan.
+struct RoutePlan CreateRepairedPlan(
+    int tid,
+    int train_index,
+    int speed,
+    int time,
+    struct TrainPosition *src,
+    struct TrackPosition *dest
+);
@@ -46,7 +46,7 @@ struct TrainRouterRequest {
 // time to wait for train to hit constant speed (5s) in ticks
 static const int ACCELERATION_DURATION = 500;
 
-static struct TrackNode *track_get_sensor(char *sensor) {
+static const struct TrackNode *track_get_sensor(char *sensor) {
   int index = trainset_get_sensor_index(sensor);
   // first nodes are all sensors
   return &track[index];
@@ -59,14 +59,14 @@ struct TrackPosition {
   // position of train relative to the start of a track from the direction
   // the train is heading from
   unsigned int offset;
-  struct TrackNode *node;
+  const struct TrackNode *node;
 };
 
 enum PlanState { PLAN_NONE, PLAN_ACCELERATING, PLAN_CALCULATING_PATH, PLAN_WAITING_TO_STOP };
 
 struct Path {
   // nodes starting from destination
-  struct TrackNode *nodes[TRACK_MAX];
+  const struct TrackNode *nodes[TRACK_MAX];
   int directions[TRACK_MAX];
   int nodes_len;
   int distance;
@@ -125,7 +125,7 @@ static FixedPointInt trainstate_get_current_offset(struct TrainState *state, int
 
 static void path_set_switches(struct Path *path, int train_tid) {
   for (int i = path->nodes_len - 1; i >= 0; --i) {
-    struct TrackNode *node = path->nodes[i];
+    const struct TrackNode *node = path->nodes[i];
 
     // switch
     if (node->type == NODE_BRANCH) {
@@ -144,34 +144,29 @@ static void path_set_switches(struct Path *path, int train_tid) {
 static struct TrackNodePriorityQueue queue;
 
 // Dijikstra's algorithm
-static struct Path get_shortest_path(struct TrainState *state, struct TrackNode *dest) {
+static struct Path get_shortest_path(struct TrainState *state, const struct TrackNode *dest) {
   int dist[TRACK_MAX] = {0};
   // initially filled with null
-  struct TrackNode *prev[TRACK_MAX] = {0};
+  const struct TrackNode *prev[TRACK_MAX] = {0};
   int directions[TRACK_MAX] = {0};
 
-  struct TrackNode *source = state->last_known_pos.node;
+  const struct TrackNode *source = state->last_known_pos.node;
 
   for (int i = 0; i < TRACK_MAX; ++i) {
-    struct TrackNode *node = &track[i];
+    const struct TrackNode *node = &track[i];
     if (node != source) {
       dist[i] = INT_MAX;
       prev[i] = NULL;
     }
-
-    track_node_priority_queue_add(&queue, node, dist[i]);
   }
 
+  // other nodes are queued as they are reached
+  track_node_priority_queue_add(&queue, source, 0);
+
   while (!track_node_priority_queue_empty(&queue)) {
     struct TrackNodePriorityQueueNode *queue_node = track_node_priority_queue_poll(&queue);
-
-    // has never been visited, do not go to neighbours or we will overflow.
-    if (queue_node->priority == INT_MAX) {
-      continue;
-    }
-
-    struct TrackNode *node = queue_node->val;
-    struct TrackNode *neighbour;
+    const struct TrackNode *node = queue_node->val;
+    const struct TrackNode *neighbour;
     int alt = 0;
 
     switch (node->type) {
@@ -217,7 +212,7 @@ static struct Path get_shortest_path(struct TrainState *state, struct TrackNode
 
   struct Path path = {.distance = dist[dest->index], .directions = {0}, .nodes_len = 0};
   // work backwards to get full path
-  struct TrackNode *path_node = dest;
+  const struct TrackNode *path_node = dest;
   while (path_node && path_node != state->last_known_pos.node) {
     path.nodes[path.nodes_len] = path_node;
     // increment direction by one to associate direction with the branch that follows this
@@ -235,7 +230,7 @@ static struct Path get_shortest_path(struct TrainState *state, struct TrackNode
 
 static int get_next_sensor(struct Plan *plan, struct Path *path) {
   for (int i = plan->last_sensor_index - 1; i >= 0; --i) {
-    struct TrackNode *node = path->nodes[i];
+    const struct TrackNode *node = path->nodes[i];
 
     if (node->type == NODE_SENSOR) {
       return i;
@@ -259,7 +254,7 @@ get_distance_between(struct Path *path, struct TrackPosition *src, struct TrackP
 
   // find distance from pos1 to pos2
   for (int i = pos1_index; i >= 0; --i) {
-    struct TrackNode *node = path->nodes[i];
+    const struct TrackNode *node = path->nodes[i];
     int edge_dir = path->directions[i];
 
     if (node == dest->node) {
@@ -291,11 +286,11 @@ static struct TrackPosition plan_get_stopping_pos(struct Plan *plan, struct Trai
   int stopping_offset = path->distance - state->last_known_pos.offset + plan->dest.offset -
                         TRAINSET_STOPPING_DISTANCES[state->train_index][state->speed];
 
-  struct TrackNode *last_node = NULL;
+  const struct TrackNode *last_node = NULL;
   int offset_from_last_node = stopping_offset;
   // traverse path to see which node is before the stopping_offset
   for (int i = path->nodes_len - 1; i >= 0; --i) {
-    struct TrackNode *cur_node = path->nodes[i];
+    const struct TrackNode *cur_node = path->nodes[i];
     int edge_dir = path->directions[i];
     int edge_dist = cur_node->edge[edge_dir].dist;
 
@@ -460,7 +455,7 @@ static void handle_update_sensors_request(
         TerminalLogPrint(terminal, "No sensors left until destination.");
       }
 
-      struct TrackNode *sensor_node = plan->path.nodes[next_sensor_index];
+      const struct TrackNode *sensor_node = plan->path.nodes[next_sensor_index];
       struct TrackPosition sensor_pos = {.node = sensor_node, .offset = 0};
       int next_sensor_travel_time = get_travel_time_between(
           &plan->path, trainstate, &trainstate->last_known_pos, &sensor_pos
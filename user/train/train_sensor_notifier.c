@@ -1,81 +1,229 @@
 #include "train_sensor_notifier.h"
 
+#include "sensor_publisher.h"
 #include "syscall.h"
-#include "train_calibrator.h"
+#include "timer.h"
 #include "train_dispatcher.h"
 #include "train_manager.h"
-#include "train_router.h"
 #include "trainset.h"
-#include "trainset_task.h"
+#include "uart.h"
 #include "user/server/clock_server.h"
 #include "user/server/io_server.h"
 #include "user/server/name_server.h"
 #include "user/terminal/terminal_task.h"
 
-static const unsigned char CMD_READ_ALL_SENSORS[] = {0x80 + TRAINSET_NUM_FEEDBACK_MODULES};
-
-static bool process_sensor_data(char *raw_sensor_data, bool *out_sensor_data) {
-  bool diff = false;
+// every feedback module, the whole dump is read with a single command
+static const int SENSOR_MODULES_ALL = (1 << TRAINSET_NUM_FEEDBACK_MODULES) - 1;
+// modules away from the trains' next sensors are still swept this often (200ms), in microseconds
+static const uint64_t SENSOR_FULL_SWEEP_INTERVAL = 200000;
+// how often the refresh rates are logged (10s), in microseconds
+static const uint64_t SENSOR_STATS_INTERVAL = 10000000;
+
+// time between reads of a module, split by whether the module was being watched
+struct SensorRefreshStats {
+  uint64_t last_read[TRAINSET_NUM_FEEDBACK_MODULES];
+  uint64_t watched_sum;
+  unsigned int watched_count;
+  uint64_t swept_sum;
+  unsigned int swept_count;
+  // duration of a full read, the refresh interval of every sensor with full polling
+  uint64_t full_sum;
+  unsigned int full_count;
+};
+
+// a poll and when each of its bytes arrived
+struct SensorSample {
+  char data[TRAINSET_NUM_FEEDBACK_MODULES * 2];
+  // arrival time of each byte in microseconds, bytes that were not read keep their last time
+  uint64_t stamps[TRAINSET_NUM_FEEDBACK_MODULES * 2];
+};
+
+// compares a poll against the last one and appends an event for every contact that changed.
+// now_time and now are the same instant in ticks and microseconds. returns the number of events.
+static int sensor_edges(
+    struct SensorSample *sample,
+    struct SensorSample *last_sample,
+    int now_time,
+    uint64_t now,
+    struct SensorEvent *events
+) {
+  int len = 0;
 
   // each feedback module has 2 numbers (contacts 1 to 8) and (contacts 9 to 16)
   for (int i = 0; i < TRAINSET_NUM_FEEDBACK_MODULES * 2; ++i) {
-    char ch = raw_sensor_data[i];
-
     // 1 byte (8 bits) and each char represents 8 sensors
     // the most significant bit represents the lowest sensor
-    for (int j = 0; j < 8; ++j) {
-      // take last bit each time
-      bool sensor_triggered = (ch >> (7 - j)) & 1;
+    char changed = sample->data[i] ^ last_sample->data[i];
+
+    // the contact changed some time after the previous sample of this byte was taken
+    uint64_t window_end = sample->stamps[i];
+    uint64_t window_begin = last_sample->stamps[i] != 0 ? last_sample->stamps[i] : window_end;
+    uint64_t midpoint = window_begin + (window_end - window_begin) / 2;
+    // half the window in ticks, rounded up so it still bounds the change
+    int half_window = (window_end - window_begin + 2 * TIMER_TICK_DURATION - 1) /
+                      (2 * TIMER_TICK_DURATION);
+
+    for (int j = 0; changed != 0 && j < 8; ++j) {
+      if ((changed >> (7 - j)) & 1) {
+        events[len].sensor = i * 8 + j;
+        events[len].triggered = (sample->data[i] >> (7 - j)) & 1;
+        events[len].time = now_time - (int) ((now - midpoint) / TIMER_TICK_DURATION);
+        events[len].time_error = last_sample->stamps[i] != 0 ? half_window : -1;
+        ++len;
+      }
+    }
+  }
+
+  *last_sample = *sample;
+  return len;
+}
+
+// reads the modules in the mask into their place in raw_sensor_data
+static void read_sensor_modules(
+    int train_dispatcher,
+    int marklin_rx,
+    int modules,
+    char *raw_sensor_data
+) {
+  if (modules == SENSOR_MODULES_ALL) {
+    DispatchTrainCommand(train_dispatcher, MARKLIN_CMD_SENSOR_READ, 0, 0);
+    // the dump is read in one request instead of a round trip per byte
+    GetN(marklin_rx, (unsigned char *) raw_sensor_data, TRAINSET_NUM_FEEDBACK_MODULES * 2, 0);
+    return;
+  }
+
+  int len = 0;
+  for (int module = 0; module < TRAINSET_NUM_FEEDBACK_MODULES; ++module) {
+    if (modules & (1 << module)) {
+      DispatchTrainCommand(train_dispatcher, MARKLIN_CMD_SENSOR_READ_MODULE, module + 1, 0);
+      len += 2;
+    }
+  }
+
+  // the replies come back in the order the modules were asked for
+  char data[TRAINSET_NUM_FEEDBACK_MODULES * 2];
+  GetN(marklin_rx, (unsigned char *) data, len, 0);
+
+  int offset = 0;
+  for (int module = 0; module < TRAINSET_NUM_FEEDBACK_MODULES; ++module) {
+    if (modules & (1 << module)) {
+      raw_sensor_data[module * 2] = data[offset++];
+      raw_sensor_data[module * 2 + 1] = data[offset++];
+    }
+  }
+}
+
+static void sensor_refresh_update(
+    struct SensorRefreshStats *stats,
+    int modules,
+    int watched,
+    uint64_t start,
+    uint64_t end
+) {
+  if (modules == SENSOR_MODULES_ALL) {
+    stats->full_sum += end - start;
+    ++stats->full_count;
+  }
 
-      if (out_sensor_data[i * 8 + j] != sensor_triggered) {
-        out_sensor_data[i * 8 + j] = sensor_triggered;
-        diff = true;
+  for (int module = 0; module < TRAINSET_NUM_FEEDBACK_MODULES; ++module) {
+    if (!(modules & (1 << module))) {
+      continue;
+    }
+
+    if (stats->last_read[module] != 0) {
+      uint64_t interval = end - stats->last_read[module];
+
+      if (watched & (1 << module)) {
+        stats->watched_sum += interval;
+        ++stats->watched_count;
+      } else {
+        stats->swept_sum += interval;
+        ++stats->swept_count;
       }
     }
+
+    stats->last_read[module] = end;
   }
+}
 
-  return diff;
+static void sensor_refresh_log(int terminal, struct SensorRefreshStats *stats) {
+  // average refresh interval in milliseconds
+  unsigned int watched =
+      stats->watched_count ? stats->watched_sum / stats->watched_count / 1000 : 0;
+  unsigned int swept = stats->swept_count ? stats->swept_sum / stats->swept_count / 1000 : 0;
+  unsigned int full = stats->full_count ? stats->full_sum / stats->full_count / 1000 : 0;
+
+  TerminalLogPrint(
+      terminal,
+      "Sensor refresh: next sensors every %u ms, others every %u ms, full poll takes %u ms",
+      watched,
+      swept,
+      full
+  );
+
+  stats->watched_sum = stats->swept_sum = stats->full_sum = 0;
+  stats->watched_count = stats->swept_count = stats->full_count = 0;
 }
 
 void train_sensor_notifier_task() {
   int marklin_rx = WhoIs("marklin_io_rx");
-  int marklin_tx = WhoIs("marklin_io_tx");
+  int train_dispatcher = WhoIs("train_dispatch");
+  int sensor_publisher = WhoIs("sensor_pub");
   int clock_server = WhoIs("clock_server");
 
-  int train = WhoIs("train");
   int terminal = WhoIs("terminal");
-  int train_calib = WhoIs("train_calib");
-  // int train_router = WhoIs("train_router");
   int train_manager = WhoIs("train_manager");
 
-  bool sensors[TRAINSET_SENSORS_LEN] = {0};
-  char raw_sensor_data[TRAINSET_NUM_FEEDBACK_MODULES * 2] = {0};
+  // modules that are not read in a poll keep their last bytes, so they produce no events
+  struct SensorSample sample = {0};
+  struct SensorSample last_sample = {0};
+  struct SensorEvent events[TRAINSET_SENSORS_LEN];
   uint64_t max_time_taken = 0;
 
+  struct SensorRefreshStats refresh_stats = {0};
+  uint64_t last_sweep = 0;
+  uint64_t last_stats = timer_get_time();
+
   while (true) {
-    uint64_t start_time = Time(clock_server);
+    uint64_t start = timer_get_time();
 
-    DispatchTrainCommand(marklin_tx, CMD_READ_ALL_SENSORS, 1);
-    for (int i = 0; i < TRAINSET_NUM_FEEDBACK_MODULES * 2; ++i) {
-      raw_sensor_data[i] = Getc(marklin_rx);
+    // only the modules the trains are about to reach are polled in between full sweeps. with no
+    // predictions every poll is a full sweep, like before.
+    int watched = TrainManagerGetWatchedModules(train_manager);
+    int modules = watched;
+
+    if (watched == 0 || start - last_sweep >= SENSOR_FULL_SWEEP_INTERVAL) {
+      modules = SENSOR_MODULES_ALL;
+      last_sweep = start;
     }
-    NotifyMarklinRead(marklin_tx);
 
+    read_sensor_modules(train_dispatcher, marklin_rx, modules, sample.data);
+    // stamped by the rx interrupt as each byte came in
+    uart_marklin_sensor_stamps(sample.stamps);
+
+    uint64_t end = timer_get_time();
     uint64_t end_time = Time(clock_server);
-    uint64_t time_taken = end_time - start_time;
-
-    if (process_sensor_data(raw_sensor_data, sensors)) {
-      TrainCalibratorUpdateSensors(train_calib, sensors);
-      // TrainRouterUpdateSensors(train_router, sensors);
-      TrainManagerUpdateSensors(train_manager, sensors);
-      TerminalUpdateSensors(terminal, sensors, TRAINSET_SENSORS_LEN);
-      TrainUpdateSensorData(train, sensors);
+    // in microseconds, a tick is too coarse to show what the irq path costs a query
+    uint64_t time_taken = end - start;
+
+    // consumers only see the sensors that changed, the publisher copies the events and never
+    // waits on them
+    int events_len = sensor_edges(&sample, &last_sample, end_time, end, events);
+    if (events_len > 0) {
+      SensorPublish(sensor_publisher, events, events_len);
     }
 
     if (max_time_taken < time_taken) {
       max_time_taken = time_taken;
       TerminalUpdateMaxSensorDuration(terminal, time_taken);
     }
+
+    sensor_refresh_update(&refresh_stats, modules, watched, start, end);
+
+    if (end - last_stats >= SENSOR_STATS_INTERVAL) {
+      sensor_refresh_log(terminal, &refresh_stats);
+      last_stats = end;
+    }
   }
 
   Exit();
@@ -3,6 +3,7 @@
 #include <stdbool.h>
 
 #include "selected_track.h"
+#include "switch_snapshot.h"
 #include "syscall.h"
 #include "track_reservations.h"
 #include "train_dispatcher.h"
@@ -20,15 +21,12 @@ const unsigned int DELAY_OFF_LAST_SOLENOID = 15;
 // delay between braking and reversing (2s) in ticks.
 const unsigned int DELAY_REVERSE = 200;
 
-static const unsigned char CMD_SENSOR_RESET_MODE = 0xC0;
-
-// offset to add to speed to turn on function on train (headlights)
-static const int SPEED_OFFSET_FUNCTION = 16;
 const int SPEED_REVERSE_DIRECTION = 15;
 
 const int TRAINSET_TRAINS[] = {1, 2, 24, 47, 54, 58, 77, 78};
 
-struct TrackNode track[TRACK_MAX];
+const struct TrackNode *track;
+const struct TrackGraph *track_graph;
 
 static enum Track selected_track = TRACK_B;
 
@@ -62,6 +60,7 @@ void trainset_init(struct Trainset *trainset, int train_dispatcher_tid) {
   for (unsigned int i = 0; i < TRAINSET_NUM_MAX_SWITCHES; ++i) {
     trainset->switch_states[i] = DIRECTION_UNKNOWN;
   }
+  switch_snapshot_reset();
 
   for (unsigned int i = 0; i < TRAINSET_NUM_TRAINS; ++i) {
     trainset->train_speeds[i] = 0;
@@ -69,13 +68,7 @@ void trainset_init(struct Trainset *trainset, int train_dispatcher_tid) {
 
   uart_config_and_enable(UART_MARKLIN, BAUD_RATE, true, false, true);
 
-  unsigned char cmd[] = {CMD_SENSOR_RESET_MODE};
-  DispatchTrainCommand(trainset->train_dispatcher, cmd, 1);
-}
-
-static void send_command(struct Trainset *trainset, unsigned char arg1, unsigned char arg2) {
-  unsigned char data[] = {arg1, arg2};
-  DispatchTrainCommand(trainset->train_dispatcher, data, 2);
+  DispatchTrainCommand(trainset->train_dispatcher, MARKLIN_CMD_SENSOR_RESET, 0, 0);
 }
 
 void trainset_set_train_speed(
@@ -89,13 +82,12 @@ void trainset_set_train_speed(
   if (speed == SPEED_REVERSE_DIRECTION) {
     // reverse direction stops the train
     trainset->train_speeds[train_index] = 0;
+    DispatchTrainCommand(trainset->train_dispatcher, MARKLIN_CMD_REVERSE, train, 0);
   } else {
     trainset->train_speeds[train_index] = speed;
     TerminalUpdateTrainSpeed(terminal_tid, train_index, speed);
+    DispatchTrainCommand(trainset->train_dispatcher, MARKLIN_CMD_SPEED, train, speed);
   }
-
-  // add 16 to speed for auxiliary function
-  send_command(trainset, speed + SPEED_OFFSET_FUNCTION, train);
 }
 
 bool trainset_is_valid_train(uint8_t train) {
@@ -121,6 +113,10 @@ void trainset_train_reverse(struct Trainset *trainset, int terminal_tid, uint8_t
   Send(reverse_task, (const char *) &req, sizeof(req), NULL, 0);
 }
 
+static enum SwitchDirection get_switch_direction(int direction) {
+  return direction == TRAINSET_DIRECTION_CURVED ? DIRECTION_CURVED : DIRECTION_STRAIGHT;
+}
+
 void trainset_set_switch_direction(
     struct Trainset *trainset,
     int terminal_tid,
@@ -128,28 +124,28 @@ void trainset_set_switch_direction(
     int direction,
     uint64_t time
 ) {
-  send_command(trainset, direction, switch_number);
+  // the dispatcher switches the solenoid off once the burst of switches is over
+  DispatchTrainCommand(trainset->train_dispatcher, MARKLIN_CMD_SWITCH, switch_number, direction);
 
-  enum SwitchDirection switch_direction =
-      direction == TRAINSET_DIRECTION_CURVED ? DIRECTION_CURVED : DIRECTION_STRAIGHT;
+  enum SwitchDirection switch_direction = get_switch_direction(direction);
 
   trainset->last_track_switch_time = time;
   trainset->switch_states[switch_number] = switch_direction;
+  switch_snapshot_publish(switch_number, switch_direction);
   TerminalUpdateSwitchState(terminal_tid, switch_number, switch_direction);
-
-  // switch off solenoid after a period.
-  Create(TRAIN_TASK_PRIORITY, train_off_solenoid_task);
 }
 
 void trainset_set_track(struct Trainset *trainset, char track_type) {
   switch (track_type) {
     case 'A':
-      tracka_init(track);
+      track = TRACKA_NODES;
+      track_graph = &TRACKA_GRAPH;
       zones_a_init();
       selected_track = TRACK_A;
       break;
     case 'B':
-      trackb_init(track);
+      track = TRACKB_NODES;
+      track_graph = &TRACKB_GRAPH;
       zones_b_init();
       selected_track = TRACK_B;
       break;
@@ -162,14 +158,6 @@ enum Track trainset_get_track() {
   return selected_track;
 }
 
-void trainset_update_sensor_data(struct Trainset *trainset, bool *sensor_data) {
-  trainset->sensors_occupied = sensor_data;
-}
-
-bool *trainset_get_sensor_data(struct Trainset *trainset) {
-  return trainset->sensors_occupied;
-}
-
 enum SwitchDirection trainset_get_switch_state(struct Trainset *trainset, uint8_t switch_number) {
   return trainset->switch_states[switch_number];
 }
@@ -22,7 +22,6 @@ extern const int SPEED_REVERSE_DIRECTION;
 
 struct Trainset {
   enum SwitchDirection switch_states[TRAINSET_NUM_MAX_SWITCHES];
-  bool *sensors_occupied;
 
   uint8_t train_speeds[TRAINSET_NUM_TRAINS];
 
@@ -51,8 +50,6 @@ void trainset_set_switch_direction(
     int direction,
     uint64_t time
 );
-void trainset_update_sensor_data(struct Trainset *trainset, bool *sensor_data);
-bool *trainset_get_sensor_data(struct Trainset *trainset);
 bool trainset_is_valid_train(uint8_t train);
 void trainset_set_track(struct Trainset *trainset, char track_type);
 enum Track trainset_get_track();
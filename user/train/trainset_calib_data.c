@@ -1,5 +1,7 @@
 #include "trainset_calib_data.h"
 
+#include <stdbool.h>
+
 // add 1 to include 0
 FixedPointInt TRAINSET_MEASURED_SPEEDS[TRAINSET_NUM_TRAINS][TRAIN_SPEED_MAX + 1];
 int TRAINSET_STOPPING_DISTANCES[TRAINSET_NUM_TRAINS][TRAIN_SPEED_MAX + 1];
@@ -45,6 +47,13 @@ static int train54_delays[] = {50, 100, 150, 200, 250, 300, 350, 400};
 static void shortmove_dist_init(FixedPointInt *dists, int len);
 
 void trainset_calib_data_init() {
+  // the tables are scaled in place, so they can only be set up once
+  static bool initialized = false;
+  if (initialized) {
+    return;
+  }
+  initialized = true;
+
   for (int i = 0; i < TRAINSET_NUM_TRAINS; ++i) {
     TRAINSET_MEASURED_SPEEDS[i][0] = 0;
     TRAINSET_STOPPING_DISTANCES[i][0] = 0;
@@ -24,4 +24,6 @@ inline int fixed_point_int_get(int64_t val) {
   return val / FIXED_POINT_MULTIPLIER;
 }
 
+// fills in the tables above, only the first call does anything
+void trainset_calib_data_init();
 int shortmove_get_duration(int train, int speed, int dist);
@@ -5,15 +5,12 @@
 
 #include "syscall.h"
 #include "train_calibrator.h"
-#include "train_dispatcher.h"
 #include "trainset.h"
 #include "user/server/clock_server.h"
 #include "user/server/io_server.h"
 #include "user/server/name_server.h"
 #include "user/terminal/terminal_task.h"
 
-const unsigned char CMD_OFF_LAST_SOLENOID[] = {0x20};
-
 const int TRAIN_TASK_PRIORITY = 4;
 
 void train_reverse_task() {
@@ -33,33 +30,15 @@ void train_reverse_task() {
   Exit();
 }
 
-void train_off_solenoid_task() {
-  int train_controller = WhoIs("train");
-  int clock_server = WhoIs("clock_server");
-
-  struct TrainRequest req = {.type = OFF_LAST_SOLENOID_NOTIFY};
-  Delay(clock_server, DELAY_OFF_LAST_SOLENOID);
-  Send(train_controller, (const char *) &req, sizeof(req), NULL, 0);
-  Exit();
-}
-
-static void handle_off_last_solenoid(struct Trainset *trainset, uint64_t current_time) {
-  // multiple switches in a short duration can cause the solenoid to be switched off many times
-  // when it is already off.
-  if (current_time - trainset->last_track_switch_time >= DELAY_OFF_LAST_SOLENOID) {
-    DispatchTrainCommand(trainset->train_dispatcher, CMD_OFF_LAST_SOLENOID, 1);
-  }
-}
-
 void train_task() {
   RegisterAs("train");
 
   int clock_server = WhoIs("clock_server");
-  int marklin_tx = WhoIs("marklin_io_tx");
+  int train_dispatcher = WhoIs("train_dispatch");
   int terminal = WhoIs("terminal");
 
   struct Trainset trainset;
-  trainset_init(&trainset, marklin_tx);
+  trainset_init(&trainset, train_dispatcher);
 
   Create(TRAIN_TASK_PRIORITY, train_calibrator_task);
 
@@ -77,7 +56,6 @@ void train_task() {
         Reply(tid, NULL, 0);
         break;
       case SET_SWITCH_DIR:
-        Reply(tid, NULL, 0);
         trainset_set_switch_direction(
             &trainset,
             terminal,
@@ -85,6 +63,8 @@ void train_task() {
             req.set_switch_dir_req.dir,
             Time(clock_server)
         );
+        // the caller's next walk along the track sees the switch, like a GET_SWITCH_STATE would
+        Reply(tid, NULL, 0);
         break;
       case REVERSE_TRAIN:
         Reply(tid, NULL, 0);
@@ -114,10 +94,6 @@ void train_task() {
         Reply(tid, NULL, 0);
         trainset_set_track(&trainset, req.set_track_req.track);
         break;
-      case SENSOR_DATA_NOTIFY:
-        trainset_update_sensor_data(&trainset, req.update_sensor_data_req.sensor_data);
-        Reply(tid, NULL, 0);
-        break;
       case REVERSE_TRAIN_NOTIFY:
         trainset_set_train_speed(
             &trainset, terminal, req.reverse_notify_req.train, SPEED_REVERSE_DIRECTION
@@ -127,10 +103,6 @@ void train_task() {
         );
         Reply(tid, NULL, 0);
         break;
-      case OFF_LAST_SOLENOID_NOTIFY:
-        Reply(tid, NULL, 0);
-        handle_off_last_solenoid(&trainset, Time(clock_server));
-        break;
     }
   }
 
@@ -192,13 +164,6 @@ enum SwitchDirection TrainGetSwitchState(int tid, uint8_t switch_num) {
   return res.switch_state;
 }
 
-void TrainUpdateSensorData(int tid, bool *sensor_data) {
-  struct TrainRequest req = {
-      .type = SENSOR_DATA_NOTIFY, .update_sensor_data_req = {.sensor_data = sensor_data}
-  };
-  Send(tid, (const char *) &req, sizeof(req), NULL, 0);
-}
-
 // TODO:
 // - route test to C5.
 // - override routes
@@ -14,17 +14,11 @@ enum TrainRequestType {
   SET_SWITCH_DIR,
   IS_VALID_TRAIN,
   GET_SWITCH_STATE,
-  OFF_LAST_SOLENOID_NOTIFY,
-  REVERSE_TRAIN_NOTIFY,
-  SENSOR_DATA_NOTIFY
+  REVERSE_TRAIN_NOTIFY
 };
 
 extern const int TRAIN_TASK_PRIORITY;
 
-struct TrainUpdateSensorDataRequest {
-  bool *sensor_data;
-};
-
 struct TrainReverseNotifyRequest {
   int train;
   int speed;
@@ -68,7 +62,6 @@ struct TrainRequest {
   enum TrainRequestType type;
 
   union {
-    struct TrainUpdateSensorDataRequest update_sensor_data_req;
     struct TrainReverseNotifyRequest reverse_notify_req;
     struct TrainReverseRequest reverse_req;
     struct TrainSetTrainSpeedRequest set_train_speed_req;
@@ -81,9 +74,7 @@ struct TrainRequest {
 
 void train_task();
 void train_reverse_task();
-void train_off_solenoid_task();
 
-void TrainUpdateSensorData(int tid, bool *sensor_data);
 void TrainReverse(int tid, uint8_t train);
 void TrainReverseInstant(int tid, uint8_t train);
 void TrainSetSpeed(int tid, uint8_t train, uint8_t speed);
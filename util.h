@@ -11,6 +11,8 @@ void ui2a(uint64_t num, unsigned int base, char *bf);
 void i2a(int64_t num, char *bf);
 
 // memory
+#define CACHE_LINE_SIZE 64
+
 void *memset(void *s, int c, size_t n);
 void *memcpy(void *restrict dest, const void *restrict src, size_t n);
 